@@ -47,6 +47,18 @@
 
         This represents what type a float arg is passed as.  It is used when the type is
         not promoted to double.
+
+   __OBSOLETE_MATH_DEFAULT
+
+	Default value for __OBSOLETE_MATH if that is not set: 1 to build libm's
+	exp, exp2, log, log2 and pow (double and float) from the original fdlibm
+	code, 0 for the table driven code in libm/common.  The new code wants
+	double arithmetic in hardware, without excess precision.
+
+   __OBSOLETE_MATH
+
+	If set to 1 then some new math code is disabled in favour of the
+	original code; see __OBSOLETE_MATH_DEFAULT.
 	
 */
 
@@ -432,3 +444,15 @@
 #endif /* not __IEEE_LITTLE_ENDIAN */
 #endif /* not __IEEE_BIG_ENDIAN */
 
+#ifndef __OBSOLETE_MATH_DEFAULT
+#if (defined (__x86_64__) || defined (__aarch64__) \
+     || ((defined (__arm__) || defined (__thumb__)) && defined (__ARM_FP) \
+	 && (__ARM_FP & 8))) && !defined (_DOUBLE_IS_32BITS)
+#define __OBSOLETE_MATH_DEFAULT 0
+#else
+#define __OBSOLETE_MATH_DEFAULT 1
+#endif
+#endif
+#ifndef __OBSOLETE_MATH
+#define __OBSOLETE_MATH __OBSOLETE_MATH_DEFAULT
+#endif
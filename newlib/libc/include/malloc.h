@@ -156,6 +156,7 @@ extern _VOID _mstats_r _PARAMS ((struct _reent *, char *));
 #define M_TOP_PAD           -2
 #define M_MMAP_THRESHOLD    -3 
 #define M_MMAP_MAX          -4
+#define M_ARENA_MAX         -8
 
 #ifndef __CYGWIN__
 /* Some systems provide this, so do too for compatibility.  */
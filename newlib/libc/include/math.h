@@ -103,12 +103,29 @@ union __ldmath
 
 #endif /* !gcc >= 3.3  */
 
+/* libm has vector versions of some functions, for the vector function
+   ABIs of x86_64 and AArch64, which GCC calls from loops it vectorizes
+   when told of them with __DECL_SIMD.  They do not set errno, so this is
+   only done with -fno-math-errno.  Cygwin, on the Win64 ABI, has none.  */
+#ifndef __DECL_SIMD
+#if defined (__GNUC__) && !defined (__clang__) && defined (__NO_MATH_ERRNO__) \
+    && !__OBSOLETE_MATH \
+    && ((defined (__x86_64__) && !defined (__ILP32__) \
+	 && !defined (__CYGWIN__) && __GNUC_PREREQ (6, 0)) \
+	|| (defined (__aarch64__) && !defined (__ARM_FEATURE_SVE) \
+	    && __GNUC_PREREQ (9, 0)))
+#define __DECL_SIMD __attribute__ ((__simd__ ("notinbranch")))
+#else
+#define __DECL_SIMD
+#endif
+#endif
+
 /* Reentrant ANSI C functions.  */
 
 #ifndef __math_68881
 extern double atan _PARAMS((double));
-extern double cos _PARAMS((double));
-extern double sin _PARAMS((double));
+extern double cos _PARAMS((double)) __DECL_SIMD;
+extern double sin _PARAMS((double)) __DECL_SIMD;
 extern double tan _PARAMS((double));
 extern double tanh _PARAMS((double));
 extern double frexp _PARAMS((double, int *));
@@ -127,11 +144,11 @@ extern double asin _PARAMS((double));
 extern double atan2 _PARAMS((double, double));
 extern double cosh _PARAMS((double));
 extern double sinh _PARAMS((double));
-extern double exp _PARAMS((double));
+extern double exp _PARAMS((double)) __DECL_SIMD;
 extern double ldexp _PARAMS((double, int));
-extern double log _PARAMS((double));
+extern double log _PARAMS((double)) __DECL_SIMD;
 extern double log10 _PARAMS((double));
-extern double pow _PARAMS((double, double));
+extern double pow _PARAMS((double, double)) __DECL_SIMD;
 extern double sqrt _PARAMS((double));
 extern double fmod _PARAMS((double, double));
 #endif /* ! defined (__math_68881) */
@@ -322,7 +339,7 @@ extern double nextafter _PARAMS((double, double));
 extern double rint _PARAMS((double));
 extern double scalbn _PARAMS((double, int));
 
-extern double exp2 _PARAMS((double));
+extern double exp2 _PARAMS((double)) __DECL_SIMD;
 extern double scalbln _PARAMS((double, long int));
 extern double tgamma _PARAMS((double));
 extern double nearbyint _PARAMS((double));
@@ -351,8 +368,8 @@ extern double gamma _PARAMS((double));
 extern double lgamma _PARAMS((double));
 extern double erf _PARAMS((double));
 extern double erfc _PARAMS((double));
-extern double log2 _PARAMS((double));
-#if !defined(__cplusplus)
+extern double log2 _PARAMS((double)) __DECL_SIMD;
+#if !defined(__cplusplus) && __OBSOLETE_MATH
 #define log2(x) (log (x) / _M_LN2)
 #endif
 
@@ -365,8 +382,8 @@ extern double hypot _PARAMS((double, double));
 /* Single precision versions of ANSI functions.  */
 
 extern float atanf _PARAMS((float));
-extern float cosf _PARAMS((float));
-extern float sinf _PARAMS((float));
+extern float cosf _PARAMS((float)) __DECL_SIMD;
+extern float sinf _PARAMS((float)) __DECL_SIMD;
 extern float tanf _PARAMS((float));
 extern float tanhf _PARAMS((float));
 extern float frexpf _PARAMS((float, int *));
@@ -381,18 +398,18 @@ extern float asinf _PARAMS((float));
 extern float atan2f _PARAMS((float, float));
 extern float coshf _PARAMS((float));
 extern float sinhf _PARAMS((float));
-extern float expf _PARAMS((float));
+extern float expf _PARAMS((float)) __DECL_SIMD;
 extern float ldexpf _PARAMS((float, int));
-extern float logf _PARAMS((float));
+extern float logf _PARAMS((float)) __DECL_SIMD;
 extern float log10f _PARAMS((float));
-extern float powf _PARAMS((float, float));
+extern float powf _PARAMS((float, float)) __DECL_SIMD;
 extern float sqrtf _PARAMS((float));
 extern float fmodf _PARAMS((float, float));
 #endif /* ! defined (_REENT_ONLY) */
 
 /* Other single precision functions.  */
 
-extern float exp2f _PARAMS((float));
+extern float exp2f _PARAMS((float)) __DECL_SIMD;
 extern float scalblnf _PARAMS((float, long int));
 extern float tgammaf _PARAMS((float));
 extern float nearbyintf _PARAMS((float));
@@ -430,7 +447,7 @@ extern float gammaf _PARAMS((float));
 extern float lgammaf _PARAMS((float));
 extern float erff _PARAMS((float));
 extern float erfcf _PARAMS((float));
-extern float log2f _PARAMS((float));
+extern float log2f _PARAMS((float)) __DECL_SIMD;
 extern float hypotf _PARAMS((float, float));
 #endif /* ! defined (_REENT_ONLY) */
 
@@ -554,8 +571,8 @@ extern float jnf _PARAMS((int, float));
 
 /* GNU extensions */
 #if __GNU_VISIBLE
-extern void sincos _PARAMS((double, double *, double *));
-extern void sincosf _PARAMS((float, float *, float *));
+extern void sincos _PARAMS((double, double *, double *)) __DECL_SIMD;
+extern void sincosf _PARAMS((float, float *, float *)) __DECL_SIMD;
 #ifdef __CYGWIN__
 extern void sincosl _PARAMS((long double, long double *, long double *));
 #endif /* __CYGWIN__ */
@@ -33,7 +33,13 @@ typedef enum {
 typedef struct node {
 	char         *key;
 	struct node  *llink, *rlink;
+	signed char   balance;	/* AVL: height(rlink) - height(llink) */
 } node_t;
+
+/* An AVL tree of n nodes is less than 1.45 * log2(n + 2) deep.  */
+#define	__TREE_MAX_DEPTH	(2 * 8 * sizeof (void *))
+
+node_t	*__tree_rotate(node_t *, int, int *);
 #endif
 
 struct hsearch_data
@@ -42,6 +48,10 @@ struct hsearch_data
   size_t htablesize;
 };
 
+/* Hash functions for hcreate_hash_r.  */
+#define	HSEARCH_HASH_BSD	0	/* dbopen's hash, the hcreate_r default */
+#define	HSEARCH_HASH_FAST	1	/* wyhash-style 64-bit multiply hash */
+
 #ifndef __compar_fn_t_defined
 #define __compar_fn_t_defined
 typedef int (*__compar_fn_t) (const void *, const void *);
@@ -52,6 +62,7 @@ int	 hcreate(size_t);
 void	 hdestroy(void);
 ENTRY	*hsearch(ENTRY, ACTION);
 int	 hcreate_r(size_t, struct hsearch_data *);
+int	 hcreate_hash_r(size_t, int, struct hsearch_data *);
 void	 hdestroy_r(struct hsearch_data *);
 int	hsearch_r(ENTRY, ACTION, ENTRY **, struct hsearch_data *);
 void	*tdelete(const void *__restrict, void **__restrict, __compar_fn_t);
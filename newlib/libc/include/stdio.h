@@ -100,6 +100,7 @@ typedef _fpos64_t fpos64_t;
 
 /* _flags2 flags */
 #define	__SNLK  0x0001		/* stdio functions do not lock streams themselves */
+#define	__SMAP  0x0002		/* read through mmap windows where possible */
 #define	__SWID	0x2000		/* true => stream orientation wide, false => byte, only valid if __SORD in _flags is true */
 
 /*
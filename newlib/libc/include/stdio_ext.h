@@ -22,6 +22,13 @@ _BEGIN_STD_C
 void	 _EXFUN(__fpurge,(FILE *));
 int	 _EXFUN(__fsetlocking,(FILE *, int));
 
+#ifdef _STDIO_LOCK_ELISION
+/* Zero while the process has a single thread, and stdio locks no
+   streams.  The thread library sets it before starting a second thread;
+   a program that starts threads some other way must set it first.  */
+extern int __stdio_threaded;
+#endif
+
 /* TODO:
 
    void _flushlbf (void);
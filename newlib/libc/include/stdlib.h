@@ -137,6 +137,10 @@ int	_EXFUN(_mkstemp_r, (struct _reent *, char *));
 int	_EXFUN(_mkstemps_r, (struct _reent *, char *, int));
 char *	_EXFUN(_mktemp_r, (struct _reent *, char *) _ATTRIBUTE ((__deprecated__("the use of `mktemp' is dangerous; use `mkstemp' instead"))));
 _VOID	_EXFUN(qsort,(_PTR __base, size_t __nmemb, size_t __size, __compar_fn_t _compar));
+#if __BSD_VISIBLE
+_VOID	_EXFUN(qsort_mt,(_PTR __base, size_t __nmemb, size_t __size, __compar_fn_t _compar, int __nthreads));
+int	_EXFUN(qsort_mt_stable,(_PTR __base, size_t __nmemb, size_t __size, __compar_fn_t _compar, int __nthreads));
+#endif
 int	_EXFUN(rand,(_VOID));
 _PTR	_EXFUN_NOTHROW(realloc,(_PTR __r, size_t __size));
 #if __BSD_VISIBLE
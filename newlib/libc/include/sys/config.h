@@ -97,6 +97,14 @@
 /* we use some glibc header files so turn on glibc large file feature */
 #define _LARGEFILE64_SOURCE 1
 #endif
+#ifdef __linux__
+/* fopen mode "m" reads regular files through mmap windows */
+#define _STDIO_MMAP 1
+/* large stdio writes to descriptors go out through writev */
+#define _STDIO_WRITEV 1
+/* stdio locks no streams until a second thread is started */
+#define _STDIO_LOCK_ELISION 1
+#endif
 #endif
 
 #ifdef __mn10200__
@@ -619,6 +619,8 @@ struct _reent
           _mbstate_t _wcrtomb_state;
           _mbstate_t _wcsrtombs_state;
 	  int _h_errno;
+	  void *_malloc_tcache;	/* per-thread malloc cache, see mallocr.c */
+	  void *_malloc_arena;	/* malloc arena of this thread, see mallocr.c */
         } _reent;
   /* Two next two fields were once used by malloc.  They are no longer
      used. They are used to preserve the space used before so as to
@@ -741,6 +743,8 @@ struct _reent
 #define _REENT_L64A_BUF(ptr)    ((ptr)->_new._reent._l64a_buf)
 #define _REENT_SIGNAL_BUF(ptr)  ((ptr)->_new._reent._signal_buf)
 #define _REENT_GETDATE_ERR_P(ptr) (&((ptr)->_new._reent._getdate_err))
+#define _REENT_MALLOC_TCACHE(ptr) ((ptr)->_new._reent._malloc_tcache)
+#define _REENT_MALLOC_ARENA(ptr) ((ptr)->_new._reent._malloc_arena)
 
 #endif /* !_REENT_SMALL */
 
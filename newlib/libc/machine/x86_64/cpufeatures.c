@@ -0,0 +1,180 @@
+/*
+ ** This file is distributed WITHOUT ANY WARRANTY; without even the implied
+ ** warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* Run-time CPU feature detection for the x86_64 string functions, and
+   for the libm functions in libm/machine/x86_64.
+
+   The entry points declared with DISPATCH in x86_64mach.h call
+   __x86_64_resolve on their first invocation to pick an implementation.
+   All variants are always linked, so the same binary runs on any x86_64
+   CPU; SSE2 is part of the base architecture and is the fallback.  */
+
+#include "x86_64cpu.h"
+
+unsigned int __x86_64_cpu_features;
+
+/* Below about 2 KiB the startup cost of rep movsb outweighs its
+   throughput, even with ERMS.  */
+#define REP_MOVSB_THRESHOLD	2048
+
+/* Used when the share of the cache cannot be determined.  */
+#define DEFAULT_LLC_SHARE	(1UL * 1024 * 1024)
+
+/* No real part gives one thread much more than this; virtual machines
+   can report the host's whole last level cache as unshared.  */
+#define MAX_LLC_SHARE		(8UL * 1024 * 1024)
+
+unsigned long __x86_64_rep_movsb_threshold = ~0UL;
+unsigned long __x86_64_nt_threshold = DEFAULT_LLC_SHARE / 4 * 3;
+
+static inline void
+cpuid (unsigned int leaf, unsigned int subleaf, unsigned int *a,
+       unsigned int *b, unsigned int *c, unsigned int *d)
+{
+  __asm__ volatile ("cpuid"
+		    : "=a" (*a), "=b" (*b), "=c" (*c), "=d" (*d)
+		    : "a" (leaf), "c" (subleaf));
+}
+
+static inline unsigned long long
+xgetbv (void)
+{
+  unsigned int lo, hi;
+
+  __asm__ volatile ("xgetbv" : "=a" (lo), "=d" (hi) : "c" (0));
+  return ((unsigned long long) hi << 32) | lo;
+}
+
+/* Return the size in bytes of the highest level cache that leaf, 4 or
+   AMD's 0x8000001d which has the same layout, describes, divided by the
+   number of threads sharing it; 0 if the leaf lists no caches.  */
+
+static unsigned long
+cache_share (unsigned int leaf)
+{
+  unsigned int a, b, c, d, i;
+  unsigned long size = 0, level_size;
+  unsigned int level = 0;
+
+  for (i = 0; i < 16; i++)
+    {
+      cpuid (leaf, i, &a, &b, &c, &d);
+      if ((a & 0x1f) == 0)
+	break;
+      if ((a & 0x1f) == 2)		/* Instruction cache.  */
+	continue;
+      level_size = (unsigned long) ((b >> 22) + 1)
+		   * (((b >> 12) & 0x3ff) + 1)
+		   * ((b & 0xfff) + 1)
+		   * (c + 1)
+		   / (((a >> 14) & 0xfff) + 1);
+      if (((a >> 5) & 7) >= level)
+	{
+	  level = (a >> 5) & 7;
+	  size = level_size;
+	}
+    }
+  return size;
+}
+
+/* Return how much of the last level cache one thread can count on, or 0
+   if unknown.  Intel reports its caches in leaf 4.  AMD leaves leaf 4
+   empty and uses 0x8000001d where it has topology extensions; older
+   parts only give the L2 and L3 sizes in 0x80000006, which are split
+   by the most threads a package can have, from leaf 1.  */
+
+static unsigned long
+llc_share (unsigned int max_leaf)
+{
+  unsigned int a, b, c, d, max_ext, threads;
+  unsigned long size = 0;
+
+  if (max_leaf >= 4)
+    size = cache_share (4);
+  if (size != 0)
+    return size;
+
+  cpuid (0x80000000, 0, &max_ext, &b, &c, &d);
+  if (max_ext >= 0x8000001d)
+    {
+      cpuid (0x80000001, 0, &a, &b, &c, &d);
+      if (c & (1 << 22))
+	size = cache_share (0x8000001d);
+      if (size != 0)
+	return size;
+    }
+  if (max_ext >= 0x80000006)
+    {
+      cpuid (1, 0, &a, &b, &c, &d);
+      threads = (d & (1 << 28)) && ((b >> 16) & 0xff) != 0
+		? (b >> 16) & 0xff : 1;
+      cpuid (0x80000006, 0, &a, &b, &c, &d);
+      if ((d >> 18) != 0)
+	return (unsigned long) (d >> 18) * 512 * 1024 / threads;
+      return (unsigned long) (c >> 16) * 1024 / threads;
+    }
+  return 0;
+}
+
+void
+__x86_64_init_cpu_features (void)
+{
+  unsigned int a, b, c, d, max_leaf;
+  unsigned int features = X86_64_FEATURE_INIT;
+  unsigned long long xcr0 = 0;
+  unsigned long size;
+
+  cpuid (0, 0, &max_leaf, &b, &c, &d);
+  cpuid (1, 0, &a, &b, &c, &d);
+
+  /* OSXSAVE tells us XGETBV is usable; XCR0 then says which register
+     files the OS saves across context switches.  */
+  if (c & (1 << 27))
+    xcr0 = xgetbv ();
+
+  if (c & (1 << 19))
+    features |= X86_64_FEATURE_SSE4_1;
+  if ((c & (1 << 12)) && (xcr0 & 0x06) == 0x06)
+    features |= X86_64_FEATURE_FMA;
+
+  if (max_leaf >= 7)
+    {
+      cpuid (7, 0, &a, &b, &c, &d);
+      if ((b & (1 << 5)) && (xcr0 & 0x06) == 0x06)
+	features |= X86_64_FEATURE_AVX2;
+      if ((b & (1 << 16)) && (b & (1 << 30)) && (xcr0 & 0xe6) == 0xe6)
+	features |= X86_64_FEATURE_AVX512BW;
+      if (b & (1 << 9))
+	features |= X86_64_FEATURE_ERMS;
+    }
+
+  if (features & X86_64_FEATURE_ERMS)
+    __x86_64_rep_movsb_threshold = REP_MOVSB_THRESHOLD;
+
+  /* Streaming stores only pay off once the copy would evict most of
+     this thread's share of the last level cache anyway; below that the
+     destination is better left cached for whoever reads it next.  */
+  size = llc_share (max_leaf);
+  if (size == 0)
+    size = DEFAULT_LLC_SHARE;
+  if (size > MAX_LLC_SHARE)
+    size = MAX_LLC_SHARE;
+  __x86_64_nt_threshold = size / 4 * 3;
+
+  __x86_64_cpu_features = features;
+}
+
+void *
+__x86_64_resolve (void *sse2, void *avx2, void *evex)
+{
+  if (!(__x86_64_cpu_features & X86_64_FEATURE_INIT))
+    __x86_64_init_cpu_features ();
+
+  if (__x86_64_cpu_features & X86_64_FEATURE_AVX512BW)
+    return evex;
+  if (__x86_64_cpu_features & X86_64_FEATURE_AVX2)
+    return avx2;
+  return sse2;
+}
@@ -0,0 +1,249 @@
+/*
+ ** This file is distributed WITHOUT ANY WARRANTY; without even the implied
+ ** warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+/* Size-tiered memmove body, included by memcpy.S once per vector width.
+   The includer defines NAME, VEC_SIZE, VMOVU, VMOVA, VMOVNT, VZEROUPPER
+   and the vector registers V0 to V8.
+
+   Up to 8 vectors, all source bytes are loaded before anything is stored,
+   using a pair of overlapping loads from each end, so overlap needs no
+   special handling.  Larger copies keep the first and last vectors in
+   registers, run an aligned-store loop in whichever direction is safe and
+   finish with the saved vectors.  Forward copies that do not overlap use
+   rep movsb between __x86_64_rep_movsb_threshold and
+   __x86_64_nt_threshold, and streaming stores above the latter.  */
+
+#define L(x) CONCAT1 (NAME, CONCAT1 (_, x))
+
+  .global SYM (NAME)
+  SOTYPE_FUNCTION(NAME)
+
+  .p2align 4
+SYM (NAME):
+  movq    rdi, rax                /* Store destination in return value */
+  cmpq    $VEC_SIZE, rdx
+  jb      L(less_vec)
+  cmpq    $(VEC_SIZE * 2), rdx
+  ja      L(more_2x_vec)
+  VMOVU   (rsi), V0
+  VMOVU   -VEC_SIZE (rsi, rdx), V1
+  VMOVU   V0, (rdi)
+  VMOVU   V1, -VEC_SIZE (rdi, rdx)
+  VZEROUPPER
+  ret
+
+L(less_vec):
+#if VEC_SIZE > 16
+  cmpl    $16, edx
+  jae     L(between_16_31)
+#endif
+  cmpl    $8, edx
+  jae     L(between_8_15)
+  cmpl    $4, edx
+  jae     L(between_4_7)
+  cmpl    $1, edx
+  ja      L(between_2_3)
+  jb      1f
+  movzbl  (rsi), ecx
+  movb    cl, (rdi)
+1:
+  ret
+
+#if VEC_SIZE > 16
+L(between_16_31):
+  vmovdqu (rsi), xmm0
+  vmovdqu -16 (rsi, rdx), xmm1
+  vmovdqu xmm0, (rdi)
+  vmovdqu xmm1, -16 (rdi, rdx)
+  ret
+#endif
+
+L(between_8_15):
+  movq    (rsi), rcx
+  movq    -8 (rsi, rdx), r8
+  movq    rcx, (rdi)
+  movq    r8, -8 (rdi, rdx)
+  ret
+
+L(between_4_7):
+  movl    (rsi), ecx
+  movl    -4 (rsi, rdx), esi
+  movl    ecx, (rdi)
+  movl    esi, -4 (rdi, rdx)
+  ret
+
+L(between_2_3):
+  movzwl  (rsi), ecx
+  movzbl  -1 (rsi, rdx), esi
+  movw    cx, (rdi)
+  movb    sil, -1 (rdi, rdx)
+  ret
+
+L(more_2x_vec):
+  cmpq    $(VEC_SIZE * 8), rdx
+  ja      L(more_8x_vec)
+  cmpq    $(VEC_SIZE * 4), rdx
+  ja      L(between_4x_8x)
+  VMOVU   (rsi), V0
+  VMOVU   VEC_SIZE (rsi), V1
+  VMOVU   -VEC_SIZE (rsi, rdx), V2
+  VMOVU   -(VEC_SIZE * 2) (rsi, rdx), V3
+  VMOVU   V0, (rdi)
+  VMOVU   V1, VEC_SIZE (rdi)
+  VMOVU   V2, -VEC_SIZE (rdi, rdx)
+  VMOVU   V3, -(VEC_SIZE * 2) (rdi, rdx)
+  VZEROUPPER
+  ret
+
+L(between_4x_8x):
+  VMOVU   (rsi), V0
+  VMOVU   VEC_SIZE (rsi), V1
+  VMOVU   (VEC_SIZE * 2) (rsi), V2
+  VMOVU   (VEC_SIZE * 3) (rsi), V3
+  VMOVU   -VEC_SIZE (rsi, rdx), V4
+  VMOVU   -(VEC_SIZE * 2) (rsi, rdx), V5
+  VMOVU   -(VEC_SIZE * 3) (rsi, rdx), V6
+  VMOVU   -(VEC_SIZE * 4) (rsi, rdx), V7
+  VMOVU   V0, (rdi)
+  VMOVU   V1, VEC_SIZE (rdi)
+  VMOVU   V2, (VEC_SIZE * 2) (rdi)
+  VMOVU   V3, (VEC_SIZE * 3) (rdi)
+  VMOVU   V4, -VEC_SIZE (rdi, rdx)
+  VMOVU   V5, -(VEC_SIZE * 2) (rdi, rdx)
+  VMOVU   V6, -(VEC_SIZE * 3) (rdi, rdx)
+  VMOVU   V7, -(VEC_SIZE * 4) (rdi, rdx)
+  VZEROUPPER
+  ret
+
+L(more_8x_vec):
+  movq    rdi, rcx                /* Copy backward if dst - src < n */
+  subq    rsi, rcx
+  cmpq    rdx, rcx
+  jb      L(backward)
+  movq    rsi, rcx                /* rcx = src - dst, >= n if disjoint */
+  subq    rdi, rcx
+  cmpq    SYM (__x86_64_nt_threshold) (rip), rdx
+  jae     L(large_forward)
+  cmpq    SYM (__x86_64_rep_movsb_threshold) (rip), rdx
+  jb      L(forward)
+  cmpq    rdx, rcx
+  jb      L(forward)
+  movq    rdx, rcx
+  rep     movsb
+  ret
+
+L(large_forward):
+  cmpq    rdx, rcx
+  jb      L(forward)
+  VMOVU   (rsi), V4               /* Save the first and last vectors */
+  VMOVU   -VEC_SIZE (rsi, rdx), V5
+  VMOVU   -(VEC_SIZE * 2) (rsi, rdx), V6
+  VMOVU   -(VEC_SIZE * 3) (rsi, rdx), V7
+  VMOVU   -(VEC_SIZE * 4) (rsi, rdx), V8
+  movq    rdi, rcx                /* Align the destination */
+  andq    $(VEC_SIZE - 1), rcx
+  subq    $VEC_SIZE, rcx
+  subq    rcx, rdi
+  subq    rcx, rsi
+  addq    rcx, rdx
+
+  .p2align 4
+2:                                /* Stream 4 vectors per iteration */
+  prefetcht0 (VEC_SIZE * 16) (rsi)
+  prefetcht0 (VEC_SIZE * 16 + 64) (rsi)
+  VMOVU   (rsi), V0
+  VMOVU   VEC_SIZE (rsi), V1
+  VMOVU   (VEC_SIZE * 2) (rsi), V2
+  VMOVU   (VEC_SIZE * 3) (rsi), V3
+  VMOVNT  V0, (rdi)
+  VMOVNT  V1, VEC_SIZE (rdi)
+  VMOVNT  V2, (VEC_SIZE * 2) (rdi)
+  VMOVNT  V3, (VEC_SIZE * 3) (rdi)
+  addq    $(VEC_SIZE * 4), rsi
+  addq    $(VEC_SIZE * 4), rdi
+  subq    $(VEC_SIZE * 4), rdx
+  cmpq    $(VEC_SIZE * 4), rdx
+  ja      2b
+  sfence
+  jmp     L(forward_tail)
+
+L(forward):
+  VMOVU   (rsi), V4               /* Save the first and last vectors */
+  VMOVU   -VEC_SIZE (rsi, rdx), V5
+  VMOVU   -(VEC_SIZE * 2) (rsi, rdx), V6
+  VMOVU   -(VEC_SIZE * 3) (rsi, rdx), V7
+  VMOVU   -(VEC_SIZE * 4) (rsi, rdx), V8
+  movq    rdi, rcx                /* Align the destination */
+  andq    $(VEC_SIZE - 1), rcx
+  subq    $VEC_SIZE, rcx
+  subq    rcx, rdi
+  subq    rcx, rsi
+  addq    rcx, rdx
+
+  .p2align 4
+3:                                /* Copy 4 vectors per iteration */
+  VMOVU   (rsi), V0
+  VMOVU   VEC_SIZE (rsi), V1
+  VMOVU   (VEC_SIZE * 2) (rsi), V2
+  VMOVU   (VEC_SIZE * 3) (rsi), V3
+  VMOVA   V0, (rdi)
+  VMOVA   V1, VEC_SIZE (rdi)
+  VMOVA   V2, (VEC_SIZE * 2) (rdi)
+  VMOVA   V3, (VEC_SIZE * 3) (rdi)
+  addq    $(VEC_SIZE * 4), rsi
+  addq    $(VEC_SIZE * 4), rdi
+  subq    $(VEC_SIZE * 4), rdx
+  cmpq    $(VEC_SIZE * 4), rdx
+  ja      3b
+
+L(forward_tail):                  /* rdi + rdx is still the end */
+  VMOVU   V5, -VEC_SIZE (rdi, rdx)
+  VMOVU   V6, -(VEC_SIZE * 2) (rdi, rdx)
+  VMOVU   V7, -(VEC_SIZE * 3) (rdi, rdx)
+  VMOVU   V8, -(VEC_SIZE * 4) (rdi, rdx)
+  VMOVU   V4, (rax)
+  VZEROUPPER
+  ret
+
+L(backward):
+  VMOVU   (rsi), V4               /* Save the first and last vectors */
+  VMOVU   VEC_SIZE (rsi), V5
+  VMOVU   (VEC_SIZE * 2) (rsi), V6
+  VMOVU   (VEC_SIZE * 3) (rsi), V7
+  VMOVU   -VEC_SIZE (rsi, rdx), V8
+  leaq    (rdi, rdx), r10         /* End of the destination */
+  leaq    (rsi, rdx), rcx         /* End of the source */
+  movq    r10, r9                 /* Align the end of the destination */
+  andq    $(VEC_SIZE - 1), r9
+  subq    r9, rcx
+  subq    r9, rdx
+  movq    r10, r9
+  andq    $-VEC_SIZE, r9
+
+  .p2align 4
+4:                                /* Copy 4 vectors per iteration */
+  VMOVU   -VEC_SIZE (rcx), V0
+  VMOVU   -(VEC_SIZE * 2) (rcx), V1
+  VMOVU   -(VEC_SIZE * 3) (rcx), V2
+  VMOVU   -(VEC_SIZE * 4) (rcx), V3
+  VMOVA   V0, -VEC_SIZE (r9)
+  VMOVA   V1, -(VEC_SIZE * 2) (r9)
+  VMOVA   V2, -(VEC_SIZE * 3) (r9)
+  VMOVA   V3, -(VEC_SIZE * 4) (r9)
+  subq    $(VEC_SIZE * 4), rcx
+  subq    $(VEC_SIZE * 4), r9
+  subq    $(VEC_SIZE * 4), rdx
+  cmpq    $(VEC_SIZE * 4), rdx
+  ja      4b
+
+  VMOVU   V4, (rdi)
+  VMOVU   V5, VEC_SIZE (rdi)
+  VMOVU   V6, (VEC_SIZE * 2) (rdi)
+  VMOVU   V7, (VEC_SIZE * 3) (rdi)
+  VMOVU   V8, -VEC_SIZE (r10)
+  VZEROUPPER
+  ret
+
+#undef L
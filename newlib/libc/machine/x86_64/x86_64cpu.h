@@ -0,0 +1,34 @@
+/*
+ ** This file is distributed WITHOUT ANY WARRANTY; without even the implied
+ ** warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ */
+
+#ifndef _X86_64CPU_H_
+#define _X86_64CPU_H_
+
+/* Bits of __x86_64_cpu_features.  An instruction set extension is only
+   reported when the OS has also enabled the register state it needs.  */
+
+#define X86_64_FEATURE_INIT	0x0001	/* Features have been probed.  */
+#define X86_64_FEATURE_AVX2	0x0002
+#define X86_64_FEATURE_AVX512BW	0x0004
+#define X86_64_FEATURE_ERMS	0x0008	/* Enhanced rep movsb/stosb.  */
+#define X86_64_FEATURE_SSE4_1	0x0010
+#define X86_64_FEATURE_FMA	0x0020
+
+#ifndef __ASSEMBLER__
+
+extern unsigned int __x86_64_cpu_features;
+
+/* Copies of at least this many bytes use rep movsb; ~0 without ERMS.  */
+extern unsigned long __x86_64_rep_movsb_threshold;
+
+/* Copies of at least this many bytes use non-temporal stores.  */
+extern unsigned long __x86_64_nt_threshold;
+
+void __x86_64_init_cpu_features (void);
+void *__x86_64_resolve (void *, void *, void *);
+
+#endif /* !__ASSEMBLER__ */
+
+#endif /* _X86_64CPU_H_ */
@@ -30,6 +30,7 @@
 #define rdi REG(rdi)
 #define rbp REG(rbp)
 #define rsp REG(rsp)
+#define rip REG(rip)
 
 #define r8  REG(r8)
 #define r9  REG(r9)
@@ -91,6 +92,45 @@
 #define xmm5 REG(xmm5)
 #define xmm6 REG(xmm6)
 #define xmm7 REG(xmm7)
+#define xmm8 REG(xmm8)
+#define xmm9 REG(xmm9)
+#define xmm10 REG(xmm10)
+#define xmm11 REG(xmm11)
+#define xmm12 REG(xmm12)
+#define xmm13 REG(xmm13)
+#define xmm14 REG(xmm14)
+#define xmm15 REG(xmm15)
+
+#define ymm0 REG(ymm0)
+#define ymm1 REG(ymm1)
+#define ymm2 REG(ymm2)
+#define ymm3 REG(ymm3)
+#define ymm4 REG(ymm4)
+#define ymm5 REG(ymm5)
+#define ymm6 REG(ymm6)
+#define ymm7 REG(ymm7)
+#define ymm8 REG(ymm8)
+#define ymm9 REG(ymm9)
+#define ymm10 REG(ymm10)
+#define ymm11 REG(ymm11)
+#define ymm12 REG(ymm12)
+#define ymm13 REG(ymm13)
+#define ymm14 REG(ymm14)
+#define ymm15 REG(ymm15)
+
+#define zmm0 REG(zmm0)
+#define zmm1 REG(zmm1)
+#define zmm2 REG(zmm2)
+#define zmm3 REG(zmm3)
+#define zmm4 REG(zmm4)
+#define zmm5 REG(zmm5)
+#define zmm6 REG(zmm6)
+#define zmm7 REG(zmm7)
+
+#define k1 REG(k1)
+#define k2 REG(k2)
+#define k3 REG(k3)
+#define k4 REG(k4)
 
 #define cr0 REG(cr0)
 #define cr1 REG(cr1)
@@ -111,3 +151,39 @@
 #define __CLI  cli
 #define __STI  sti
 #endif
+
+/* Define NAME as an entry point that binds itself on first call to one of
+   the implementations SSE2, AVX2 or EVEX, as chosen by __x86_64_resolve
+   from the features of the running CPU.  Until then the pointer refers to
+   a resolver stub, which preserves the argument registers across the call
+   into C.  Racing first calls are harmless: every thread stores the same
+   value.  */
+
+#define DISPATCH(name, sse2, avx2, evex)		\
+  .data;						\
+  .p2align 3;						\
+CONCAT1 (name, _impl):					\
+  .quad   CONCAT1 (name, _resolve);			\
+  .text;						\
+  .global SYM (name);					\
+  SOTYPE_FUNCTION(name);				\
+  .p2align 4;						\
+SYM (name):						\
+  jmp     *CONCAT1 (name, _impl) (rip);			\
+CONCAT1 (name, _resolve):				\
+  pushq   rdi;						\
+  pushq   rsi;						\
+  pushq   rdx;						\
+  pushq   rcx;						\
+  pushq   r8;						\
+  leaq    SYM (sse2) (rip), rdi;			\
+  leaq    SYM (avx2) (rip), rsi;			\
+  leaq    SYM (evex) (rip), rdx;			\
+  call    SYM (__x86_64_resolve);			\
+  movq    rax, CONCAT1 (name, _impl) (rip);		\
+  popq    r8;						\
+  popq    rcx;						\
+  popq    rdx;						\
+  popq    rsi;						\
+  popq    rdi;						\
+  jmp     *rax
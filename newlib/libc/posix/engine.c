@@ -46,6 +46,8 @@
 #ifdef SNAMES
 #define	matcher	smatcher
 #define	fast	sfast
+#define	dfast	sdfast
+#define	bound	sbound
 #define	slow	sslow
 #define	dissect	sdissect
 #define	backref	sbackref
@@ -57,6 +59,8 @@
 #ifdef LNAMES
 #define	matcher	lmatcher
 #define	fast	lfast
+#define	dfast	ldfast
+#define	bound	lbound
 #define	slow	lslow
 #define	dissect	ldissect
 #define	backref	lbackref
@@ -93,6 +97,8 @@ static int matcher(struct re_guts *g, char *string, size_t nmatch, regmatch_t pm
 static char *dissect(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static char *backref(struct match *m, char *start, char *stop, sopno startst, sopno stopst, sopno lev);
 static char *fast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
+static char *dfast(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
+static states bound(struct match *m, sopno startst, sopno stopst, states st, int lastc, int c);
 static char *slow(struct match *m, char *start, char *stop, sopno startst, sopno stopst);
 static states step(struct re_guts *g, sopno start, sopno stop, states bef, int ch, states aft);
 #define	BOL	(OUT+1)
@@ -151,13 +157,11 @@ int eflags;
 	const sopno gl = g->laststate;
 	char *start;
 	char *stop;
-	/* Boyer-Moore algorithms variables */
-	char *pp;
-	int cj, mj;
-	char *mustfirst;
-	char *mustlast;
-	int *matchjump;
-	int *charjump;
+	/* alternation prefilter variables */
+	struct re_lit *lp;
+	char *lsp;
+	char *lstop;
+	char *litstart;
 
 	/* simplify the situation where possible */
 	if (g->cflags&REG_NOSUB)
@@ -174,46 +178,34 @@ int eflags;
 
 	/* prescreening; this does wonders for this rather slow code */
 	if (g->must != NULL) {
-		if (g->charjump != NULL && g->matchjump != NULL) {
-			mustfirst = g->must;
-			mustlast = g->must + g->mlen - 1;
-			charjump = g->charjump;
-			matchjump = g->matchjump;
-			pp = mustlast;
-			for (dp = start+g->mlen-1; dp < stop;) {
-				/* Fast skip non-matches */
-				while (dp < stop && charjump[(unsigned char) *dp])
-					dp += charjump[(unsigned char) *dp];
-
-				if (dp >= stop)
-					break;
-
-				/* Greedy matcher */
-				/* We depend on not being used for
-				 * for strings of length 1
-				 */
-				while (*--dp == *--pp && pp != mustfirst);
-
-				if (*dp == *pp)
-					break;
+		dp = litscan(g->must, g->mlen, g->mrare, start, stop);
+		if (dp == NULL)		/* we didn't find g->must */
+			return(REG_NOMATCH);
+	}
 
-				/* Jump to next possible match */
-				mj = matchjump[pp - mustfirst];
-				cj = charjump[(unsigned char) *dp];
-				dp += (cj < mj ? mj : cj);
-				pp = mustlast;
-			}
-			if (pp != mustfirst)
-				return(REG_NOMATCH);
-		} else {
-			for (dp = start; dp < stop; dp++)
-				if (*dp == g->must[0] &&
-				    stop - dp >= g->mlen &&
-				    memcmp(dp, g->must, (size_t)g->mlen) == 0)
-					break;
-			if (dp == stop)		/* we didn't find g->must */
-				return(REG_NOMATCH);
+	/* the same for the literals of an alternation, one of which will do */
+	litstart = start;
+	if (g->lits != NULL) {
+		litstart = NULL;
+		for (i = 0; i < g->lits->n && litstart != start; i++) {
+			lp = &g->lits->lit[i];
+			/* one found later than what we have can't help */
+			lstop = stop;
+			if (litstart != NULL && lp->offset > -1 &&
+			    stop - litstart > lp->offset + lp->len)
+				lstop = litstart + lp->offset + lp->len;
+			lsp = litscan(lp->s, lp->len, lp->rare, start, lstop);
+			if (lsp == NULL)
+				continue;
+			if (lp->offset > -1 && lsp - start > lp->offset)
+				lsp -= lp->offset;
+			else
+				lsp = start;
+			if (litstart == NULL || lsp < litstart)
+				litstart = lsp;
 		}
+		if (litstart == NULL)		/* we found none of them */
+			return(REG_NOMATCH);
 	}
 
 	/* match struct setup */
@@ -234,10 +226,15 @@ int eflags;
 	/* Adjust start according to moffset, to speed things up */
 	if (g->moffset > -1)
 		start = ((dp - g->moffset) < start) ? start : dp - g->moffset;
+	if (litstart > start)
+		start = litstart;
 
 	/* this loop does only one repetition except for backrefs */
 	for (;;) {
-		endp = fast(m, start, stop, gf, gl);
+		if (nmatch == 0 && !g->backrefs)
+			endp = dfast(m, start, stop, gf, gl);
+		else
+			endp = fast(m, start, stop, gf, gl);
 		if (endp == NULL) {		/* a miss */
 			STATETEARDOWN(m);
 			return(REG_NOMATCH);
@@ -757,8 +754,6 @@ sopno stopst;
 	char *p = start;
 	int c = (start == m->beginp) ? OUT : *(start-1);
 	int lastc;		/* previous c */
-	int flagch;
-	int i;
 	char *coldp;		/* last p after which no match was underway */
 
 	CLEAR(st);
@@ -773,39 +768,7 @@ sopno stopst;
 		c = (p == m->endp) ? OUT : *p;
 		if (EQ(st, fresh))
 			coldp = p;
-
-		/* is there an EOL and/or BOL between lastc and c? */
-		flagch = '\0';
-		i = 0;
-		if ( (lastc == '\n' && m->g->cflags&REG_NEWLINE) ||
-				(lastc == OUT && !(m->eflags&REG_NOTBOL)) ) {
-			flagch = BOL;
-			i = m->g->nbol;
-		}
-		if ( (c == '\n' && m->g->cflags&REG_NEWLINE) ||
-				(c == OUT && !(m->eflags&REG_NOTEOL)) ) {
-			flagch = (flagch == BOL) ? BOLEOL : EOL;
-			i += m->g->neol;
-		}
-		if (i != 0) {
-			for (; i > 0; i--)
-				st = step(m->g, startst, stopst, st, flagch, st);
-			SP("boleol", st, c);
-		}
-
-		/* how about a word boundary? */
-		if ( (flagch == BOL || (lastc != OUT && !ISWORD(lastc))) &&
-					(c != OUT && ISWORD(c)) ) {
-			flagch = BOW;
-		}
-		if ( (lastc != OUT && ISWORD(lastc)) &&
-				(flagch == EOL || (c != OUT && !ISWORD(c))) ) {
-			flagch = EOW;
-		}
-		if (flagch == BOW || flagch == EOW) {
-			st = step(m->g, startst, stopst, st, flagch, st);
-			SP("boweow", st, c);
-		}
+		st = bound(m, startst, stopst, st, lastc, c);
 
 		/* are we done? */
 		if (ISSET(st, stopst) || p == stop)
@@ -829,6 +792,178 @@ sopno stopst;
 		return(NULL);
 }
 
+/*
+ - dfast - fast(), with the state sets it goes through cached in g->dfa
+ == static char *dfast(struct match *m, char *start, char *stop, \
+ ==	sopno startst, sopno stopst);
+ *
+ * Inside the string, a character whose transition is in the cache costs
+ * one lookup; the first time it is met, it is worked out as fast() would
+ * and remembered.  The ends of the string, where REG_NOTBOL, REG_NOTEOL
+ * and REG_STARTEND come in, are left to the code of fast().
+ */
+static char *
+dfast(m, start, stop, startst, stopst)
+struct match *m;
+char *start;
+char *stop;
+sopno startst;
+sopno stopst;
+{
+	struct re_dfa *d;
+	struct re_dstate *ds;	/* where the cache has got to, or NULL */
+	struct re_dstate *nx;
+	states st = m->st;
+	states fresh = m->fresh;
+	states tmp = m->tmp;
+	char *p = start;
+	int c = (start == m->beginp) ? OUT : *(start-1);
+	int lastc;		/* previous c */
+	int i;
+	unsigned long flushes;
+	char *coldp;		/* last p after which no match was underway */
+
+	if ((d = dclaim(m->g, STATESIZE)) == NULL)
+		return(fast(m, start, stop, startst, stopst));
+
+	CLEAR(st);
+	SET1(st, startst);
+	st = step(m->g, startst, stopst, st, NOTHING, st);
+	ASSIGN(fresh, st);
+	coldp = NULL;
+	ds = NULL;
+	if (p == m->beginp) {
+		i = (m->eflags&REG_NOTBOL) != 0;
+		if ((ds = d->init[i]) == NULL)
+			ds = d->init[i] = dstate(d, STATEBYTES(st),
+					STATEBYTES(fresh), i ? NOTHING : OUT);
+	}
+	for (;;) {
+		if (ds != NULL) {
+			/* through the cache, as far as it goes */
+			nx = NULL;
+			while (p != stop) {
+				if (ds->fresh)
+					coldp = p;
+				c = *p;
+				if ((nx = ds->next[(uch)c]) == NULL) {
+					memcpy(STATEBYTES(st), ds->set, STATESIZE);
+					st = bound(m, startst, stopst, st,
+						(ds->lastc == NOTHING) ? OUT : ds->lastc, c);
+					if (ISSET(st, stopst))
+						nx = DACCEPT;
+					else {
+						ASSIGN(tmp, st);
+						ASSIGN(st, fresh);
+						st = step(m->g, startst, stopst, tmp, c, st);
+						flushes = d->flushes;
+						nx = dstate(d, STATEBYTES(st),
+							STATEBYTES(fresh), DLASTC(c));
+						if (nx == NULL)
+							break;	/* go on with st */
+						if (d->flushes != flushes) {
+							/* ds went with the rest */
+							ds = nx;
+							p++;
+							continue;
+						}
+					}
+					ds->next[(uch)c] = nx;
+				}
+				if (nx == DACCEPT)
+					break;
+				ds = nx;
+				p++;
+			}
+			if (nx == DACCEPT)
+				break;		/* NOTE BREAK OUT */
+			if (p == stop) {
+				memcpy(STATEBYTES(st), ds->set, STATESIZE);
+				c = (p == m->beginp) ? OUT : *(p-1);
+			} else
+				p++;
+			ds = NULL;
+		}
+
+		/* next character, the way fast() does it */
+		lastc = c;
+		c = (p == m->endp) ? OUT : *p;
+		if (EQ(st, fresh))
+			coldp = p;
+		st = bound(m, startst, stopst, st, lastc, c);
+		if (ISSET(st, stopst) || p == stop)
+			break;		/* NOTE BREAK OUT */
+		ASSIGN(tmp, st);
+		ASSIGN(st, fresh);
+		st = step(m->g, startst, stopst, tmp, c, st);
+		p++;
+		if (p != stop)
+			ds = dstate(d, STATEBYTES(st), STATEBYTES(fresh),
+								DLASTC(c));
+	}
+
+	drelease(d);
+	assert(coldp != NULL);
+	m->coldp = coldp;
+	/* ds is left set only when the cache found the match */
+	if (ds != NULL || ISSET(st, stopst))
+		return(p+1);
+	else
+		return(NULL);
+}
+
+/*
+ - bound - step over the assertions that hold between lastc and c
+ == static states bound(struct match *m, sopno startst, sopno stopst, \
+ ==	states st, int lastc, int c);
+ */
+static states
+bound(m, startst, stopst, st, lastc, c)
+struct match *m;
+sopno startst;
+sopno stopst;
+states st;
+int lastc;
+int c;
+{
+	int flagch;
+	int i;
+
+	/* is there an EOL and/or BOL between lastc and c? */
+	flagch = '\0';
+	i = 0;
+	if ( (lastc == '\n' && m->g->cflags&REG_NEWLINE) ||
+			(lastc == OUT && !(m->eflags&REG_NOTBOL)) ) {
+		flagch = BOL;
+		i = m->g->nbol;
+	}
+	if ( (c == '\n' && m->g->cflags&REG_NEWLINE) ||
+			(c == OUT && !(m->eflags&REG_NOTEOL)) ) {
+		flagch = (flagch == BOL) ? BOLEOL : EOL;
+		i += m->g->neol;
+	}
+	if (i != 0) {
+		for (; i > 0; i--)
+			st = step(m->g, startst, stopst, st, flagch, st);
+		SP("boleol", st, c);
+	}
+
+	/* how about a word boundary? */
+	if ( (flagch == BOL || (lastc != OUT && !ISWORD(lastc))) &&
+				(c != OUT && ISWORD(c)) ) {
+		flagch = BOW;
+	}
+	if ( (lastc != OUT && ISWORD(lastc)) &&
+			(flagch == EOL || (c != OUT && !ISWORD(c))) ) {
+		flagch = EOW;
+	}
+	if (flagch == BOW || flagch == EOW) {
+		st = step(m->g, startst, stopst, st, flagch, st);
+		SP("boweow", st, c);
+	}
+	return(st);
+}
+
 /*
  - slow - step through the string more deliberately
  == static char *slow(struct match *m, char *start, \
@@ -1132,6 +1267,8 @@ int ch;
 
 #undef	matcher
 #undef	fast
+#undef	dfast
+#undef	bound
 #undef	slow
 #undef	dissect
 #undef	backref
@@ -47,6 +47,7 @@ static char sccsid[] = "@(#)regcomp.c	8.5 (Berkeley) 3/20/94";
 #include <limits.h>
 #include <stdlib.h>
 #include <regex.h>
+#include <sys/lock.h>
 
 #include "collate.h"
 
@@ -122,8 +123,10 @@ static void enlarge(struct parse *p, sopno size);
 static void stripsnug(struct parse *p, struct re_guts *g);
 static void findmust(struct parse *p, struct re_guts *g);
 static int altoffset(sop *scan, int offset, int mccs);
-static void computejumps(struct parse *p, struct re_guts *g);
-static void computematchjumps(struct parse *p, struct re_guts *g);
+static int rarest(const char *s, int len);
+static void findlits(struct parse *p, struct re_guts *g);
+static int altlits(sop *och, int mccs, sop **starts, sopno *lens, int *offs);
+static sop *branchlit(sop *scan, int mccs, sopno *lenp, int *offp);
 static sopno pluscount(struct parse *p, struct re_guts *g);
 
 #ifdef __cplusplus
@@ -169,9 +172,6 @@ static int never = 0;		/* for use in asserts; shuts lint up */
 #define	never	0		/* some <assert.h>s have bugs too */
 #endif
 
-/* Macro used by computejump()/computematchjump() */
-#define MIN(a,b)	((a)<(b)?(a):(b))
-
 /*
  - regcomp - interface for parser and compilation
  = extern int regcomp(regex_t *__restrict, const char *__restrict, int);
@@ -245,14 +245,15 @@ int cflags;
 	g->neol = 0;
 	g->must = NULL;
 	g->moffset = -1;
-	g->charjump = NULL;
-	g->matchjump = NULL;
 	g->mlen = 0;
+	g->mrare = 0;
+	g->lits = NULL;
 	g->nsub = 0;
 	g->ncategories = 1;	/* category 0 is "everything else" */
 	g->categories = &g->catspace[-(CHAR_MIN)];
 	(void) memset((char *)g->catspace, 0, NC*sizeof(cat_t));
 	g->backrefs = 0;
+	g->dfa = NULL;
 
 	/* do it */
 	EMIT(OEND, 0);
@@ -270,18 +271,16 @@ int cflags;
 	categorize(p, g);
 	stripsnug(p, g);
 	findmust(p, g);
-	/* only use Boyer-Moore algorithm if the pattern is bigger
-	 * than three characters
-	 */
-	if(g->mlen > 3) {
-		computejumps(p, g);
-		computematchjumps(p, g);
-		if(g->matchjump == NULL && g->charjump != NULL) {
-			free(g->charjump);
-			g->charjump = NULL;
+	findlits(p, g);
+	g->nplus = pluscount(p, g);
+	/* room for regexec() to cache state sets in; it can do without */
+	if (!g->backrefs) {
+		g->dfa = (struct re_dfa *)malloc(sizeof(struct re_dfa));
+		if (g->dfa != NULL) {
+			(void) memset((char *)g->dfa, 0, sizeof(struct re_dfa));
+			__lock_init(g->dfa->lock);
 		}
 	}
-	g->nplus = pluscount(p, g);
 	g->magic = MAGIC2;
 	preg->re_nsub = g->nsub;
 	preg->re_g = g;
@@ -1842,11 +1841,16 @@ struct re_guts *g;
 	}
 	assert(cp == g->must + g->mlen);
 	*cp++ = '\0';		/* just on general principles */
+	g->mrare = rarest(g->must, g->mlen);
 }
 
 /*
  - altoffset - choose biggest offset among multiple choices
  == static int altoffset(sop *scan, int offset, int mccs);
+static int rarest(const char *s, int len);
+static void findlits(struct parse *p, struct re_guts *g);
+static int altlits(sop *och, int mccs, sop **starts, sopno *lens, int *offs);
+static sop *branchlit(sop *scan, int mccs, sopno *lenp, int *offp);
  *
  * Compute, recursively if necessary, the largest offset among multiple
  * re paths.
@@ -1921,132 +1925,286 @@ int mccs;
 }
 
 /*
- - computejumps - compute char jumps for BM scan
- == static void computejumps(struct parse *p, struct re_guts *g);
- *
- * This algorithm assumes g->must exists and is has size greater than
- * zero. It's based on the algorithm found on Computer Algorithms by
- * Sara Baase.
+ * Bytes roughly in order of how common they are in text, most common
+ * first; a byte not listed is taken to be rarer than any that is.
+ */
+static const char bytefreq[] =
+	" etaoinsrhldcumfpgwybvk0123456789.,:-/_=\n\tETAOINSRHLDCUMFPGWYBVKxjqzXJQZ";
+
+/*
+ - rarest - index of the byte of s least likely to turn up in text
+ == static int rarest(const char *s, int len);
+ */
+static int
+rarest(s, len)
+const char *s;
+int len;
+{
+	const char *f;
+	int i;
+	int rank;
+	int best = 0;
+	int bestrank = -1;
+
+	for (i = 0; i < len; i++) {
+		f = (s[i] == '\0') ? NULL : strchr(bytefreq, s[i]);
+		rank = (f == NULL) ? (int)sizeof(bytefreq) : f - bytefreq;
+		if (rank > bestrank) {
+			best = i;
+			bestrank = rank;
+		}
+	}
+	return(best);
+}
+
+/*
+ - findlits - fill in lits from an alternation every match goes through
+ == static void findlits(struct parse *p, struct re_guts *g);
  *
- * A char jump is the number of characters one needs to jump based on
- * the value of the character from the text that was mismatched.
+ * Only alternations outside any other, and not made optional, are looked
+ * at.  Each of the branches must have a mandatory literal of two or more
+ * characters; of the alternations that qualify, the one whose shortest
+ * literal is longest is taken.
  */
 static void
-computejumps(p, g)
+findlits(p, g)
 struct parse *p;
 struct re_guts *g;
 {
-	int ch;
-	int mindex;
+	sop *scan;
+	sop *best = NULL;
+	sop *starts[LITMAX];
+	sopno lens[LITMAX];
+	int offs[LITMAX];
+	sopno shortest;
+	sopno bestshortest = 1;
+	int bestoffset = -1;
+	int offset;
+	int n;
+	int i;
+	int cs, mccs;
+	size_t size;
+	struct re_lits *lits;
+	char *cp;
+	sop s;
 
-	/* Avoid making errors worse */
-	if (p->error != 0)
+	/* avoid making error situations worse */
+	if (p->error != 0 || (g->iflags&BAD))
 		return;
 
-	g->charjump = (int*) malloc((NC + 1) * sizeof(int));
-	if (g->charjump == NULL)	/* Not a fatal error */
+	mccs = 0;
+	for (cs = 0; cs < g->ncsets; cs++)
+		if (g->sets[cs].multis != NULL)
+			mccs = 1;
+
+	/* walk the top level, keeping track of how far in it may be */
+	offset = 0;
+	scan = g->strip + 1;
+	do {
+		s = *scan++;
+		switch (OP(s)) {
+		case OCH_:		/* a candidate */
+			n = altlits(scan - 1, mccs, starts, lens, offs);
+			shortest = 0;
+			for (i = 0; i < n; i++)
+				if (i == 0 || lens[i] < shortest)
+					shortest = lens[i];
+			if (n > 0 && shortest > bestshortest) {
+				best = scan - 1;
+				bestshortest = shortest;
+				bestoffset = offset;
+			}
+			/* fallthrough */
+		case OQUEST_:		/* things that must be skipped */
+			offset = altoffset(scan, offset, mccs);
+			scan--;
+			do {
+				scan += OPND(s);
+				s = *scan;
+				if (OP(s) != O_QUEST && OP(s) != O_CH &&
+							OP(s) != OOR2)
+					return;
+			} while (OP(s) != O_QUEST && OP(s) != O_CH);
+			scan++;
+			break;
+		case OANYOF:
+			if (mccs) {
+				offset = -1;
+				break;
+			}
+			/* fallthrough */
+		case OCHAR:
+		case OANY:
+			if (offset > -1)
+				offset++;
+			break;
+		case OPLUS_:		/* things that leave it alone */
+		case OLPAREN:
+		case ORPAREN:
+		case OBOW:
+		case OEOW:
+		case OBOL:
+		case OEOL:
+		case OEND:
+			break;
+		default:
+			offset = -1;
+			break;
+		}
+	} while (OP(s) != OEND);
+
+	if (best == NULL)
 		return;
-	/* Adjust for signed chars, if necessary */
-	g->charjump = &g->charjump[-(CHAR_MIN)];
-
-	/* If the character does not exist in the pattern, the jump
-	 * is equal to the number of characters in the pattern.
-	 */
-	for (ch = CHAR_MIN; ch < (CHAR_MAX + 1); ch++)
-		g->charjump[ch] = g->mlen;
-
-	/* If the character does exist, compute the jump that would
-	 * take us to the last character in the pattern equal to it
-	 * (notice that we match right to left, so that last character
-	 * is the first one that would be matched).
-	 */
-	for (mindex = 0; mindex < g->mlen; mindex++)
-		g->charjump[(unsigned char) g->must[mindex]] = g->mlen - mindex - 1;
+
+	/* turn its literals into character strings */
+	n = altlits(best, mccs, starts, lens, offs);
+	size = sizeof(struct re_lits);
+	for (i = 0; i < n; i++)
+		size += lens[i] + 1;
+	lits = (struct re_lits *)malloc(size);
+	if (lits == NULL)		/* no matter; do without */
+		return;
+	lits->n = n;
+	cp = lits->chars;
+	for (i = 0; i < n; i++) {
+		lits->lit[i].s = cp;
+		lits->lit[i].len = lens[i];
+		for (scan = starts[i]; cp < lits->lit[i].s + lens[i]; ) {
+			while (OP(s = *scan++) != OCHAR)
+				continue;
+			*cp++ = (char)OPND(s);
+		}
+		*cp++ = '\0';
+		lits->lit[i].rare = rarest(lits->lit[i].s, lens[i]);
+		if (bestoffset > -1 && offs[i] > -1)
+			lits->lit[i].offset = bestoffset + offs[i];
+		else
+			lits->lit[i].offset = -1;
+	}
+	g->lits = lits;
 }
 
 /*
- - computematchjumps - compute match jumps for BM scan
- == static void computematchjumps(struct parse *p, struct re_guts *g);
- *
- * This algorithm assumes g->must exists and is has size greater than
- * zero. It's based on the algorithm found on Computer Algorithms by
- * Sara Baase.
+ - altlits - find the mandatory literal of each branch of an alternation
+ == static int altlits(sop *och, int mccs, sop **starts, sopno *lens, \
+ ==	int *offs);
  *
- * A match jump is the number of characters one needs to advance based
- * on the already-matched suffix.
- * Notice that all values here are minus (g->mlen-1), because of the way
- * the search algorithm works.
+ * Returns how many branches there are, or 0 if there are more than
+ * LITMAX or one of them has no literal of two characters or more.
  */
-static void
-computematchjumps(p, g)
-struct parse *p;
-struct re_guts *g;
+static int
+altlits(och, mccs, starts, lens, offs)
+sop *och;
+int mccs;
+sop **starts;
+sopno *lens;
+int *offs;
 {
-	int mindex;		/* General "must" iterator */
-	int suffix;		/* Keeps track of matching suffix */
-	int ssuffix;		/* Keeps track of suffixes' suffix */
-	int* pmatches;		/* pmatches[k] points to the next i
-				 * such that i+1...mlen is a substring
-				 * of k+1...k+mlen-i-1
-				 */
-
-	/* Avoid making errors worse */
-	if (p->error != 0)
-		return;
+	sop *scan = och;
+	int n = 0;
 
-	pmatches = (int*) malloc(g->mlen * sizeof(unsigned int));
-	if (pmatches == NULL) {
-		g->matchjump = NULL;
-		return;
+	for (;;) {
+		if (n == LITMAX)
+			return(0);
+		starts[n] = branchlit(scan + 1, mccs, &lens[n], &offs[n]);
+		if (starts[n] == NULL || lens[n] < 2)
+			return(0);
+		n++;
+		scan += OPND(*scan);
+		if (OP(*scan) == O_CH)
+			return(n);
+		if (OP(*scan) != OOR2)
+			return(0);
 	}
+}
 
-	g->matchjump = (int*) malloc(g->mlen * sizeof(unsigned int));
-	if (g->matchjump == NULL)	/* Not a fatal error */
-		return;
+/*
+ - branchlit - find the longest mandatory literal of one branch
+ == static sop *branchlit(sop *scan, int mccs, sopno *lenp, int *offp);
+ *
+ * Fills in its length and the latest point in the branch at which it
+ * may be located, or -1 if that isn't known; returns where it is in the
+ * strip, or NULL if there is none.
+ */
+static sop *
+branchlit(scan, mccs, lenp, offp)
+sop *scan;
+int mccs;
+sopno *lenp;
+int *offp;
+{
+	sop *start = NULL;
+	sop *newstart = NULL;
+	sopno len = 0;
+	sopno newlen = 0;
+	int offset = 0;
+	int newoffset = 0;
+	sop s;
 
-	/* Set maximum possible jump for each character in the pattern */
-	for (mindex = 0; mindex < g->mlen; mindex++)
-		g->matchjump[mindex] = 2*g->mlen - mindex - 1;
+	for (;;) {
+		s = *scan++;
+		switch (OP(s)) {
+		case OCHAR:		/* sequence member */
+			if (newlen == 0) {
+				newstart = scan - 1;
+				newoffset = offset;
+			}
+			newlen++;
+			if (offset > -1)
+				offset++;
+			continue;
+		case OPLUS_:		/* things that don't break one */
+		case OLPAREN:
+		case ORPAREN:
+			continue;
+		}
 
-	/* Compute pmatches[] */
-	for (mindex = g->mlen - 1, suffix = g->mlen; mindex >= 0;
-	    mindex--, suffix--) {
-		pmatches[mindex] = suffix;
+		/* anything else ends a sequence */
+		if (newlen > len) {
+			start = newstart;
+			len = newlen;
+			*offp = newoffset;
+		}
+		newlen = 0;
 
-		/* If a mismatch is found, interrupting the substring,
-		 * compute the matchjump for that position. If no
-		 * mismatch is found, then a text substring mismatched
-		 * against the suffix will also mismatch against the
-		 * substring.
-		 */
-		while (suffix < g->mlen
-		    && g->must[mindex] != g->must[suffix]) {
-			g->matchjump[suffix] = MIN(g->matchjump[suffix],
-			    g->mlen - mindex - 1);
-			suffix = pmatches[suffix];
+		switch (OP(s)) {
+		case OQUEST_:		/* things that must be skipped */
+		case OCH_:
+			offset = altoffset(scan, offset, mccs);
+			scan--;
+			do {
+				scan += OPND(s);
+				s = *scan;
+				if (OP(s) != O_QUEST && OP(s) != O_CH &&
+							OP(s) != OOR2)
+					return(NULL);
+			} while (OP(s) != O_QUEST && OP(s) != O_CH);
+			scan++;
+			break;
+		case OANYOF:
+			if (mccs) {
+				offset = -1;
+				break;
+			}
+			/* fallthrough */
+		case OANY:
+			if (offset > -1)
+				offset++;
+			break;
+		case OBOW:
+		case OEOW:
+		case OBOL:
+		case OEOL:
+			break;
+		case OOR1:		/* the end of the branch */
+		case O_CH:
+			*lenp = len;
+			return(start);
+		default:
+			offset = -1;
+			break;
 		}
 	}
-
-	/* Compute the matchjump up to the last substring found to jump
-	 * to the beginning of the largest must pattern prefix matching
-	 * it's own suffix.
-	 */
-	for (mindex = 0; mindex <= suffix; mindex++)
-		g->matchjump[mindex] = MIN(g->matchjump[mindex],
-		    g->mlen + suffix - mindex);
-
-        ssuffix = pmatches[suffix];
-        while (suffix < g->mlen) {
-                while (suffix <= ssuffix && suffix < g->mlen) {
-                        g->matchjump[suffix] = MIN(g->matchjump[suffix],
-			    g->mlen + ssuffix - suffix);
-                        suffix++;
-                }
-		if (suffix < g->mlen)
-                	ssuffix = pmatches[ssuffix];
-        }
-
-	free(pmatches);
 }
 
 /*
@@ -162,16 +162,66 @@ struct re_guts {
 	cat_t *categories;	/* ->catspace[-CHAR_MIN] */
 	char *must;		/* match must contain this string */
 	int moffset;		/* latest point at which must may be located */
-	int *charjump;		/* Boyer-Moore char jump table */
-	int *matchjump;		/* Boyer-Moore match jump table */
 	int mlen;		/* length of must */
+	int mrare;		/* index in must of its rarest byte */
+	struct re_lits *lits;	/* one of these is in any match, or NULL */
 	size_t nsub;		/* copy of re_nsub */
 	int backrefs;		/* does it use back references? */
 	sopno nplus;		/* how deep does it nest +s? */
+	struct re_dfa *dfa;	/* regexec()'s cache of state sets, or NULL */
 	/* catspace must be last */
 	cat_t catspace[1];	/* actually [NC] */
 };
 
+/*
+ * Cache of the state sets the matcher goes through when no subexpression
+ * is wanted, so that a regex run over much text mostly looks transitions
+ * up rather than stepping through the strip for each character.  A
+ * dstate is a set of states together with what the assertions need to
+ * know of the character before it; next[c] is the dstate after byte c
+ * (DACCEPT if a match ends there), filled in as first needed.  All of
+ * it is thrown away when it outgrows DFAMEM.  One regexec() at a time
+ * uses the cache; others make do without.
+ */
+#define	DFAHASH	64		/* hash chains of dstates */
+#define	DFAMEM	(128*1024)	/* most bytes of dstates kept */
+struct re_dstate {
+	struct re_dstate *next[NC];	/* by byte, NULL if not yet known */
+	struct re_dstate *link;		/* next in its hash chain */
+	unsigned long hash;
+	int lastc;		/* stands for the character before */
+	int fresh;		/* the set is that of a fresh start */
+	char set[1];		/* actually [ssize] */
+};
+struct re_dfa {
+	_LOCK_T lock;
+	int busy;		/* a regexec() is using it */
+	size_t ssize;		/* bytes in a set of states */
+	size_t mem;		/* bytes of dstates */
+	unsigned long flushes;	/* times thrown away */
+	struct re_dstate *init[2];	/* at the start, without and with REG_NOTBOL */
+	struct re_dstate *hash[DFAHASH];
+};
+
+/*
+ * The literals of an alternation each of whose branches has one, so
+ * that every match contains at least one of them.  regexec() looks for
+ * each by its rarest byte before it starts the matcher, and starts the
+ * matcher no earlier than the first it finds allows.
+ */
+#define	LITMAX	8		/* most branches looked at */
+struct re_lit {
+	char *s;
+	int len;
+	int rare;		/* index in s of its rarest byte */
+	int offset;		/* latest point at which it may be located, or -1 */
+};
+struct re_lits {
+	int n;
+	struct re_lit lit[LITMAX];
+	char chars[1];		/* what the s point into */
+};
+
 /* misc utilities */
 #define	OUT	(CHAR_MAX+1)	/* a non-character value */
 #define ISWORD(c)       (isalnum((uch)(c)) || (c) == '_')
@@ -54,6 +54,7 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 #include <limits.h>
 #include <ctype.h>
 #include <regex.h>
+#include <sys/lock.h>
 
 #include "utils.h"
 #include "regex2.h"
@@ -62,6 +63,134 @@ static char sccsid[] = "@(#)regexec.c	8.3 (Berkeley) 3/20/94";
 static int nope = 0;		/* for use in asserts; shuts lint up */
 #endif
 
+/*
+ * The cache of state sets (see regex2.h), which works on them as bytes
+ * and so serves both representations.
+ */
+static char daccept;		/* its address stands for a match */
+#define	DACCEPT	((struct re_dstate *)&daccept)
+
+/* what the assertions need to know of a character that came before */
+#define	DLASTC(c)	((c) == '\n' ? '\n' : ISWORD(c) ? 'a' : ' ')
+
+/*
+ - dclaim - take g's cache for sets of ssize bytes, or NULL if it's busy
+ */
+static struct re_dfa *
+dclaim(g, ssize)
+struct re_guts *g;
+size_t ssize;
+{
+	struct re_dfa *d = g->dfa;
+
+	if (d == NULL)
+		return(NULL);
+	__lock_acquire(d->lock);
+	if (d->busy || (d->ssize != 0 && d->ssize != ssize)) {
+		__lock_release(d->lock);
+		return(NULL);
+	}
+	d->busy = 1;
+	d->ssize = ssize;
+	__lock_release(d->lock);
+	return(d);
+}
+
+/*
+ - drelease - give the cache back
+ */
+static void
+drelease(d)
+struct re_dfa *d;
+{
+	__lock_acquire(d->lock);
+	d->busy = 0;
+	__lock_release(d->lock);
+}
+
+/*
+ - dstate - find or make the dstate for a set of states after lastc
+ *
+ * Making one may throw away all the others, which the caller can tell
+ * from d->flushes.  Returns NULL if there is no memory for it.
+ */
+static struct re_dstate *
+dstate(d, set, fresh, lastc)
+struct re_dfa *d;
+char *set;			/* the set of states, as bytes */
+char *fresh;			/* that of a fresh start */
+int lastc;
+{
+	struct re_dstate *ds;
+	struct re_dstate *next;
+	unsigned long h = lastc;
+	size_t size;
+	size_t i;
+
+	for (i = 0; i < d->ssize; i++)
+		h = h*31 + (uch)set[i];
+	for (ds = d->hash[h%DFAHASH]; ds != NULL; ds = ds->link)
+		if (ds->hash == h && ds->lastc == lastc &&
+				memcmp(ds->set, set, d->ssize) == 0)
+			return(ds);
+
+	size = sizeof(struct re_dstate) - 1 + d->ssize;
+	if (d->mem + size > DFAMEM) {
+		for (i = 0; i < DFAHASH; i++) {
+			for (ds = d->hash[i]; ds != NULL; ds = next) {
+				next = ds->link;
+				free((char *)ds);
+			}
+			d->hash[i] = NULL;
+		}
+		d->init[0] = d->init[1] = NULL;
+		d->mem = 0;
+		d->flushes++;
+	}
+	ds = (struct re_dstate *)malloc(size);
+	if (ds == NULL)
+		return(NULL);
+	(void) memset((char *)ds->next, 0, sizeof(ds->next));
+	ds->hash = h;
+	ds->lastc = lastc;
+	ds->fresh = memcmp(set, fresh, d->ssize) == 0;
+	memcpy(ds->set, set, d->ssize);
+	ds->link = d->hash[h%DFAHASH];
+	d->hash[h%DFAHASH] = ds;
+	d->mem += size;
+	return(ds);
+}
+
+/*
+ - litscan - find where len bytes of lit first are in [start, stop)
+ *
+ * It is the rare'th of them that memchr() looks for, so that as few
+ * places as may be have to be compared.
+ */
+static char *
+litscan(lit, len, rare, start, stop)
+const char *lit;
+int len;
+int rare;
+char *start;
+char *stop;
+{
+	char *p;
+	char *last;
+
+	if (stop - start < len)
+		return(NULL);
+	last = stop - len + rare;	/* latest the rare byte can be */
+	for (p = start + rare; p <= last; p++) {
+		p = memchr(p, lit[rare], last - p + 1);
+		if (p == NULL)
+			return(NULL);
+		if (memcmp(p - rare, lit, len) == 0)
+			return(p - rare);
+	}
+	return(NULL);
+}
+
 /* macros for manipulating states, small version */
 #define	states	long
 #define	states1	states		/* for later use in regexec() decision */
@@ -84,6 +213,9 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) << (n))
 #define	BACK(dst, src, n)	((dst) |= ((unsigned long)(src)&(here)) >> (n))
 #define	ISSETBACK(v, n)	(((v) & ((unsigned long)here >> (n))) != 0)
+/* a set of states as bytes, for the cache */
+#define	STATEBYTES(v)	((char *)&(v))
+#define	STATESIZE	sizeof(long)
 /* function names */
 #define SNAMES			/* engine.c looks after details */
 
@@ -108,6 +240,8 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #undef	FWD
 #undef	BACK
 #undef	ISSETBACK
+#undef	STATEBYTES
+#undef	STATESIZE
 #undef	SNAMES
 
 /* macros for manipulating states, large version */
@@ -133,6 +267,9 @@ static int nope = 0;		/* for use in asserts; shuts lint up */
 #define	FWD(dst, src, n)	((dst)[here+(n)] |= (src)[here])
 #define	BACK(dst, src, n)	((dst)[here-(n)] |= (src)[here])
 #define	ISSETBACK(v, n)	((v)[here - (n)])
+/* a set of states as bytes, for the cache */
+#define	STATEBYTES(v)	(v)
+#define	STATESIZE	((size_t)m->g->nstates)
 /* function names */
 #define	LNAMES			/* flag */
 
@@ -45,6 +45,7 @@ static char sccsid[] = "@(#)regfree.c	8.3 (Berkeley) 3/20/94";
 #include <stdlib.h>
 #include <limits.h>
 #include <regex.h>
+#include <sys/lock.h>
 
 #include "utils.h"
 #include "regex2.h"
@@ -58,6 +59,9 @@ regfree(preg)
 regex_t *preg;
 {
 	struct re_guts *g;
+	struct re_dstate *ds;
+	struct re_dstate *next;
+	int i;
 
 	if (preg->re_magic != MAGIC1)	/* oops */
 		return;			/* nice to complain, but hard */
@@ -76,10 +80,17 @@ regex_t *preg;
 		free((char *)g->setbits);
 	if (g->must != NULL)
 		free(g->must);
-	if (g->charjump != NULL)
-		free(&g->charjump[CHAR_MIN]);
-	if (g->matchjump != NULL)
-		free(g->matchjump);
+	if (g->lits != NULL)
+		free((char *)g->lits);
+	if (g->dfa != NULL) {
+		for (i = 0; i < DFAHASH; i++)
+			for (ds = g->dfa->hash[i]; ds != NULL; ds = next) {
+				next = ds->link;
+				free((char *)ds);
+			}
+		__lock_close(g->dfa->lock);
+		free((char *)g->dfa);
+	}
 	free((char *)g);
 }
 
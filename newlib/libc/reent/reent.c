@@ -27,6 +27,12 @@ int errno;
 
 #endif
 
+#ifndef MALLOC_PROVIDED
+/* Weak, so that programs using another malloc don't pull in ours.  */
+extern void __malloc_tcache_release _PARAMS ((struct _reent *))
+  _ATTRIBUTE ((__weak__));
+#endif
+
 /* Interim cleanup code */
 
 void
@@ -130,6 +136,12 @@ _DEFUN (_reclaim_reent, (ptr),
 	    cleanup_glue (ptr, ptr->__sglue._next);
 	}
 
+#ifndef MALLOC_PROVIDED
+      /* Last, as the frees above may have filled the thread's cache. */
+      if (__malloc_tcache_release)
+	__malloc_tcache_release (ptr);
+#endif
+
       /* Malloc memory not reclaimed; no good way to return memory anyway. */
 
     }
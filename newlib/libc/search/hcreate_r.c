@@ -39,6 +39,14 @@
  *
  * I tried to look at Knuth (as cited by the Solaris manual page), but
  * nobody had a copy in the office, so...
+ *
+ * The table is open addressed in the style of a "Swiss table": a byte
+ * of control information per slot, holding either EMPTY or 7 bits of
+ * the key's hash, lets a whole group of slots be checked with a couple
+ * of vector instructions before any key is compared.  Each slot also
+ * keeps the full hash, so strcmp() is almost only ever called on the
+ * key being looked for.  The table doubles when it gets 7/8 full,
+ * whatever nel said.
  */
 
 #include <sys/cdefs.h>
@@ -49,141 +57,410 @@ __RCSID("$NetBSD: hcreate.c,v 1.2 2001/02/19 21:26:04 ross Exp $");
 #endif
 
 #include <sys/types.h>
-#include <sys/queue.h>
 #include <errno.h>
 #include <search.h>
 #include <stdlib.h>
 #include <string.h>
 
 /*
- * DO NOT MAKE THIS STRUCTURE LARGER THAN 32 BYTES (4 ptrs on 64-bit
- * ptr machine) without adjusting MAX_BUCKETS_LG2 below.
+ * Slots are probed a group at a time.  With SSE2 a group is 16 control
+ * bytes matched with pcmpeqb/pmovmskb; elsewhere it is 8 bytes matched
+ * with word-at-a-time arithmetic.
  */
-struct internal_entry {
-	SLIST_ENTRY(internal_entry) link;
-	ENTRY ent;
+#ifdef __SSE2__
+#define	GROUP_WIDTH	16
+typedef char group_t __attribute__ ((__vector_size__ (16)));
+typedef unsigned int bitmask_t;
+#else
+#define	GROUP_WIDTH	8
+typedef __uint64_t group_t;
+typedef __uint64_t bitmask_t;
+#endif
+
+#define	CTRL_EMPTY	0x80
+
+struct hslot {
+	size_t hash;
+	ENTRY *ent;
+};
+
+/* Entries live in blocks that never move, so ENTRY pointers handed
+   out by hsearch_r stay valid when the table grows.  */
+struct entry_block {
+	struct entry_block *next;
+	size_t nused, nalloc;
+	ENTRY ent[1];
+};
+
+struct internal_head {
+	struct hslot *slots;
+	unsigned char *ctrl;		/* htablesize bytes, after slots */
+	size_t growth_left;		/* inserts left before doubling */
+	size_t (*hash)(const char *, size_t);
+	struct entry_block *blocks;
 };
-SLIST_HEAD(internal_head, internal_entry);
 
 #define	MIN_BUCKETS_LG2	4
 #define	MIN_BUCKETS	(1 << MIN_BUCKETS_LG2)
 
-/*
- * max * sizeof internal_entry must fit into size_t.
- * assumes internal_entry is <= 32 (2^5) bytes.
- */
+/* max * (sizeof (struct hslot) + 1) must fit into size_t.  */
 #define	MAX_BUCKETS_LG2	(sizeof (size_t) * 8 - 1 - 5)
 #define	MAX_BUCKETS	((size_t)1 << MAX_BUCKETS_LG2)
 
 /* Default hash function, from db/hash/hash_func.c */
 extern __uint32_t (*__default_hash)(const void *, size_t);
 
+static size_t
+mix(__uint64_t h)
+{
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	h *= 0xc4ceb9fe1a85ec53ULL;
+	h ^= h >> 33;
+	return (size_t)h;
+}
+
+/*
+ * The BSD hash is a plain multiply-by-33 hash; finalize it so that the
+ * high bits used for the slot and the low bits used for the control
+ * byte both depend on every input byte.
+ */
+static size_t
+hash_bsd(const char *key, size_t len)
+{
+	return mix((*__default_hash)(key, len));
+}
+
+static __uint64_t
+mum(__uint64_t a, __uint64_t b)
+{
+#ifdef __SIZEOF_INT128__
+	unsigned __int128 r = (unsigned __int128)a * b;
+
+	return (__uint64_t)r ^ (__uint64_t)(r >> 64);
+#else
+	__uint64_t ha = a >> 32, hb = b >> 32, la = (__uint32_t)a,
+	    lb = (__uint32_t)b, rh, rm0, rm1, rl, lo, t;
+	int c;
+
+	rh = ha * hb;
+	rm0 = ha * lb;
+	rm1 = hb * la;
+	rl = la * lb;
+	t = rl + (rm0 << 32);
+	c = t < rl;
+	lo = t + (rm1 << 32);
+	c += lo < t;
+	return lo ^ (rh + (rm0 >> 32) + (rm1 >> 32) + c);
+#endif
+}
+
+static __uint64_t
+read64(const char *p)
+{
+	__uint64_t v;
+
+	memcpy(&v, p, sizeof v);
+	return v;
+}
+
+static __uint32_t
+read32(const char *p)
+{
+	__uint32_t v;
+
+	memcpy(&v, p, sizeof v);
+	return v;
+}
+
+/*
+ * A wyhash-style string hash: eight bytes per 64x64->128 bit multiply.
+ * Several times faster than the BSD hash on keys longer than a few
+ * bytes, and it needs no finalizer.
+ */
+static size_t
+hash_fast(const char *key, size_t len)
+{
+	static const __uint64_t k0 = 0xa0761d6478bd642fULL,
+	    k1 = 0xe7037ed1a0b428dbULL, k2 = 0x8ebc6af09c88c6e3ULL;
+	__uint64_t h = k0 ^ len, a;
+	size_t n = len;
+
+	for (; n > 16; n -= 16, key += 16)
+		h = mum(read64(key) ^ k1, read64(key + 8) ^ h);
+	if (n > 8) {
+		h = mum(read64(key) ^ k1, read64(key + n - 8) ^ h);
+	} else if (n >= 4) {
+		h = mum(read32(key) ^ k1, read32(key + n - 4) ^ h);
+	} else if (n > 0) {
+		a = ((__uint64_t)(unsigned char)key[0] << 16)
+		    | ((__uint64_t)(unsigned char)key[n >> 1] << 8)
+		    | (unsigned char)key[n - 1];
+		h = mum(a ^ k1, h);
+	}
+	return (size_t)mum(h ^ k2, len ^ k1);
+}
+
+/* Bitmask of the slots in the group at ctrl whose control byte is c.  */
+static bitmask_t
+group_match(const unsigned char *ctrl, unsigned char c)
+{
+#ifdef __SSE2__
+	group_t g;
+
+	memcpy(&g, ctrl, sizeof g);
+	return __builtin_ia32_pmovmskb128(
+	    (group_t)(g == (group_t){ c, c, c, c, c, c, c, c,
+	    c, c, c, c, c, c, c, c }));
+#else
+	static const __uint64_t lsbs = 0x0101010101010101ULL,
+	    msbs = 0x8080808080808080ULL;
+	group_t g, x;
+
+	memcpy(&g, ctrl, sizeof g);
+	x = g ^ (lsbs * c);
+	/* May report a false positive just above a real match; the
+	   caller's hash comparison weeds those out.  */
+	return (x - lsbs) & ~x & msbs;
+#endif
+}
+
+static bitmask_t
+group_empty(const unsigned char *ctrl)
+{
+#ifdef __SSE2__
+	group_t g;
+
+	memcpy(&g, ctrl, sizeof g);
+	return __builtin_ia32_pmovmskb128(g);
+#else
+	group_t g;
+
+	memcpy(&g, ctrl, sizeof g);
+	return g & 0x8080808080808080ULL;
+#endif
+}
+
+/* Slot index within a group of the lowest bit set in a nonzero mask.  */
+static unsigned int
+mask_first(bitmask_t m)
+{
+#ifdef __SSE2__
+	return __builtin_ctz(m);
+#else
+	/* Byte order of the group word follows memory order.  */
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return __builtin_clzll(m) >> 3;
+#else
+	return __builtin_ctzll(m) >> 3;
+#endif
+#endif
+}
+
+static bitmask_t
+mask_next(bitmask_t m)
+{
+#if !defined (__SSE2__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	return m & ~((bitmask_t)0x80 << (56 - 8 * mask_first(m)));
+#else
+	return m & (m - 1);
+#endif
+}
+
+/* Control byte for a hash: its low 7 bits.  The slot comes from the
+   remaining bits.  */
+#define	H2(h)	((unsigned char)((h) & 0x7f))
+#define	H1(h)	((h) >> 7)
+
+/* Index of the first empty slot on h's probe sequence.  */
+static size_t
+find_empty(const unsigned char *ctrl, size_t size, size_t h)
+{
+	size_t mask = size / GROUP_WIDTH - 1, g = H1(h) & mask, step = 0;
+	bitmask_t m;
+
+	while ((m = group_empty(ctrl + g * GROUP_WIDTH)) == 0)
+		g = (g + ++step) & mask;
+	return g * GROUP_WIDTH + mask_first(m);
+}
+
+/*
+ * Allocate slots and control bytes for a table of size slots, which must
+ * be a power of two no smaller than GROUP_WIDTH.
+ */
+static int
+table_alloc(struct internal_head *t, size_t size)
+{
+	t->slots = malloc(size * (sizeof t->slots[0] + 1));
+	if (t->slots == NULL)
+		return 0;
+	t->ctrl = (unsigned char *)(t->slots + size);
+	memset(t->ctrl, CTRL_EMPTY, size);
+	t->growth_left = size - size / 8;
+	return 1;
+}
+
+/* Double the table, rehashing every slot from its stored hash.  */
+static int
+table_grow(struct hsearch_data *htab)
+{
+	struct internal_head *t = htab->htable;
+	struct hslot *oslots = t->slots;
+	unsigned char *octrl = t->ctrl;
+	size_t osize = htab->htablesize, i, j, used;
+
+	if (osize >= MAX_BUCKETS || !table_alloc(t, osize * 2)) {
+		t->slots = oslots;
+		t->ctrl = octrl;
+		return 0;
+	}
+	htab->htablesize = osize * 2;
+	used = 0;
+	for (i = 0; i < osize; i++) {
+		if (octrl[i] & CTRL_EMPTY)
+			continue;
+		j = find_empty(t->ctrl, htab->htablesize, oslots[i].hash);
+		t->ctrl[j] = octrl[i];
+		t->slots[j] = oslots[i];
+		used++;
+	}
+	t->growth_left -= used;
+	free(oslots);
+	return 1;
+}
+
+static ENTRY *
+entry_alloc(struct internal_head *t, size_t hint)
+{
+	struct entry_block *b = t->blocks;
+
+	if (b == NULL || b->nused == b->nalloc) {
+		if (hint < MIN_BUCKETS)
+			hint = MIN_BUCKETS;
+		b = malloc(sizeof *b + (hint - 1) * sizeof b->ent[0]);
+		if (b == NULL)
+			return NULL;
+		b->next = t->blocks;
+		b->nused = 0;
+		b->nalloc = hint;
+		t->blocks = b;
+	}
+	return &b->ent[b->nused++];
+}
+
 int
-hcreate_r(size_t nel, struct hsearch_data *htab)
+hcreate_hash_r(size_t nel, int hashtype, struct hsearch_data *htab)
 {
-	size_t idx;
-	unsigned int p2;
+	struct internal_head *t;
+	size_t size;
 
 	/* Make sure this this isn't called when a table already exists. */
 	if (htab->htable != NULL) {
 		errno = EINVAL;
 		return 0;
 	}
+	if (hashtype != HSEARCH_HASH_BSD && hashtype != HSEARCH_HASH_FAST) {
+		errno = EINVAL;
+		return 0;
+	}
 
-	/* If nel is too small, make it min sized. */
-	if (nel < MIN_BUCKETS)
-		nel = MIN_BUCKETS;
-
-	/* If it's too large, cap it. */
-	if (nel > MAX_BUCKETS)
-		nel = MAX_BUCKETS;
+	/* Leave room for nel entries below the 7/8 load limit, rounded up
+	   to a power of two and capped.  */
+	if (nel > MAX_BUCKETS / 8 * 7)
+		nel = MAX_BUCKETS / 8 * 7;
+	for (size = MIN_BUCKETS; size - size / 8 < nel; size <<= 1)
+		;
 
-	/* If it's is not a power of two in size, round up. */
-	if ((nel & (nel - 1)) != 0) {
-		for (p2 = 0; nel != 0; p2++)
-			nel >>= 1;
-		nel = 1 << p2;
-	}
-	
-	/* Allocate the table. */
-	htab->htablesize = nel;
-	htab->htable = malloc(htab->htablesize * sizeof htab->htable[0]);
-	if (htab->htable == NULL) {
+	t = malloc(sizeof *t);
+	if (t == NULL || !table_alloc(t, size)) {
+		free(t);
 		errno = ENOMEM;
 		return 0;
 	}
-
-	/* Initialize it. */
-	for (idx = 0; idx < htab->htablesize; idx++)
-		SLIST_INIT(&(htab->htable[idx]));
-
+	t->hash = hashtype == HSEARCH_HASH_FAST ? hash_fast : hash_bsd;
+	t->blocks = NULL;
+	htab->htable = t;
+	htab->htablesize = size;
 	return 1;
 }
 
+int
+hcreate_r(size_t nel, struct hsearch_data *htab)
+{
+	return hcreate_hash_r(nel, HSEARCH_HASH_BSD, htab);
+}
+
 void
 hdestroy_r(struct hsearch_data *htab)
 {
-#if 0
-	struct internal_entry *ie;
-	size_t idx;
-#endif
-	if (htab->htable == NULL)
+	struct internal_head *t = htab->htable;
+	struct entry_block *b;
+
+	if (t == NULL)
 		return;
 
-#if 0
-	for (idx = 0; idx < htab->htablesize; idx++) {
-		while (!SLIST_EMPTY(&(htab->htable[idx]))) {
-			ie = SLIST_FIRST(&(htab->htable[idx]));
-			SLIST_REMOVE_HEAD(&(htab->htable[idx]), link);
-                        free(ie->ent.key);
-			free(ie);
-		}
+	/* Keys belong to the caller; only our own storage is freed.  */
+	while ((b = t->blocks) != NULL) {
+		t->blocks = b->next;
+		free(b);
 	}
-#endif
-	free(htab->htable);
+	free(t->slots);
+	free(t);
 	htab->htable = NULL;
 }
 
 int
 hsearch_r(ENTRY item, ACTION action, ENTRY **retval, struct hsearch_data *htab)
 {
-	struct internal_head *head;
-	struct internal_entry *ie;
-	__uint32_t hashval;
-	size_t len;
+	struct internal_head *t = htab->htable;
+	const unsigned char *ctrl = t->ctrl;
+	size_t h, mask, g, step, i;
+	unsigned char h2;
+	bitmask_t m;
+	ENTRY *ie;
 
-	len = strlen(item.key);
-	hashval = (*__default_hash)(item.key, len);
-
-        head = &(htab->htable[hashval & (htab->htablesize - 1)]);
-	ie = SLIST_FIRST(head);
-	while (ie != NULL) {
-		if (strcmp(ie->ent.key, item.key) == 0)
+	h = (*t->hash)(item.key, strlen(item.key));
+	h2 = H2(h);
+	mask = htab->htablesize / GROUP_WIDTH - 1;
+	for (g = H1(h) & mask, step = 0;; g = (g + ++step) & mask) {
+		for (m = group_match(ctrl + g * GROUP_WIDTH, h2); m != 0;
+		    m = mask_next(m)) {
+			i = g * GROUP_WIDTH + mask_first(m);
+			if (t->slots[i].hash == h
+			    && strcmp(t->slots[i].ent->key, item.key) == 0) {
+				*retval = t->slots[i].ent;
+				return 1;
+			}
+		}
+		if (group_empty(ctrl + g * GROUP_WIDTH) != 0)
 			break;
-		ie = SLIST_NEXT(ie, link);
 	}
 
-	if (ie != NULL)
-          {
-            *retval = &ie->ent;
-            return 1;
-          }
-	else if (action == FIND)
-          {
-            *retval = NULL;
-            return 0;
-          }
-
-	ie = malloc(sizeof *ie);
-	if (ie == NULL)
-          {
-            *retval = NULL;
-            return 0;
-          }
-	ie->ent.key = item.key;
-	ie->ent.data = item.data;
-
-	SLIST_INSERT_HEAD(head, ie, link);
-        *retval = &ie->ent;
+	if (action == FIND) {
+		*retval = NULL;
+		return 0;
+	}
+
+	if (t->growth_left == 0 && !table_grow(htab)) {
+		*retval = NULL;
+		errno = ENOMEM;
+		return 0;
+	}
+	ie = entry_alloc(t, htab->htablesize / 4);
+	if (ie == NULL) {
+		*retval = NULL;
+		errno = ENOMEM;
+		return 0;
+	}
+	ie->key = item.key;
+	ie->data = item.data;
+
+	i = find_empty(t->ctrl, htab->htablesize, h);
+	t->ctrl[i] = h2;
+	t->slots[i].hash = h;
+	t->slots[i].ent = ie;
+	t->growth_left--;
+	*retval = ie;
 	return 1;
 }
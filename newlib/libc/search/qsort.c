@@ -34,6 +34,11 @@ the first argument is greater than the second (where ``less than'' and
 The array is sorted in place; that is, when <<qsort>> returns, the
 array elements beginning at <[base]> have been reordered.
 
+The sort is not stable.  It is an introsort in the style of
+pattern-defeating quicksort: at most O(<[nmemb]> log <[nmemb]>)
+comparisons in the worst case, and linear time on input that is already
+sorted or reversed.
+
 RETURNS
 <<qsort>> does not return a result.
 
@@ -72,6 +77,7 @@ PORTABILITY
 
 #include <_ansi.h>
 #include <sys/cdefs.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #ifndef __GNUC__
@@ -85,50 +91,100 @@ typedef int		 cmp_t(const void *, const void *, void *);
 #else
 typedef int		 cmp_t(const void *, const void *);
 #endif
-static inline char	*med3 _PARAMS((char *, char *, char *, cmp_t *, void *));
-static inline void	 swapfunc _PARAMS((char *, char *, int, int));
 
-#define min(a, b)	(a) < (b) ? a : b
+/*
+ * Pattern-defeating quicksort, after Orson Peters' pdqsort: median-of-3
+ * or Tukey's ninther pivots, block partitioning from Edelkamp and Weiss'
+ * "BlockQuicksort: How Branch Mispredictions don't affect Quicksort", a
+ * separate partition for runs of keys equal to an earlier pivot, and a
+ * heapsort fallback once too many partitions came out unbalanced, which
+ * bounds the worst case to O(n log n).
+ *
+ * The pivot stays in the first slot of the range while it is partitioned,
+ * so no element ever has to be copied out of the array.  All scans are
+ * bounded by the ends of the range, so a comparison function that is not
+ * a consistent ordering gives a wrong order but never a stray access.
+ *
+ * This file is built once for each of qsort, qsort_r and __bsd_qsort_r,
+ * which differ only in how the comparison function is called.
+ */
+
+#define INSERTION_THRESHOLD	16	/* Insertion sort below this.  */
+#define NINTHER_THRESHOLD	128	/* Ninther pivot above this.  */
+#define PARTIAL_INSERTION_LIMIT	8	/* Moves before giving up.  */
+#define BLOCK_SIZE		64	/* Must fit the offsets in a char.  */
 
 /*
- * Qsort routine from Bentley & McIlroy's "Engineering a Sort Function".
+ * Elements are exchanged with the widest type the size and alignment of
+ * the array allow; the common element sizes take one load and one store
+ * per half.
  */
+#define SWAP_INT	0		/* es == sizeof (int) */
+#define SWAP_LONG	1		/* es == sizeof (long) */
+#define SWAP_LONG2	2		/* es == 2 * sizeof (long) */
+#define SWAP_WORDS	3		/* es is a multiple of sizeof (long) */
+#define SWAP_BYTES	4
+
 #define swapcode(TYPE, parmi, parmj, n) { 		\
 	long i = (n) / sizeof (TYPE); 			\
-	TYPE *pi = (TYPE *) (parmi); 		\
-	TYPE *pj = (TYPE *) (parmj); 		\
+	TYPE *pi = (TYPE *) (parmi); 			\
+	TYPE *pj = (TYPE *) (parmj); 			\
 	do { 						\
-		TYPE	t = *pi;		\
+		TYPE	t = *pi;			\
 		*pi++ = *pj;				\
 		*pj++ = t;				\
         } while (--i > 0);				\
 }
 
-#define SWAPINIT(a, es) swaptype = ((char *)a - (char *)0) % sizeof(long) || \
-	es % sizeof(long) ? 2 : es == sizeof(long)? 0 : 1;
+static inline int
+swapinit (char *a, size_t es)
+{
+	if (((uintptr_t)a | es) % sizeof(long) == 0) {
+		if (es == sizeof(long))
+			return SWAP_LONG;
+		if (es == 2 * sizeof(long))
+			return SWAP_LONG2;
+		return SWAP_WORDS;
+	}
+	if (es == sizeof(int) && (uintptr_t)a % sizeof(int) == 0)
+		return SWAP_INT;
+	return SWAP_BYTES;
+}
 
 static inline void
-_DEFUN(swapfunc, (a, b, n, swaptype),
-	char *a _AND
-	char *b _AND
-	int n _AND
-	int swaptype)
+swapfunc (char *a, char *b, size_t es, int swaptype)
 {
-	if(swaptype <= 1)
-		swapcode(long, a, b, n)
-	else
-		swapcode(char, a, b, n)
+	switch (swaptype) {
+	case SWAP_INT: {
+		int t = *(int *)a;
+		*(int *)a = *(int *)b;
+		*(int *)b = t;
+		break;
+	}
+	case SWAP_LONG: {
+		long t = *(long *)a;
+		*(long *)a = *(long *)b;
+		*(long *)b = t;
+		break;
+	}
+	case SWAP_LONG2: {
+		long t0 = ((long *)a)[0], t1 = ((long *)a)[1];
+		((long *)a)[0] = ((long *)b)[0];
+		((long *)a)[1] = ((long *)b)[1];
+		((long *)b)[0] = t0;
+		((long *)b)[1] = t1;
+		break;
+	}
+	case SWAP_WORDS:
+		swapcode(long, a, b, es)
+		break;
+	default:
+		swapcode(char, a, b, es)
+		break;
+	}
 }
 
-#define swap(a, b)					\
-	if (swaptype == 0) {				\
-		long t = *(long *)(a);			\
-		*(long *)(a) = *(long *)(b);		\
-		*(long *)(b) = t;			\
-	} else						\
-		swapfunc(a, b, es, swaptype)
-
-#define vecswap(a, b, n) 	if ((n) > 0) swapfunc(a, b, n, swaptype)
+#define swap(a, b)	swapfunc(a, b, es, swaptype)
 
 #if defined(I_AM_QSORT_R)
 #define	CMP(t, x, y) (cmp((t), (x), (y)))
@@ -138,21 +194,309 @@ _DEFUN(swapfunc, (a, b, n, swaptype),
 #define	CMP(t, x, y) (cmp((x), (y)))
 #endif
 
-static inline char *
-_DEFUN(med3, (a, b, c, cmp, thunk),
-	char *a _AND
-	char *b _AND
-	char *c _AND
-	cmp_t *cmp _AND
-	void *thunk
-#if !defined(I_AM_QSORT_R) && !defined(I_AM_GNU_QSORT_R)
-__unused
-#endif
-)
+/* The parameters every helper takes, and the arguments to pass them.  */
+#define SORT_PARAMS	size_t es, int swaptype, cmp_t *cmp, void *thunk
+#define SORT_ARGS	es, swaptype, cmp, thunk
+
+static void
+insertion_sort (char *a, size_t n, SORT_PARAMS)
 {
-	return CMP(thunk, a, b) < 0 ?
-	       (CMP(thunk, b, c) < 0 ? b : (CMP(thunk, a, c) < 0 ? c : a ))
-              :(CMP(thunk, b, c) > 0 ? b : (CMP(thunk, a, c) < 0 ? a : c ));
+	char *pm, *pl;
+
+	for (pm = a + es; pm < a + n * es; pm += es)
+		for (pl = pm; pl > a && CMP(thunk, pl - es, pl) > 0;
+		     pl -= es)
+			swap(pl, pl - es);
+}
+
+/*
+ * Insertion sort that gives up, returning 0, once more than
+ * PARTIAL_INSERTION_LIMIT elements had to be moved.  Used to finish
+ * ranges that partitioning suggests are nearly sorted already.
+ */
+static int
+partial_insertion_sort (char *a, size_t n, SORT_PARAMS)
+{
+	char *pm, *pl;
+	size_t moved = 0;
+
+	for (pm = a + es; pm < a + n * es; pm += es) {
+		for (pl = pm; pl > a && CMP(thunk, pl - es, pl) > 0;
+		     pl -= es) {
+			swap(pl, pl - es);
+			moved++;
+		}
+		if (moved > PARTIAL_INSERTION_LIMIT)
+			return 0;
+	}
+	return 1;
+}
+
+static void
+siftdown (char *a, size_t root, size_t n, SORT_PARAMS)
+{
+	size_t child;
+
+	while ((child = 2 * root + 1) < n) {
+		if (child + 1 < n &&
+		    CMP(thunk, a + child * es, a + (child + 1) * es) < 0)
+			child++;
+		if (CMP(thunk, a + root * es, a + child * es) >= 0)
+			return;
+		swap(a + root * es, a + child * es);
+		root = child;
+	}
+}
+
+static void
+heap_sort (char *a, size_t n, SORT_PARAMS)
+{
+	size_t i;
+
+	for (i = n / 2; i > 0; i--)
+		siftdown(a, i - 1, n, SORT_ARGS);
+	for (i = n - 1; i > 0; i--) {
+		swap(a, a + i * es);
+		siftdown(a, 0, i, SORT_ARGS);
+	}
+}
+
+static inline void
+sort2 (char *a, char *b, SORT_PARAMS)
+{
+	if (CMP(thunk, b, a) < 0)
+		swap(a, b);
+}
+
+static inline void
+sort3 (char *a, char *b, char *c, SORT_PARAMS)
+{
+	sort2(a, b, SORT_ARGS);
+	sort2(b, c, SORT_ARGS);
+	sort2(a, b, SORT_ARGS);
+}
+
+/*
+ * Partition a[1..n) around the pivot in a[0] into elements that compare
+ * less than it followed by the rest, then move the pivot between the two.
+ * Return the pivot's new index and set *already if no element had to be
+ * moved.
+ */
+static size_t
+partition_right (char *a, size_t n, SORT_PARAMS, int *already)
+{
+	unsigned char offsets_l[BLOCK_SIZE], offsets_r[BLOCK_SIZE];
+	char *first = a, *last = a + n * es, *base_l, *base_r;
+	size_t num_l, num_r, start_l, start_r, num, i;
+	size_t num_unknown, left_split, right_split;
+
+	do
+		first += es;
+	while (first < last && CMP(thunk, first, a) < 0);
+	while (first < last) {
+		last -= es;
+		if (CMP(thunk, last, a) < 0)
+			break;
+	}
+
+	*already = first >= last;
+	if (!*already) {
+		swap(first, last);
+		first += es;
+
+		/*
+		 * Classify a block of elements from each end, recording
+		 * the offsets of those on the wrong side, then swap them
+		 * pairwise.  The comparison results are only ever added
+		 * to counters, so the scan has no data dependent branches.
+		 */
+		base_l = first;
+		base_r = last;
+		num_l = num_r = start_l = start_r = 0;
+		while (first < last) {
+			num_unknown = (last - first) / es;
+			left_split = num_l == 0 ?
+			    (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+			right_split = num_r == 0 ? num_unknown - left_split : 0;
+			if (left_split > BLOCK_SIZE)
+				left_split = BLOCK_SIZE;
+			if (right_split > BLOCK_SIZE)
+				right_split = BLOCK_SIZE;
+
+			for (i = 0; i < left_split; i++) {
+				offsets_l[num_l] = i;
+				num_l += CMP(thunk, first, a) >= 0;
+				first += es;
+			}
+			for (i = 0; i < right_split; ) {
+				offsets_r[num_r] = ++i;
+				last -= es;
+				num_r += CMP(thunk, last, a) < 0;
+			}
+
+			num = num_l < num_r ? num_l : num_r;
+			for (i = 0; i < num; i++)
+				swap(base_l + offsets_l[start_l + i] * es,
+				     base_r - offsets_r[start_r + i] * es);
+			num_l -= num;
+			num_r -= num;
+			start_l += num;
+			start_r += num;
+			if (num_l == 0) {
+				start_l = 0;
+				base_l = first;
+			}
+			if (num_r == 0) {
+				start_r = 0;
+				base_r = last;
+			}
+		}
+
+		/* At most one side has misplaced elements left over.  */
+		if (num_l) {
+			while (num_l--) {
+				last -= es;
+				swap(base_l + offsets_l[start_l + num_l] * es,
+				     last);
+			}
+			first = last;
+		}
+		if (num_r) {
+			while (num_r--) {
+				swap(base_r - offsets_r[start_r + num_r] * es,
+				     first);
+				first += es;
+			}
+		}
+	}
+
+	first -= es;
+	swap(a, first);
+	return (first - a) / es;
+}
+
+/*
+ * Partition a[1..n) around the pivot in a[0] into elements that compare
+ * less or equal followed by the greater ones.  Used when the pivot equals
+ * the element before the range, so the equal keys can be left out of
+ * further recursion.  Return the pivot's new index.
+ */
+static size_t
+partition_left (char *a, size_t n, SORT_PARAMS)
+{
+	char *first = a, *last = a + n * es, *end = last;
+
+	do
+		last -= es;
+	while (last > a && CMP(thunk, a, last) < 0);
+	do
+		first += es;
+	while (first < last && CMP(thunk, a, first) >= 0);
+
+	while (first < last) {
+		swap(first, last);
+		do
+			last -= es;
+		while (last > a && CMP(thunk, a, last) < 0);
+		do
+			first += es;
+		while (first < end && CMP(thunk, a, first) >= 0);
+	}
+
+	swap(a, last);
+	return (last - a) / es;
+}
+
+static void
+pdqsort (char *a, size_t n, SORT_PARAMS, int bad_allowed, int leftmost)
+{
+	size_t s2, l_size, r_size, p, q;
+	char *end, *pp;
+	int already;
+
+	for (;;) {
+		if (n < INSERTION_THRESHOLD) {
+			insertion_sort(a, n, SORT_ARGS);
+			return;
+		}
+
+		end = a + n * es;
+		s2 = n / 2;
+		if (n > NINTHER_THRESHOLD) {
+			sort3(a, a + s2 * es, end - es, SORT_ARGS);
+			sort3(a + es, a + (s2 - 1) * es, end - 2 * es,
+			      SORT_ARGS);
+			sort3(a + 2 * es, a + (s2 + 1) * es, end - 3 * es,
+			      SORT_ARGS);
+			sort3(a + (s2 - 1) * es, a + s2 * es,
+			      a + (s2 + 1) * es, SORT_ARGS);
+			swap(a, a + s2 * es);
+		} else
+			sort3(a + s2 * es, a, end - es, SORT_ARGS);
+
+		/*
+		 * If the pivot equals the element just before this range
+		 * (which is no greater than anything in it), every key equal
+		 * to the pivot is already in its final place once moved left.
+		 */
+		if (!leftmost && CMP(thunk, a - es, a) >= 0) {
+			p = partition_left(a, n, SORT_ARGS) + 1;
+			a += p * es;
+			n -= p;
+			continue;
+		}
+
+		p = partition_right(a, n, SORT_ARGS, &already);
+		pp = a + p * es;
+		l_size = p;
+		r_size = n - p - 1;
+
+		if (l_size < n / 8 || r_size < n / 8) {
+			/* Too many bad pivots: the input is adversarial.  */
+			if (--bad_allowed == 0) {
+				heap_sort(a, n, SORT_ARGS);
+				return;
+			}
+
+			/* Break up patterns that caused the imbalance.  */
+			if (l_size >= INSERTION_THRESHOLD) {
+				q = l_size / 4;
+				swap(a, a + q * es);
+				swap(pp - es, pp - q * es);
+				if (l_size > NINTHER_THRESHOLD) {
+					swap(a + es, a + (q + 1) * es);
+					swap(a + 2 * es, a + (q + 2) * es);
+					swap(pp - 2 * es, pp - (q + 1) * es);
+					swap(pp - 3 * es, pp - (q + 2) * es);
+				}
+			}
+			if (r_size >= INSERTION_THRESHOLD) {
+				q = r_size / 4;
+				swap(pp + es, pp + (q + 1) * es);
+				swap(end - es, end - q * es);
+				if (r_size > NINTHER_THRESHOLD) {
+					swap(pp + 2 * es, pp + (q + 2) * es);
+					swap(pp + 3 * es, pp + (q + 3) * es);
+					swap(end - 2 * es, end - (q + 1) * es);
+					swap(end - 3 * es, end - (q + 2) * es);
+				}
+			}
+		} else if (already &&
+			   partial_insertion_sort(a, l_size, SORT_ARGS) &&
+			   partial_insertion_sort(pp + es, r_size, SORT_ARGS))
+			return;
+
+		/* Recurse into the smaller side to bound the stack depth.  */
+		if (l_size < r_size) {
+			pdqsort(a, l_size, SORT_ARGS, bad_allowed, leftmost);
+			a = pp + es;
+			n = r_size;
+			leftmost = 0;
+		} else {
+			pdqsort(pp + es, r_size, SORT_ARGS, bad_allowed, 0);
+			n = l_size;
+		}
+	}
 }
 
 #if defined(I_AM_QSORT_R)
@@ -172,7 +516,6 @@ _DEFUN(qsort_r, (a, n, es, cmp, thunk),
 	cmp_t *cmp _AND
 	void *thunk)
 #else
-#define thunk NULL
 void
 _DEFUN(qsort, (a, n, es, cmp),
 	void *a _AND
@@ -181,86 +524,18 @@ _DEFUN(qsort, (a, n, es, cmp),
 	cmp_t *cmp)
 #endif
 {
-	char *pa, *pb, *pc, *pd, *pl, *pm, *pn;
-	size_t d, r;
-	int cmp_result;
-	int swaptype, swap_cnt;
-
-loop:	SWAPINIT(a, es);
-	swap_cnt = 0;
-	if (n < 7) {
-		for (pm = (char *) a + es; pm < (char *) a + n * es; pm += es)
-			for (pl = pm; pl > (char *) a && CMP(thunk, pl - es, pl) > 0;
-			     pl -= es)
-				swap(pl, pl - es);
-		return;
-	}
-	pm = (char *) a + (n / 2) * es;
-	if (n > 7) {
-		pl = a;
-		pn = (char *) a + (n - 1) * es;
-		if (n > 40) {
-			d = (n / 8) * es;
-			pl = med3(pl, pl + d, pl + 2 * d, cmp, thunk);
-			pm = med3(pm - d, pm, pm + d, cmp, thunk);
-			pn = med3(pn - 2 * d, pn - d, pn, cmp, thunk);
-		}
-		pm = med3(pl, pm, pn, cmp, thunk);
-	}
-	swap(a, pm);
-	pa = pb = (char *) a + es;
+#if !defined(I_AM_QSORT_R) && !defined(I_AM_GNU_QSORT_R)
+	void *thunk = NULL;
+#endif
+	int bad_allowed;
+	size_t i;
 
-	pc = pd = (char *) a + (n - 1) * es;
-	for (;;) {
-		while (pb <= pc && (cmp_result = CMP(thunk, pb, a)) <= 0) {
-			if (cmp_result == 0) {
-				swap_cnt = 1;
-				swap(pa, pb);
-				pa += es;
-			}
-			pb += es;
-		}
-		while (pb <= pc && (cmp_result = CMP(thunk, pc, a)) >= 0) {
-			if (cmp_result == 0) {
-				swap_cnt = 1;
-				swap(pc, pd);
-				pd -= es;
-			}
-			pc -= es;
-		}
-		if (pb > pc)
-			break;
-		swap(pb, pc);
-		swap_cnt = 1;
-		pb += es;
-		pc -= es;
-	}
-	if (swap_cnt == 0) {  /* Switch to insertion sort */
-		for (pm = (char *) a + es; pm < (char *) a + n * es; pm += es)
-			for (pl = pm; pl > (char *) a && CMP(thunk, pl - es, pl) > 0;
-			     pl -= es)
-				swap(pl, pl - es);
+	if (n < 2 || es == 0)
 		return;
-	}
 
-	pn = (char *) a + n * es;
-	r = min(pa - (char *)a, pb - pa);
-	vecswap(a, pb - r, r);
-	r = min(pd - pc, pn - pd - es);
-	vecswap(pb, pn - r, r);
-	if ((r = pb - pa) > es)
-#if defined(I_AM_QSORT_R)
-		__bsd_qsort_r(a, r / es, es, thunk, cmp);
-#elif defined(I_AM_GNU_QSORT_R)
-		qsort_r(a, r / es, es, cmp, thunk);
-#else
-		qsort(a, r / es, es, cmp);
-#endif
-	if ((r = pd - pc) > es) {
-		/* Iterate rather than recurse to save stack space */
-		a = pn - r;
-		n = r / es;
-		goto loop;
-	}
-/*		qsort(pn - r, r / es, es, cmp);*/
+	/* Allow log2 (n) unbalanced partitions before heapsort.  */
+	for (bad_allowed = 0, i = n; i > 0; i >>= 1)
+		bad_allowed++;
+
+	pdqsort(a, n, es, swapinit(a, es), cmp, thunk, bad_allowed, 1);
 }
@@ -0,0 +1,392 @@
+/*
+FUNCTION
+<<qsort_mt>>, <<qsort_mt_stable>>---sort an array using several threads
+
+INDEX
+	qsort_mt
+INDEX
+	qsort_mt_stable
+
+ANSI_SYNOPSIS
+	#include <stdlib.h>
+	void qsort_mt(void *<[base]>, size_t <[nmemb]>, size_t <[size]>,
+		      int (*<[compar]>)(const void *, const void *),
+		      int <[nthreads]>);
+	int qsort_mt_stable(void *<[base]>, size_t <[nmemb]>, size_t <[size]>,
+			    int (*<[compar]>)(const void *, const void *),
+			    int <[nthreads]>);
+
+DESCRIPTION
+<<qsort_mt>> sorts an array in the same way as <<qsort>>, but may
+use up to <[nthreads]> threads (including the calling thread) to do
+so.  The array is cut into one run per thread, the runs are sorted
+concurrently with <<qsort>>, and the sorted runs are then merged
+pairwise, each merge itself being split across the available threads.
+
+<<qsort_mt_stable>> is the same, except that the sort is stable:
+elements that compare equal keep their original relative order.
+
+Arrays too small to be worth splitting (fewer than 32768 elements per
+thread), and calls with <[nthreads]> less than 2, are sorted on the
+calling thread alone.  The merge phase needs a temporary copy of the
+array; if that cannot be allocated, <<qsort_mt>> falls back to a
+sequential <<qsort>>.  On targets without POSIX threads both functions
+always sort on the calling thread.
+
+<[compar]> may be called concurrently from several threads, so it must
+not modify shared state.
+
+RETURNS
+<<qsort_mt>> does not return a result.
+
+<<qsort_mt_stable>> returns <<0>> on success.  If it cannot allocate
+its work area, it returns <<-1>> with <<errno>> set to <<ENOMEM>> and
+leaves the array unchanged.
+
+PORTABILITY
+<<qsort_mt>> and <<qsort_mt_stable>> are newlib extensions.
+*/
+
+#include <_ansi.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/features.h>
+#ifdef _POSIX_THREADS
+#include <pthread.h>
+#endif
+
+typedef int		 cmp_t(const void *, const void *);
+
+/* Below this many elements per thread a run is cheaper to sort than to
+   hand to a new thread.  */
+#define MT_MIN_PER_THREAD	32768
+#define MT_MAX_THREADS		64
+
+/* Runs this short are insertion sorted by the stable merge sort.  */
+#define MERGE_INSERTION		8
+
+enum { TASK_SORT, TASK_STABLE_SORT, TASK_MERGE, TASK_COPY };
+
+struct sort_task {
+	int kind;
+	size_t es;
+	cmp_t *cmp;
+	char *a;		/* SORT, COPY: the range; MERGE: left run */
+	size_t na;
+	char *b;		/* MERGE: right run */
+	size_t nb;
+	char *dst;		/* MERGE, COPY: output; STABLE_SORT: scratch */
+};
+
+/*
+ * Stable merge sort of a[0..n) using tmp, which must hold at least n/2
+ * elements.  Ties always go to the left run.
+ */
+static void
+msort(char *a, size_t n, size_t es, cmp_t *cmp, char *tmp)
+{
+	size_t m, i, j;
+	char *l, *le, *r, *re, *d;
+
+	if (n <= MERGE_INSERTION) {
+		for (i = 1; i < n; i++) {
+			j = i;
+			if (cmp(a + (j - 1) * es, a + j * es) <= 0)
+				continue;
+			memcpy(tmp, a + j * es, es);
+			do {
+				memcpy(a + j * es, a + (j - 1) * es, es);
+				j--;
+			} while (j > 0 && cmp(a + (j - 1) * es, tmp) > 0);
+			memcpy(a + j * es, tmp, es);
+		}
+		return;
+	}
+
+	m = n / 2;
+	msort(a, m, es, cmp, tmp);
+	msort(a + m * es, n - m, es, cmp, tmp);
+	if (cmp(a + (m - 1) * es, a + m * es) <= 0)
+		return;
+
+	/* Move the left run out of the way and merge back into a.  The
+	   write pointer can never overtake the right run's read pointer. */
+	memcpy(tmp, a, m * es);
+	l = tmp;
+	le = tmp + m * es;
+	r = a + m * es;
+	re = a + n * es;
+	d = a;
+	while (l < le && r < re) {
+		if (cmp(l, r) <= 0) {
+			memcpy(d, l, es);
+			l += es;
+		} else {
+			memcpy(d, r, es);
+			r += es;
+		}
+		d += es;
+	}
+	if (l < le)
+		memcpy(d, l, le - l);
+}
+
+/* Stable merge of a[0..na) and b[0..nb) into dst.  */
+static void
+merge(const char *a, size_t na, const char *b, size_t nb, char *dst,
+    size_t es, cmp_t *cmp)
+{
+	const char *ae = a + na * es, *be = b + nb * es;
+
+	while (a < ae && b < be) {
+		if (cmp(a, b) <= 0) {
+			memcpy(dst, a, es);
+			a += es;
+		} else {
+			memcpy(dst, b, es);
+			b += es;
+		}
+		dst += es;
+	}
+	if (a < ae)
+		memcpy(dst, a, ae - a);
+	else if (b < be)
+		memcpy(dst, b, be - b);
+}
+
+/*
+ * Number of elements the stable merge of a[0..na) and b[0..nb) takes
+ * from a among its first r outputs.  Splitting every merge at these
+ * points lets the pieces be merged independently without breaking
+ * stability.
+ */
+static size_t
+corank(size_t r, const char *a, size_t na, const char *b, size_t nb,
+    size_t es, cmp_t *cmp)
+{
+	size_t lo, hi, i;
+
+	lo = r > nb ? r - nb : 0;
+	hi = r < na ? r : na;
+	while (lo < hi) {
+		i = lo + (hi - lo) / 2;
+		/* Too few from a if a[i] would precede b[r - i - 1].  */
+		if (cmp(a + i * es, b + (r - i - 1) * es) <= 0)
+			lo = i + 1;
+		else
+			hi = i;
+	}
+	return (lo);
+}
+
+static void *
+run_task(void *arg)
+{
+	struct sort_task *t = arg;
+
+	switch (t->kind) {
+	case TASK_SORT:
+		qsort(t->a, t->na, t->es, t->cmp);
+		break;
+	case TASK_STABLE_SORT:
+		msort(t->a, t->na, t->es, t->cmp, t->dst);
+		break;
+	case TASK_MERGE:
+		merge(t->a, t->na, t->b, t->nb, t->dst, t->es, t->cmp);
+		break;
+	case TASK_COPY:
+		memcpy(t->dst, t->a, t->na * t->es);
+		break;
+	}
+	return (NULL);
+}
+
+/*
+ * Run tasks[0..n) to completion, one per thread, with tasks[0] on the
+ * calling thread.  A task whose thread cannot be created is run inline.
+ */
+static void
+run_tasks(struct sort_task *tasks, int n)
+{
+#ifdef _POSIX_THREADS
+	pthread_t tid[MT_MAX_THREADS + 1];
+	char started[MT_MAX_THREADS + 1];
+	int i;
+
+	for (i = 1; i < n; i++)
+		started[i] = pthread_create(&tid[i], NULL, run_task,
+		    &tasks[i]) == 0;
+	run_task(&tasks[0]);
+	for (i = 1; i < n; i++) {
+		if (started[i])
+			pthread_join(tid[i], NULL);
+		else
+			run_task(&tasks[i]);
+	}
+#else
+	int i;
+
+	for (i = 0; i < n; i++)
+		run_task(&tasks[i]);
+#endif
+}
+
+static int
+thread_count(size_t n, int nthreads)
+{
+#ifdef _POSIX_THREADS
+	size_t p;
+
+	if (nthreads < 2)
+		return (1);
+	p = n / MT_MIN_PER_THREAD;
+	if (p > (size_t)nthreads)
+		p = nthreads;
+	if (p > MT_MAX_THREADS)
+		p = MT_MAX_THREADS;
+	return (p < 2 ? 1 : (int)p);
+#else
+	return (1);
+#endif
+}
+
+/*
+ * Sort base[0..n) with p threads: sort p runs, then merge them in
+ * log2(p) rounds, ping-ponging between base and tmp (n elements).
+ */
+static void
+mt_sort(char *base, size_t n, size_t es, cmp_t *cmp, int p, int stable,
+    char *tmp)
+{
+	struct sort_task tasks[MT_MAX_THREADS + 1];
+	size_t bound[MT_MAX_THREADS + 1];
+	size_t lo, mid, hi, len, r0, r1, i0, i1;
+	char *src, *dst, *sw;
+	int nruns, nt, pairs, parts, q, k;
+
+	for (k = 0; k <= p; k++)
+		bound[k] = n / p * k + (n % p) * k / p;
+	for (k = 0; k < p; k++) {
+		tasks[k].kind = stable ? TASK_STABLE_SORT : TASK_SORT;
+		tasks[k].es = es;
+		tasks[k].cmp = cmp;
+		tasks[k].a = base + bound[k] * es;
+		tasks[k].na = bound[k + 1] - bound[k];
+		tasks[k].dst = tmp + bound[k] * es;
+	}
+	run_tasks(tasks, p);
+
+	src = base;
+	dst = tmp;
+	for (nruns = p; nruns > 1; nruns = (nruns + 1) / 2) {
+		pairs = nruns / 2;
+		parts = p / pairs;
+		nt = 0;
+		for (q = 0; q < pairs; q++) {
+			lo = bound[2 * q];
+			mid = bound[2 * q + 1];
+			hi = bound[2 * q + 2];
+			len = hi - lo;
+			i0 = 0;
+			r0 = 0;
+			for (k = 1; k <= parts; k++) {
+				r1 = len / parts * k + (len % parts) * k / parts;
+				i1 = k == parts ? mid - lo :
+				    corank(r1, src + lo * es, mid - lo,
+				    src + mid * es, hi - mid, es, cmp);
+				tasks[nt].kind = TASK_MERGE;
+				tasks[nt].es = es;
+				tasks[nt].cmp = cmp;
+				tasks[nt].a = src + (lo + i0) * es;
+				tasks[nt].na = i1 - i0;
+				tasks[nt].b = src + (mid + (r0 - i0)) * es;
+				tasks[nt].nb = (r1 - i1) - (r0 - i0);
+				tasks[nt].dst = dst + (lo + r0) * es;
+				nt++;
+				i0 = i1;
+				r0 = r1;
+			}
+		}
+		if (nruns & 1) {
+			/* The odd run out is carried over unchanged.  */
+			lo = bound[nruns - 1];
+			tasks[nt].kind = TASK_COPY;
+			tasks[nt].es = es;
+			tasks[nt].a = src + lo * es;
+			tasks[nt].na = n - lo;
+			tasks[nt].dst = dst + lo * es;
+			nt++;
+		}
+		run_tasks(tasks, nt);
+
+		for (k = 0; 2 * k < nruns; k++)
+			bound[k] = bound[2 * k];
+		bound[k] = n;
+		sw = src;
+		src = dst;
+		dst = sw;
+	}
+
+	if (src != base) {
+		for (k = 0; k < p; k++) {
+			lo = n / p * k + (n % p) * k / p;
+			hi = n / p * (k + 1) + (n % p) * (k + 1) / p;
+			tasks[k].kind = TASK_COPY;
+			tasks[k].es = es;
+			tasks[k].a = src + lo * es;
+			tasks[k].na = hi - lo;
+			tasks[k].dst = base + lo * es;
+		}
+		run_tasks(tasks, p);
+	}
+}
+
+_VOID
+_DEFUN(qsort_mt, (base, nmemb, size, cmp, nthreads),
+	void *base _AND
+	size_t nmemb _AND
+	size_t size _AND
+	cmp_t *cmp _AND
+	int nthreads)
+{
+	char *tmp;
+	int p;
+
+	p = thread_count(nmemb, nthreads);
+	if (p < 2 || (tmp = malloc(nmemb * size)) == NULL) {
+		qsort(base, nmemb, size, cmp);
+		return;
+	}
+	mt_sort(base, nmemb, size, cmp, p, 0, tmp);
+	free(tmp);
+}
+
+int
+_DEFUN(qsort_mt_stable, (base, nmemb, size, cmp, nthreads),
+	void *base _AND
+	size_t nmemb _AND
+	size_t size _AND
+	cmp_t *cmp _AND
+	int nthreads)
+{
+	char *tmp;
+	int p;
+
+	if (nmemb < 2 || size == 0)
+		return (0);
+	p = thread_count(nmemb, nthreads);
+	/* The sequential sort only needs room for half the array, but
+	   never less than one element for the insertion sort.  */
+	tmp = malloc(p < 2 ? (nmemb / 2 + 1) * size : nmemb * size);
+	if (tmp == NULL) {
+		errno = ENOMEM;
+		return (-1);
+	}
+	if (p < 2)
+		msort(base, nmemb, size, cmp, tmp);
+	else
+		mt_sort(base, nmemb, size, cmp, p, 1, tmp);
+	free(tmp);
+	return (0);
+}
@@ -31,37 +31,74 @@ _DEFUN(tdelete, (vkey, vrootp, compar),
 	void      **__restrict vrootp _AND	/* address of the root of tree */
 	int       (*compar)(const void *, const void *))
 {
-	node_t **rootp = (node_t **)vrootp;
-	node_t *p, *q, *r;
-	int  cmp;
+	node_t **path[__TREE_MAX_DEPTH];
+	node_t *p, *q, *parent;
+	int  cmp, depth, top, shrunk;
 
-	if (rootp == NULL || (p = *rootp) == NULL)
+	if (vrootp == NULL || *vrootp == NULL)
 		return NULL;
 
-	while ((cmp = (*compar)(vkey, (*rootp)->key)) != 0) {
-		p = *rootp;
-		rootp = (cmp < 0) ?
-		    &(*rootp)->llink :		/* follow llink branch */
-		    &(*rootp)->rlink;		/* follow rlink branch */
-		if (*rootp == NULL)
+	path[0] = (node_t **)vrootp;
+	for (depth = 0; (cmp = (*compar)(vkey, (*path[depth])->key)) != 0;
+	    depth++) {
+		p = *path[depth];
+		path[depth + 1] = (cmp < 0) ?
+		    &p->llink :			/* follow llink branch */
+		    &p->rlink;			/* follow rlink branch */
+		if (*path[depth + 1] == NULL)
 			return NULL;		/* key not found */
 	}
-	r = (*rootp)->rlink;			/* D1: */
-	if ((q = (*rootp)->llink) == NULL)	/* Left NULL? */
-		q = r;
-	else if (r != NULL) {			/* Right link is NULL? */
-		if (r->llink == NULL) {		/* D2: Find successor */
-			r->llink = q;
-			q = r;
-		} else {			/* D3: Find NULL link */
-			for (q = r->llink; q->llink != NULL; q = r->llink)
-				r = q;
-			r->llink = q->rlink;
-			q->llink = (*rootp)->llink;
-			q->rlink = (*rootp)->rlink;
+	/* Any non-null pointer will do when the root goes.  */
+	parent = depth > 0 ? *path[depth - 1] : (node_t *)vrootp;
+
+	p = *path[depth];
+	if (p->llink == NULL || p->rlink == NULL) {
+		/* At most one child: it takes p's place.  */
+		*path[depth] = p->llink != NULL ? p->llink : p->rlink;
+	} else {
+		/* Unlink p's successor and put it where p was.  */
+		top = depth++;
+		path[depth] = &p->rlink;
+		while ((*path[depth])->llink != NULL) {
+			path[depth + 1] = &(*path[depth])->llink;
+			depth++;
+		}
+		q = *path[depth];
+		*path[depth] = q->rlink;
+		q->llink = p->llink;
+		q->rlink = p->rlink;
+		q->balance = p->balance;
+		*path[top] = q;
+		path[top + 1] = &q->rlink;
+	}
+	free(p);
+
+	/* Retrace towards the root while subtrees keep getting shorter.  */
+	while (depth-- > 0) {
+		p = *path[depth];
+		if (path[depth + 1] == &p->llink) {
+			if (p->balance < 0) {
+				p->balance = 0;
+				continue;
+			}
+			if (p->balance == 0) {
+				p->balance = 1;
+				break;
+			}
+			*path[depth] = __tree_rotate(p, 1, &shrunk);
+		} else {
+			if (p->balance > 0) {
+				p->balance = 0;
+				continue;
+			}
+			if (p->balance == 0) {
+				p->balance = -1;
+				break;
+			}
+			*path[depth] = __tree_rotate(p, -1, &shrunk);
 		}
+		if (!shrunk)
+			break;
 	}
-	free(*rootp);				/* D4: Free node */
-	*rootp = q;				/* link parent to new node */
-	return p;
+	return parent;
 }
@@ -2,7 +2,9 @@
 
 /*
  * Tree search generalized from Knuth (6.2.2) Algorithm T just like
- * the AT&T man page says.
+ * the AT&T man page says.  The tree is kept height balanced (AVL,
+ * Knuth 6.2.3) so that keys inserted in order don't degrade it into a
+ * list.
  *
  * The node_t structure is for internal use only, lint doesn't grok it.
  *
@@ -23,6 +25,58 @@ __RCSID("$NetBSD: tsearch.c,v 1.3 1999/09/16 11:45:37 lukem Exp $");
 #include <search.h>
 #include <stdlib.h>
 
+/*
+ * Rebalance the subtree rooted at n, which is two levels heavier on the
+ * right (dir > 0) or on the left (dir < 0).  Returns the new subtree
+ * root and sets *shrunk if the subtree's height went down by one, which
+ * is always the case after an insertion.
+ */
+node_t *
+_DEFUN(__tree_rotate, (n, dir, shrunk),
+	node_t *n _AND
+	int dir _AND
+	int *shrunk)
+{
+	node_t *c, *g;
+
+	if (dir > 0) {
+		c = n->rlink;
+		if (c->balance >= 0) {		/* single left rotation */
+			n->rlink = c->llink;
+			c->llink = n;
+			*shrunk = c->balance != 0;
+			c->balance--;
+			n->balance = -c->balance;
+			return c;
+		}
+		g = c->llink;			/* double rotation */
+		c->llink = g->rlink;
+		n->rlink = g->llink;
+		g->llink = n;
+		g->rlink = c;
+	} else {
+		c = n->llink;
+		if (c->balance <= 0) {		/* single right rotation */
+			n->llink = c->rlink;
+			c->rlink = n;
+			*shrunk = c->balance != 0;
+			c->balance++;
+			n->balance = -c->balance;
+			return c;
+		}
+		g = c->rlink;			/* double rotation */
+		c->rlink = g->llink;
+		n->llink = g->rlink;
+		g->rlink = n;
+		g->llink = c;
+	}
+	g->llink->balance = g->balance > 0 ? -1 : 0;
+	g->rlink->balance = g->balance < 0 ? 1 : 0;
+	g->balance = 0;
+	*shrunk = 1;
+	return g;
+}
+
 /* find or insert datum into search tree */
 void *
 _DEFUN(tsearch, (vkey, vrootp, compar),
@@ -30,29 +84,60 @@ _DEFUN(tsearch, (vkey, vrootp, compar),
 	void **vrootp _AND		/* address of tree root */
 	int (*compar)(const void *, const void *))
 {
-	node_t *q;
-	node_t **rootp = (node_t **)vrootp;
+	node_t *q, *p;
+	node_t **path[__TREE_MAX_DEPTH];
+	int depth, shrunk;
 
-	if (rootp == NULL)
+	if (vrootp == NULL)
 		return NULL;
 
-	while (*rootp != NULL) {	/* Knuth's T1: */
+	path[0] = (node_t **)vrootp;
+	for (depth = 0; *path[depth] != NULL; depth++) { /* Knuth's T1: */
 		int r;
 
-		if ((r = (*compar)(vkey, (*rootp)->key)) == 0)	/* T2: */
-			return *rootp;		/* we found it! */
+		p = *path[depth];
+		if ((r = (*compar)(vkey, p->key)) == 0)	/* T2: */
+			return p;		/* we found it! */
 
-		rootp = (r < 0) ?
-		    &(*rootp)->llink :		/* T3: follow left branch */
-		    &(*rootp)->rlink;		/* T4: follow right branch */
+		path[depth + 1] = (r < 0) ?
+		    &p->llink :			/* T3: follow left branch */
+		    &p->rlink;			/* T4: follow right branch */
 	}
 
 	q = malloc(sizeof(node_t));		/* T5: key not found */
-	if (q != 0) {				/* make new node */
-		*rootp = q;			/* link new node to old */
-		/* LINTED const castaway ok */
-		q->key = (void *)vkey;		/* initialize new node */
-		q->llink = q->rlink = NULL;
+	if (q == NULL)
+		return NULL;
+	*path[depth] = q;			/* link new node to old */
+	/* LINTED const castaway ok */
+	q->key = (void *)vkey;			/* initialize new node */
+	q->llink = q->rlink = NULL;
+	q->balance = 0;
+
+	/* Retrace towards the root until some subtree stops growing.  */
+	while (depth-- > 0) {
+		p = *path[depth];
+		if (path[depth + 1] == &p->llink) {
+			if (p->balance > 0) {
+				p->balance = 0;
+				break;
+			}
+			if (p->balance == 0) {
+				p->balance = -1;
+				continue;
+			}
+			*path[depth] = __tree_rotate(p, -1, &shrunk);
+		} else {
+			if (p->balance < 0) {
+				p->balance = 0;
+				break;
+			}
+			if (p->balance == 0) {
+				p->balance = 1;
+				continue;
+			}
+			*path[depth] = __tree_rotate(p, 1, &shrunk);
+		}
+		break;
 	}
 	return q;
 }
@@ -105,6 +105,7 @@ _DEFUN(_fclose_r, (rptr, fp),
 #endif
   if (fp->_close != NULL && fp->_close (rptr, fp->_cookie) < 0)
     r = EOF;
+  UNMAPBUF (fp);
   if (fp->_flags & __SMBF)
     _free_r (rptr, (char *) fp->_bf._base);
   if (HASUB (fp))
@@ -112,7 +113,7 @@ _DEFUN(_fclose_r, (rptr, fp),
   if (HASLB (fp))
     FREELB (rptr, fp);
   __sfp_lock_acquire ();
-  fp->_flags = 0;		/* release this FILE for reuse */
+  __sfp_free (fp);		/* release this FILE for reuse */
   if (!(fp->_flags2 & __SNLK))
     _funlockfile (fp);
 #ifndef __SINGLE_THREAD__
@@ -85,26 +85,28 @@ _DEFUN(std, (ptr, flags, file, data),
 #endif
 }
 
-struct glue_with_file {
-  struct _glue glue;
-  FILE file;
-};
-
 struct _glue *
 _DEFUN(__sfmoreglue, (d, n),
        struct _reent *d _AND
        register int n)
 {
   struct glue_with_file *g;
+  int i;
 
   g = (struct glue_with_file *)
-    _malloc_r (d, sizeof (*g) + (n - 1) * sizeof (FILE));
+    _malloc_r (d, sizeof (*g) + (n - 1) * sizeof (FILE)
+		  + 2 * n * sizeof (int));
   if (g == NULL)
     return NULL;
   g->glue._next = NULL;
   g->glue._niobs = n;
   g->glue._iobs = &g->file;
   memset (&g->file, 0, n * sizeof (FILE));
+  g->_nlive = 0;
+  g->_slot = (int *) (&g->file + n);
+  g->_where = g->_slot + n;
+  for (i = 0; i < n; i++)
+    g->_slot[i] = g->_where[i] = i;
   return &g->glue;
 }
 
@@ -117,20 +119,35 @@ _DEFUN(__sfp, (d),
        struct _reent *d)
 {
   FILE *fp;
-  int n;
+  int n, total = 0;
   struct _glue *g;
+  struct glue_with_file *b;
 
   _newlib_sfp_lock_start ();
 
   if (!_GLOBAL_REENT->__sdidinit)
     __sinit (_GLOBAL_REENT);
-  for (g = &_GLOBAL_REENT->__sglue;; g = g->_next)
+  g = &_GLOBAL_REENT->__sglue;
+  for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
+    if (fp->_flags == 0)
+      goto found;
+  for (;; g = g->_next)
     {
-      for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
-	if (fp->_flags == 0)
-	  goto found;
+      if (g != &_GLOBAL_REENT->__sglue)
+	{
+	  b = (struct glue_with_file *) g;
+	  if (b->_nlive < g->_niobs)
+	    {
+	      fp = &b->file + b->_slot[b->_nlive++];
+	      goto found;
+	    }
+	  total += g->_niobs;
+	}
+      /* Each new block is as large as all the others together, so
+	 there are never more than a few dozen.  */
       if (g->_next == NULL &&
-	  (g->_next = __sfmoreglue (d, NDYNAMIC)) == NULL)
+	  (g->_next = __sfmoreglue (d, total < NDYNAMIC ? NDYNAMIC
+					: total)) == NULL)
 	break;
     }
   _newlib_sfp_lock_exit ();
@@ -162,6 +179,40 @@ found:
   return fp;
 }
 
+/*
+ * Release FP, which came from __sfp, for reuse.  The caller holds the
+ * sfp lock.
+ */
+
+_VOID
+_DEFUN(__sfp_free, (fp),
+       FILE *fp)
+{
+  struct _glue *g;
+  struct glue_with_file *b;
+  int i, j, k;
+
+  fp->_flags = 0;
+  for (g = _GLOBAL_REENT->__sglue._next; g != NULL; g = g->_next)
+    {
+      b = (struct glue_with_file *) g;
+      if (fp < &b->file || fp >= &b->file + g->_niobs)
+	continue;
+      /* Put the last stream in use where FP was, and FP after it.
+	 _fwalk walks the streams in use from the end without the lock:
+	 done in this order, it sees the moved one at least once.  */
+      i = fp - &b->file;
+      k = b->_where[i];
+      j = b->_slot[b->_nlive - 1];
+      b->_slot[k] = j;
+      b->_where[j] = k;
+      b->_slot[b->_nlive - 1] = i;
+      b->_where[i] = b->_nlive - 1;
+      b->_nlive--;
+      return;
+    }
+}
+
 /*
  * exit() calls _cleanup() through *__cleanup, set whenever we
  * open or buffer a file.  This chicanery is done so that programs
@@ -261,6 +312,11 @@ _DEFUN(__sinit, (s),
 
 #ifndef __SINGLE_THREAD__
 
+#ifdef _STDIO_LOCK_ELISION
+/* Set by the thread library before it starts a second thread.  */
+int __stdio_threaded;
+#endif
+
 __LOCK_INIT_RECURSIVE(static, __sfp_lock);
 __LOCK_INIT_RECURSIVE(static, __sinit_lock);
 
@@ -292,7 +292,7 @@ _DEFUN(_fmemopen_r, (ptr, buf, size, mode),
       == NULL)
     {
       _newlib_sfp_lock_start ();
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);		/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -96,6 +96,11 @@ that permits reading and writing anywhere in it; and <<"a+">> (or
 <<"ab+">>) to permit reading anywhere in an existing file, but writing
 only at the end.
 
+A mode for reading only may also carry an `<<m>>', as in <<"rm">>, to
+have the file read through memory mappings rather than copied into the
+stream buffer.  Where the system cannot do that, or the file cannot be
+mapped (a pipe or a terminal, say), the file is read as usual.
+
 RETURNS
 <<fopen>> returns a file pointer which you can use for other file
 operations, unless the file you requested could not be opened; in that
@@ -117,6 +122,7 @@ static char sccsid[] = "%W% (Berkeley) %G%";
 #include <reent.h>
 #include <stdio.h>
 #include <errno.h>
+#include <string.h>
 #include <sys/lock.h>
 #ifdef __CYGWIN__
 #include <fcntl.h>
@@ -141,7 +147,7 @@ _DEFUN(_fopen_r, (ptr, file, mode),
   if ((f = _open_r (ptr, file, oflags, 0666)) < 0)
     {
       _newlib_sfp_lock_start (); 
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);		/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -167,6 +173,11 @@ _DEFUN(_fopen_r, (ptr, file, mode),
     fp->_flags |= __SCLE;
 #endif
 
+#ifdef _STDIO_MMAP
+  if (flags == __SRD && strchr (mode, 'm') != NULL)
+    fp->_flags2 |= __SMAP;
+#endif
+
   _newlib_flockfile_end (fp);
   return fp;
 }
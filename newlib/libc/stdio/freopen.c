@@ -197,6 +197,7 @@ _DEFUN(_freopen_r, (ptr, file, mode, fp),
    * but stdio has always done this before.
    */
 
+  UNMAPBUF (fp);
   if (fp->_flags & __SMBF)
     _free_r (ptr, (char *) fp->_bf._base);
   fp->_w = 0;
@@ -218,7 +219,7 @@ _DEFUN(_freopen_r, (ptr, file, mode, fp),
   if (f < 0)
     {				/* did not get it after all */
       __sfp_lock_acquire ();
-      fp->_flags = 0;		/* set it free */
+      __sfp_free (fp);		/* set it free */
       ptr->_errno = e;		/* restore in case _close clobbered */
       if (!(oflags2 & __SNLK))
 	_funlockfile (fp);
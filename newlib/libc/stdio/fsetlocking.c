@@ -40,7 +40,8 @@ This function sets how the stdio functions handle locking of FILE <[fp]>.
 The following values describe <[type]>:
 
 <<FSETLOCKING_INTERNAL>> is the default state, where stdio functions
-automatically lock and unlock the stream.
+automatically lock and unlock the stream.  Some systems skip this until
+the process starts its second thread.
 
 <<FSETLOCKING_BYCALLER>> means that automatic locking in stdio functions
 is disabled. Applications which set this take all responsibility for file
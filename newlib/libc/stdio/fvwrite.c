@@ -37,6 +37,85 @@
       iov++; \
     }
 
+#ifdef _STDIO_WRITEV
+#define	NWRITEV	17	/* the buffer and a full chain from vfprintf */
+#define	MAXWRITE (INT_MAX - INT_MAX % BUFSIZ)
+
+/*
+ * Write out whatever FP has buffered followed by all of UIO with
+ * writev, gathering up to NWRITEV regions a call and copying none
+ * of them.  Return zero on success, EOF on error.
+ */
+static int
+_DEFUN(sfvwritev, (ptr, fp, uio),
+       struct _reent *ptr _AND
+       register FILE *fp _AND
+       register struct __suio *uio)
+{
+  struct __siov vec[NWRITEV];
+  register struct __siov *iov, *next;
+  _CONST char *p = NULL, *np, *q;
+  size_t len = 0, nlen, left, buffered, n;
+  _READ_WRITE_RETURN_TYPE w;
+  int cnt;
+
+  /* Empty the buffer first, as __sflush_r does.  */
+  q = (char *) fp->_bf._base;
+  buffered = fp->_p - fp->_bf._base;
+  fp->_p = fp->_bf._base;
+  fp->_w = fp->_flags & (__SLBF | __SNBF) ? 0 : fp->_bf._size;
+
+  iov = uio->uio_iov;
+  while (buffered + uio->uio_resid != 0)
+    {
+      cnt = 0;
+      n = 0;
+      if (buffered != 0)
+	{
+	  vec[cnt].iov_base = q;
+	  vec[cnt++].iov_len = n = buffered;
+	}
+      next = iov;
+      np = p;
+      nlen = len;
+      for (left = uio->uio_resid; left != 0 && cnt < NWRITEV
+	   && n < MAXWRITE; left -= nlen, nlen = 0)
+	{
+	  while (nlen == 0)
+	    {
+	      np = next->iov_base;
+	      nlen = next->iov_len;
+	      next++;
+	    }
+	  nlen = MIN (nlen, MAXWRITE - n);
+	  vec[cnt].iov_base = np;
+	  vec[cnt++].iov_len = nlen;
+	  n += nlen;
+	}
+
+      w = __swritev (ptr, fp->_cookie, vec, cnt);
+      if (w <= 0)
+	goto err;
+      n = MIN ((size_t) w, buffered);
+      q += n;
+      buffered -= n;
+      for (w -= n; w > 0; w -= n)
+	{
+	  GETIOV (;);
+	  n = MIN (len, (size_t) w);
+	  p += n;
+	  len -= n;
+	  uio->uio_resid -= n;
+	}
+    }
+  return 0;
+
+err:
+  fp->_flags |= __SERR;
+  return EOF;
+}
+#endif /* _STDIO_WRITEV */
+
 /*
  * Write some memory regions.  Return zero on success, EOF on error.
  *
@@ -87,6 +166,20 @@ _DEFUN(__sfvwrite_r, (ptr, fp, uio),
     }
 #endif
 
+#ifdef _STDIO_WRITEV
+  /*
+   * Writes to a descriptor that are at least a buffer long, and any
+   * to an unbuffered one, need not go through the buffer.
+   */
+  if ((fp->_write == __swrite
+#ifdef __LARGE64_FILES
+       || fp->_write == __swrite64
+#endif
+       ) && !(fp->_flags & __SSTR)
+      && (fp->_flags & __SNBF || uio->uio_resid >= (size_t) fp->_bf._size))
+    return sfvwritev (ptr, fp, uio);
+#endif
+
   if (fp->_flags & __SNBF)
     {
       /*
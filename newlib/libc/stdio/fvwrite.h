@@ -34,3 +34,7 @@ struct __suio {
 
 extern int _EXFUN(__sfvwrite_r,(struct _reent *, FILE *, struct __suio *));
 extern int _EXFUN(__swsetup_r,(struct _reent *, FILE *));
+#ifdef _STDIO_WRITEV
+extern _READ_WRITE_RETURN_TYPE _EXFUN(__swritev,(struct _reent *, void *,
+					       _CONST struct __siov *, int));
+#endif
@@ -35,19 +35,32 @@ _DEFUN(_fwalk, (ptr, function),
   register FILE *fp;
   register int n, ret = 0;
   register struct _glue *g;
+  struct glue_with_file *b;
 
   /*
    * It should be safe to walk the list without locking it;
    * new nodes are only added to the end and none are ever
-   * removed.
+   * removed.  Within a block, __sfp_free only moves a stream
+   * from the end of the live part towards the front, so a walk
+   * from the end still meets every stream that stays open.
    *
    * Avoid locking this list while walking it or else you will
    * introduce a potential deadlock in [at least] refill.c.
    */
-  for (g = &ptr->__sglue; g != NULL; g = g->_next)
-    for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
-      if (fp->_flags != 0 && fp->_flags != 1 && fp->_file != -1)
-	ret |= (*function) (fp);
+  g = &ptr->__sglue;
+  for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
+    if (fp->_flags != 0 && fp->_flags != 1 && fp->_file != -1)
+      ret |= (*function) (fp);
+  while ((g = g->_next) != NULL)
+    {
+      b = (struct glue_with_file *) g;
+      for (n = b->_nlive; --n >= 0; )
+	{
+	  fp = &b->file + b->_slot[n];
+	  if (fp->_flags != 0 && fp->_flags != 1 && fp->_file != -1)
+	    ret |= (*function) (fp);
+	}
+    }
 
   return ret;
 }
@@ -62,19 +75,32 @@ _DEFUN(_fwalk_reent, (ptr, reent_function),
   register FILE *fp;
   register int n, ret = 0;
   register struct _glue *g;
+  struct glue_with_file *b;
 
   /*
    * It should be safe to walk the list without locking it;
    * new nodes are only added to the end and none are ever
-   * removed.
+   * removed.  Within a block, __sfp_free only moves a stream
+   * from the end of the live part towards the front, so a walk
+   * from the end still meets every stream that stays open.
    *
    * Avoid locking this list while walking it or else you will
    * introduce a potential deadlock in [at least] refill.c.
    */
-  for (g = &ptr->__sglue; g != NULL; g = g->_next)
-    for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
-      if (fp->_flags != 0 && fp->_flags != 1 && fp->_file != -1)
-	ret |= (*reent_function) (ptr, fp);
+  g = &ptr->__sglue;
+  for (fp = g->_iobs, n = g->_niobs; --n >= 0; fp++)
+    if (fp->_flags != 0 && fp->_flags != 1 && fp->_file != -1)
+      ret |= (*reent_function) (ptr, fp);
+  while ((g = g->_next) != NULL)
+    {
+      b = (struct glue_with_file *) g;
+      for (n = b->_nlive; --n >= 0; )
+	{
+	  fp = &b->file + b->_slot[n];
+	  if (fp->_flags != 0 && fp->_flags != 1 && fp->_file != -1)
+	    ret |= (*reent_function) (ptr, fp);
+	}
+    }
 
   return ret;
 }
@@ -41,12 +41,39 @@ No supporting OS subroutines are directly required.
 #include <_ansi.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <errno.h>
 #include "local.h"
 
 #define MIN_LINE_SIZE 4
 #define DEFAULT_LINE_SIZE 128
 
+/* Make room for NEED bytes in *BUFPTR, doubling its size *N as often
+   as that takes.  */
+static char *
+_DEFUN(grow, (bufptr, n, need),
+       char **bufptr _AND
+       size_t *n     _AND
+       size_t need)
+{
+  size_t newsize;
+  char *buf;
+
+  for (newsize = *n; newsize < need; newsize <<= 1)
+    if (newsize > (size_t) -1 / 2)
+      {
+        newsize = need;
+        break;
+      }
+  buf = (char *) realloc (*bufptr, newsize);
+  if (buf != NULL)
+    {
+      *bufptr = buf;
+      *n = newsize;
+    }
+  return buf;
+}
+
 ssize_t
 _DEFUN(__getdelim, (bufptr, n, delim, fp),
        char **bufptr _AND
@@ -54,12 +81,11 @@ _DEFUN(__getdelim, (bufptr, n, delim, fp),
        int delim     _AND 
        FILE *fp)
 {
+  struct _reent *ptr = _REENT;
   char *buf;
-  char *ptr;
-  size_t newsize, numbytes;
-  int pos;
-  int ch;
-  int cont;
+  unsigned char *p, *t;
+  size_t pos, len;
+  int nomem;
 
   if (fp == NULL || bufptr == NULL || n == NULL)
     {
@@ -79,64 +105,64 @@ _DEFUN(__getdelim, (bufptr, n, delim, fp),
       *n = DEFAULT_LINE_SIZE;
     }
 
-  CHECK_INIT (_REENT, fp);
+  CHECK_INIT (ptr, fp);
 
   _newlib_flockfile_start (fp);
 
-  numbytes = *n;
-  ptr = buf;
-
-  cont = 1;
-
-  while (cont)
+  pos = 0;
+  nomem = 0;
+#ifdef __SCLE
+  if (fp->_flags & __SCLE)
     {
-      /* fill buffer - leaving room for nul-terminator */
-      while (--numbytes > 0)
+      int ch;
+
+      /* Line endings are converted by __sgetc_r, so go one by one.  */
+      while ((ch = __sgetc_r (ptr, fp)) != EOF)
         {
-          if ((ch = getc_unlocked (fp)) == EOF)
+          if (pos + 2 > *n && (buf = grow (bufptr, n, pos + 2)) == NULL)
             {
-	      cont = 0;
+              nomem = 1;
               break;
             }
-	  else 
-            {
-              *ptr++ = ch;
-              if (ch == delim)
-                {
-                  cont = 0;
-                  break;
-                }
-            }
+          buf[pos++] = ch;
+          if (ch == delim)
+            break;
         }
-
-      if (cont)
+    }
+  else
+#endif
+  for (;;)
+    {
+      if (fp->_r <= 0 && __srefill_r (ptr, fp))
+        break;
+
+      /* Take everything up to and including the delimiter, or the
+         whole buffer if it has none, in one go.  */
+      p = fp->_p;
+      len = fp->_r;
+      t = (unsigned char *) memchr ((_PTR) p, delim, len);
+      if (t != NULL)
+        len = ++t - p;
+      if (pos + len + 1 > *n && (buf = grow (bufptr, n, pos + len + 1)) == NULL)
         {
-          /* Buffer is too small so reallocate a larger buffer.  */
-          pos = ptr - buf;
-          newsize = (*n << 1);
-          buf = realloc (buf, newsize);
-          if (buf == NULL)
-            {
-              cont = 0;
-              break;
-            }
-
-          /* After reallocating, continue in new buffer */          
-          *bufptr = buf;
-          *n = newsize;
-          ptr = buf + pos;
-          numbytes = newsize - pos;
+          nomem = 1;
+          break;
         }
+      _CAST_VOID memcpy ((_PTR) (buf + pos), (_PTR) p, len);
+      pos += len;
+      fp->_r -= len;
+      fp->_p += len;
+      if (t != NULL)
+        break;
     }
 
   _newlib_flockfile_end (fp);
 
-  /* if no input data, return failure */
-  if (ptr == buf)
+  /* if no input data, or no memory to hold it, return failure */
+  if (pos == 0 || nomem)
     return -1;
 
   /* otherwise, nul-terminate and return number of bytes read */
-  *ptr = '\0';
-  return (ssize_t)(ptr - buf);
+  buf[pos] = '\0';
+  return (ssize_t) pos;
 }
-
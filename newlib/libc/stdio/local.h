@@ -60,6 +60,17 @@
 #define _STDIO_WITH_THREAD_CANCELLATION_SUPPORT
 #endif
 
+/* With _STDIO_LOCK_ELISION, streams are not locked at all while
+   __stdio_threaded is zero, that is until the thread library starts a
+   second thread.  Whether a critical section took the lock is kept for
+   its end, so that a thread started inside one cannot unbalance it.  */
+#ifdef _STDIO_LOCK_ELISION
+extern int __stdio_threaded;
+#define _STDIO_THREADED	__stdio_threaded
+#else
+#define _STDIO_THREADED	1
+#endif
+
 #if defined(__SINGLE_THREAD__) || defined(__IMPL_UNLOCKED__)
 
 # define _newlib_flockfile_start(_fp)
@@ -76,21 +87,31 @@
 # define _newlib_flockfile_start(_fp) \
 	{ \
 	  int __oldfpcancel; \
-	  pthread_setcancelstate (PTHREAD_CANCEL_DISABLE, &__oldfpcancel); \
-	  if (!(_fp->_flags2 & __SNLK)) \
-	    _flockfile (_fp)
+	  int __fplocked = _STDIO_THREADED; \
+	  if (__fplocked) \
+	    { \
+	      pthread_setcancelstate (PTHREAD_CANCEL_DISABLE, &__oldfpcancel); \
+	      if (!(_fp->_flags2 & __SNLK)) \
+		_flockfile (_fp); \
+	    }
 
 /* Exit from a stream oriented critical section prematurely: */
 # define _newlib_flockfile_exit(_fp) \
-	  if (!(_fp->_flags2 & __SNLK)) \
-	    _funlockfile (_fp); \
-	  pthread_setcancelstate (__oldfpcancel, &__oldfpcancel);
+	  if (__fplocked) \
+	    { \
+	      if (!(_fp->_flags2 & __SNLK)) \
+		_funlockfile (_fp); \
+	      pthread_setcancelstate (__oldfpcancel, &__oldfpcancel); \
+	    }
 
 /* End a stream oriented critical section: */
 # define _newlib_flockfile_end(_fp) \
-	  if (!(_fp->_flags2 & __SNLK)) \
-	    _funlockfile (_fp); \
-	  pthread_setcancelstate (__oldfpcancel, &__oldfpcancel); \
+	  if (__fplocked) \
+	    { \
+	      if (!(_fp->_flags2 & __SNLK)) \
+		_funlockfile (_fp); \
+	      pthread_setcancelstate (__oldfpcancel, &__oldfpcancel); \
+	    } \
 	}
 
 /* Start a stream list oriented critical section: */
@@ -115,15 +136,17 @@
 
 # define _newlib_flockfile_start(_fp) \
 	{ \
-		if (!(_fp->_flags2 & __SNLK)) \
+		int __fplocked = _STDIO_THREADED \
+				 && !(_fp->_flags2 & __SNLK); \
+		if (__fplocked) \
 		  _flockfile (_fp)
 
 # define _newlib_flockfile_exit(_fp) \
-		if (!(_fp->_flags2 & __SNLK)) \
+		if (__fplocked) \
 		  _funlockfile(_fp); \
 
 # define _newlib_flockfile_end(_fp) \
-		if (!(_fp->_flags2 & __SNLK)) \
+		if (__fplocked) \
 		  _funlockfile(_fp); \
 	}
 
@@ -186,6 +209,7 @@ extern int    _EXFUN(__swhatbuf_r,(struct _reent *, FILE *, size_t *, int *));
 extern int    _EXFUN(_fwalk,(struct _reent *, int (*)(FILE *)));
 extern int    _EXFUN(_fwalk_reent,(struct _reent *, int (*)(struct _reent *, FILE *)));
 struct _glue * _EXFUN(__sfmoreglue,(struct _reent *,int n));
+extern _VOID   _EXFUN(__sfp_free,(FILE *));
 extern int _EXFUN(__submore, (struct _reent *, FILE *));
 
 #ifdef __LARGE64_FILES
@@ -255,6 +279,19 @@ extern _READ_WRITE_RETURN_TYPE _EXFUN(__swrite64,(struct _reent *, void *,
 #define	FREELB(ptr, fp) { _free_r(ptr,(char *)(fp)->_lb._base); \
       (fp)->_lb._base = NULL; }
 
+/* Streams opened with mode "m" (__SMAP) get their read buffer from
+   mmap windows over the file; the system provides __smapbuf_r, which
+   maps the next window for __srefill_r, and __sunmapbuf, which drops
+   the current one and the mode with it.  */
+
+#ifdef _STDIO_MMAP
+extern int    _EXFUN(__smapbuf_r,(struct _reent *, FILE *));
+extern _VOID   _EXFUN(__sunmapbuf,(FILE *));
+#define	UNMAPBUF(fp) { if ((fp)->_flags2 & __SMAP) __sunmapbuf(fp); }
+#else
+#define	UNMAPBUF(fp)
+#endif
+
 #ifdef _WIDE_ORIENT
 /*
  * Set the orientation for a stream. If o > 0, the stream has wide-
@@ -289,7 +326,19 @@ char *_EXFUN(_llicvt,(char *, long long, char));
 
 #define CVT_BUF_SIZE 128
 
-#define	NDYNAMIC 4	/* add four more whenever necessary */
+#define	NDYNAMIC 4	/* add at least four more whenever necessary */
+
+/* A block of FILEs from __sfmoreglue, every glue after the first.
+   _slot is a permutation of the indices of its FILEs that lists the
+   _nlive ones in use first, and _where is its inverse, so that __sfp,
+   __sfp_free and _fwalk never have to look through the free ones.  */
+struct glue_with_file {
+  struct _glue glue;
+  int _nlive;
+  int *_slot;
+  int *_where;
+  FILE file;
+};
 
 #ifdef __SINGLE_THREAD__
 #define __sfp_lock_acquire()
@@ -62,7 +62,8 @@ int __exponent (char *p0, int exp, int fmtch);
    if VALUE was negative.  Set *DECPT to the exponent plus one.  Set
    *LENGTH to the length of the returned string.  CH must be one of
    [aAeEfFgG]; if it is [aA], then the return string lives in BUF,
-   otherwise the return value shares the mprec reentrant storage.  */
+   otherwise in BUF, of __DTOA_FAST_BUFSIZE characters, or the mprec
+   reentrant storage.  */
 char *
 __cvt (struct _reent *data, _PRINTF_FLOAT_TYPE value, int ndigits, int flags,
        char *sign, int *decpt, int ch, int *length, char *buf)
@@ -98,7 +99,7 @@ __cvt (struct _reent *data, _PRINTF_FLOAT_TYPE value, int ndigits, int flags,
       mode = 2;
     }
 
-  digits = _DTOA_R (data, value, mode, ndigits, decpt, &dsgn, &rve);
+  digits = _DTOA_R (data, value, mode, ndigits, decpt, &dsgn, &rve, buf);
 
   /* Print trailing zeros.  */
   if ((ch != 'g' && ch != 'G') || flags & ALT)
@@ -179,6 +180,8 @@ _printf_float (struct _reent *data,
   int expsize = 0;
   /* Actual number of digits returned by cvt.  */
   int ndig = 0;
+  /* Digits from cvt, when they fit.  */
+  char buf[__DTOA_FAST_BUFSIZE];
   char *cp;
   int n;
   /* Field size expanded by dprec(not for _printf_float).  */
@@ -234,7 +237,7 @@ _printf_float (struct _reent *data,
   pdata->flags |= FPT;
 
   cp = __cvt (data, _fpvalue, pdata->prec, pdata->flags, &softsign,
-	      &expt, code, &ndig, cp);
+	      &expt, code, &ndig, buf);
 
   if (code == 'g' || code == 'G')
     {
@@ -91,7 +91,8 @@
 extern char *_dtoa_r _PARAMS((struct _reent *, double, int,
 			      int, int *, int *, char **));
 
-# define _DTOA_R _dtoa_r
+# define _DTOA_R(data, value, mode, ndigits, decpt, sign, rve, buf) \
+	__dtoa_buf (data, value, mode, ndigits, decpt, sign, rve, buf)
 # define FREXP frexp
 
 #endif /* FLOATING_POINT.  */
@@ -94,6 +94,18 @@ _DEFUN(__srefill_r, (ptr, fp),
 	}
     }
 
+#ifdef _STDIO_MMAP
+  /* Map the next part of the file instead of reading it, unless the
+     stream turns out not to be mappable.  */
+  if (fp->_flags2 & __SMAP)
+    {
+      int ret = __smapbuf_r (ptr, fp);
+
+      if (ret <= 0)
+	return ret;
+    }
+#endif
+
   if (fp->_bf._base == NULL)
     __smakebuf_r (ptr, fp);
 
@@ -130,6 +130,7 @@ _DEFUN(setvbuf, (fp, buf, mode, size),
   if (HASUB(fp))
     FREEUB(reent, fp);
   fp->_r = fp->_lbfsize = 0;
+  UNMAPBUF (fp);
   if (fp->_flags & __SMBF)
     _free_r (reent, (_PTR) fp->_bf._base);
   fp->_flags &= ~(__SLBF | __SNBF | __SMBF | __SOPT | __SNPT | __SEOF);
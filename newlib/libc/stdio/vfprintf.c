@@ -514,7 +514,8 @@ extern char *_dtoa_r _PARAMS((struct _reent *, double, int,
 			      int, int *, int *, char **));
 
 #  define _PRINTF_FLOAT_TYPE double
-#  define _DTOA_R _dtoa_r
+#  define _DTOA_R(data, value, mode, ndigits, decpt, sign, rve, buf) \
+	__dtoa_buf (data, value, mode, ndigits, decpt, sign, rve, buf)
 #  define FREXP frexp
 
 # else /* !_NO_LONGDBL */
@@ -525,7 +526,8 @@ extern char *_ldtoa_r _PARAMS((struct _reent *, _LONG_DOUBLE, int,
 extern int _EXFUN(_ldcheck,(_LONG_DOUBLE *));
 
 #  define _PRINTF_FLOAT_TYPE _LONG_DOUBLE
-#  define _DTOA_R _ldtoa_r
+#  define _DTOA_R(data, value, mode, ndigits, decpt, sign, rve, buf) \
+	_ldtoa_r (data, value, mode, ndigits, decpt, sign, rve)
 /* FIXME - frexpl is not yet supported; and cvt infloops if (double)f
    converts a finite value into infinity.  */
 /* #  define FREXP frexpl */
@@ -543,8 +545,9 @@ static int exponent(char *, int, int);
    at most 64 bits, this would be 23 characters), the maximum
    multibyte character %C, and the maximum default precision of %La
    (assuming long double is at most 128 bits with 113 bits of
-   mantissa, this would be 29 characters).  %e, %f, and %g use
-   reentrant storage shared with mprec.  All other formats that use
+   mantissa, this would be 29 characters).  %e, %f, and %g use it
+   for up to __DTOA_FAST_BUFSIZE digits and reentrant storage shared
+   with mprec for longer ones.  All other formats that use
    buf get by with fewer characters.  Making BUF slightly bigger
    reduces the need for malloc in %.*a and %S, when large precision or
    long strings are processed.
@@ -717,12 +720,16 @@ _DEFUN(_VFPRINTF_R, (data, fp, fmt0, ap),
 	int size;		/* size of converted field or string */
 	char *xdigs = NULL;	/* digits for [xX] conversion */
 #ifdef _FVWRITE_IN_STREAMIO
+#ifdef _STDIO_WRITEV
+#define NIOV 16		/* a chain __sfvwrite_r may pass on as it is */
+#else
 #define NIOV 8
+#endif
 	struct __suio uio;	/* output information: summary */
 	struct __siov iov[NIOV];/* ... and individual io vectors */
 	register struct __siov *iovp;/* for PRINT macro */
 #endif
-	char buf[BUF];		/* space for %c, %S, %[diouxX], %[aA] */
+	char buf[BUF];		/* space for %c, %S, %[diouxX], %[aAeEfFgG] */
 	char ox[2];		/* space for 0x hex-prefix */
 #ifdef _MB_CAPABLE
 	wchar_t wc;
@@ -1286,6 +1293,7 @@ reswitch:	switch (ch) {
 			}
 # endif /* !_NO_LONGDBL */
 
+			cp = buf;
 # ifdef _WANT_IO_C99_FORMATS
 			if (ch == 'a' || ch == 'A') {
 				ox[0] = '0';
@@ -1302,8 +1310,6 @@ reswitch:	switch (ch) {
 				      }
 				    cp = malloc_buf;
 				  }
-				else
-				  cp = buf;
 			} else
 # endif /* _WANT_IO_C99_FORMATS */
 			if (prec == -1) {
@@ -1800,7 +1806,7 @@ error:
    if VALUE was negative.  Set *DECPT to the exponent plus one.  Set
    *LENGTH to the length of the returned string.  CH must be one of
    [aAeEfFgG]; if it is [aA], then the return string lives in BUF,
-   otherwise the return value shares the mprec reentrant storage.  */
+   otherwise in BUF or the mprec reentrant storage.  */
 static char *
 cvt(struct _reent *data, _PRINTF_FLOAT_TYPE value, int ndigits, int flags,
     char *sign, int *decpt, int ch, int *length, char *buf)
@@ -1877,7 +1883,7 @@ cvt(struct _reent *data, _PRINTF_FLOAT_TYPE value, int ndigits, int flags,
 		mode = 2;		/* ndigits significant digits */
 	}
 
-	digits = _DTOA_R (data, value, mode, ndigits, decpt, &dsgn, &rve);
+	digits = _DTOA_R (data, value, mode, ndigits, decpt, &dsgn, &rve, buf);
 
 	if ((ch != 'g' && ch != 'G') || flags & ALT) {	/* Print trailing zeros */
 		bp = digits + ndigits;
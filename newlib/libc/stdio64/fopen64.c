@@ -66,6 +66,7 @@ static char sccsid[] = "%W% (Berkeley) %G%";
 
 #include <stdio.h>
 #include <errno.h>
+#include <string.h>
 #include "local.h"
 #ifdef __CYGWIN__
 #include <fcntl.h>
@@ -92,7 +93,7 @@ _DEFUN (_fopen64_r, (ptr, file, mode),
   if ((f = _open64_r (ptr, file, oflags, 0666)) < 0)
     {
       _newlib_sfp_lock_start ();
-      fp->_flags = 0;		/* release */
+      __sfp_free (fp);		/* release */
 #ifndef __SINGLE_THREAD__
       __lock_close_recursive (fp->_lock);
 #endif
@@ -121,6 +122,11 @@ _DEFUN (_fopen64_r, (ptr, file, mode),
 
   fp->_flags |= __SL64;
 
+#ifdef _STDIO_MMAP
+  if (flags == __SRD && strchr (mode, 'm') != NULL)
+    fp->_flags2 |= __SMAP;
+#endif
+
   _newlib_flockfile_end (fp);
   return fp;
 }
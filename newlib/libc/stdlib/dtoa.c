@@ -31,6 +31,7 @@
 #include <reent.h>
 #include <string.h>
 #include "mprec.h"
+#include "local.h"
 
 static int
 _DEFUN (quorem,
@@ -288,6 +289,31 @@ _DEFUN (_dtoa_r,
       return s;
     }
 
+#ifdef _WANT_DTOA_FAST
+  if (mode == 0 || mode == 2 || mode == 3)
+    {
+      char fast[__DTOA_FAST_BUFSIZE];
+
+      if ((j = __dtoa_fast (d.d, mode, ndigits, decpt, fast)) >= 0)
+	{
+	  /* Same room for trailing zeros as below.  */
+	  i = mode == 0 ? 18 : mode == 2 ? ndigits : ndigits + *decpt;
+	  if (i < j + 1)
+	    i = j + 1;
+	  k = sizeof (__ULong);
+	  for (_REENT_MP_RESULT_K(ptr) = 0;
+	       sizeof (_Bigint) - sizeof (__ULong) + k <= i; k <<= 1)
+	    _REENT_MP_RESULT_K(ptr)++;
+	  _REENT_MP_RESULT(ptr) = Balloc (ptr, _REENT_MP_RESULT_K(ptr));
+	  s0 = (char *) _REENT_MP_RESULT(ptr);
+	  memcpy (s0, fast, j + 1);
+	  if (rve)
+	    *rve = s0 + j;
+	  return s0;
+	}
+    }
+#endif
+
   b = d2b (ptr, d.d, &be, &bbits);
 #ifdef Sudden_Underflow
   i = (int) (word0 (d) >> Exp_shift1 & (Exp_mask >> Exp_shift1));
@@ -87,8 +87,10 @@ _DEFUN (print_f, (ptr, buf, invalue, ndigit, type, dot, mode),
   int decpt;
   int sign;
   char *p, *start, *end;
+  char fast[__DTOA_FAST_BUFSIZE];
 
-  start = p = _dtoa_r (ptr, invalue, mode, ndigit, &decpt, &sign, &end);
+  start = p = __dtoa_buf (ptr, invalue, mode, ndigit, &decpt, &sign, &end,
+			   fast);
 
   if (decpt == 9999)
     {
@@ -157,8 +159,9 @@ _DEFUN (print_e, (ptr, buf, invalue, width, type, dot),
   int decpt;
   int top;
   int ndigit = width;
+  char fast[__DTOA_FAST_BUFSIZE];
 
-  p = _dtoa_r (ptr, invalue, 2, width + 1, &decpt, &sign, &end);
+  p = __dtoa_buf (ptr, invalue, 2, width + 1, &decpt, &sign, &end, fast);
 
   if (decpt == 9999)
     {
@@ -238,6 +241,7 @@ _DEFUN (fcvtbuf, (invalue, ndigit, decpt, sign, fcvt_buf),
   char *p;
   char *end;
   int done = 0;
+  char fast[__DTOA_FAST_BUFSIZE];
 
   if (fcvt_buf == NULL)
     {
@@ -257,11 +261,11 @@ _DEFUN (fcvtbuf, (invalue, ndigit, decpt, sign, fcvt_buf),
 
   if (invalue < 1.0 && invalue > -1.0)
     {
-      p = _dtoa_r (reent, invalue, 2, ndigit, decpt, sign, &end);
+      p = __dtoa_buf (reent, invalue, 2, ndigit, decpt, sign, &end, fast);
     }
   else
     {
-      p = _dtoa_r (reent, invalue, 3, ndigit, decpt, sign, &end);
+      p = __dtoa_buf (reent, invalue, 3, ndigit, decpt, sign, &end, fast);
     }
 
   /* Now copy */
@@ -295,6 +299,7 @@ _DEFUN (ecvtbuf, (invalue, ndigit, decpt, sign, fcvt_buf),
   char *p;
   char *end;
   int done = 0;
+  char fast[__DTOA_FAST_BUFSIZE];
 
   if (fcvt_buf == NULL)
     {
@@ -312,7 +317,7 @@ _DEFUN (ecvtbuf, (invalue, ndigit, decpt, sign, fcvt_buf),
 
   save = fcvt_buf;
 
-  p = _dtoa_r (reent, invalue, 2, ndigit, decpt, sign, &end);
+  p = __dtoa_buf (reent, invalue, 2, ndigit, decpt, sign, &end, fast);
 
   /* Now copy */
 
@@ -377,15 +382,18 @@ _DEFUN (_gcvt, (ptr, invalue, ndigit, buf, type, dot),
       int sign;
       char *end;
       char *p;
+      char fast[__DTOA_FAST_BUFSIZE];
 
       if (invalue < 1.0)
 	{
 	  /* what we want is ndigits after the point */
-	  p = _dtoa_r (ptr, invalue, 3, ndigit, &decpt, &sign, &end);
+	  p = __dtoa_buf (ptr, invalue, 3, ndigit, &decpt, &sign, &end,
+			  fast);
 	}
       else
 	{
-	  p = _dtoa_r (ptr, invalue, 2, ndigit, &decpt, &sign, &end);
+	  p = __dtoa_buf (ptr, invalue, 2, ndigit, &decpt, &sign, &end,
+			  fast);
 	}
 
       if (decpt == 9999)
@@ -5,6 +5,23 @@
 
 char *	_EXFUN(_gcvt,(struct _reent *, double , int , char *, char, int));
 
+/* Digits of a double for _dtoa_r modes 0, 2 and 3, and the double
+   nearest to a decimal for _strtod_l, without Bigint arithmetic; see
+   dtoa-fast.c.  */
+#if !defined (PREFER_SIZE_OVER_SPEED) && !defined (__OPTIMIZE_SIZE__)
+#define _WANT_DTOA_FAST
+#define __DTOA_FAST_DIGITS	17
+#define __DTOA_FAST_BUFSIZE	(__DTOA_FAST_DIGITS + 1)
+int	_EXFUN(__dtoa_fast,(double, int, int, int *, char *));
+char *	_EXFUN(__dtoa_buf,(struct _reent *, double, int, int, int *, int *,
+			   char **, char *));
+int	_EXFUN(__strtod_fast,(__uint64_t, int, int, double *));
+#else
+#define __DTOA_FAST_BUFSIZE	1
+#define __dtoa_buf(ptr, d, mode, ndigits, decpt, sign, rve, buf) \
+	_dtoa_r (ptr, d, mode, ndigits, decpt, sign, rve)
+#endif
+
 #include "../locale/setlocale.h"
 
 #ifndef __machine_mbstate_t_defined
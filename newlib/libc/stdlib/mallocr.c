@@ -223,6 +223,24 @@ int _dummy_mallocr = 1;
   MORECORE_CLEARS           (default 1)
      True (1) if the routine mapped to MORECORE zeroes out memory (which
      holds for sbrk).
+  MALLOC_TCACHE             (default: 1 for multithreaded newlib
+                             targets with __DYNAMIC_REENT__, else 0)
+     Define to non-zero to give each thread a small cache of freed
+     chunks, kept in its struct _reent, which malloc and free use
+     without taking MALLOC_LOCK.  See "Thread caches" below.
+  MALLOC_TCACHE_MAX_BYTES   (default: 64K)
+     Upper bound on the bytes held in any one thread's cache.
+  MALLOC_ARENAS             (default: 1 for multithreaded newlib
+                             targets with __DYNAMIC_REENT__ and real
+                             locks in <sys/lock.h>, else 0)
+     Define to non-zero to allow threads to be spread over several
+     arenas, each with its own bins and lock.  Only one arena is used
+     until mallopt(M_ARENA_MAX, n) asks for more.  See "Arenas" below.
+  MALLOC_MAX_ARENAS         (default: 64)
+     Upper bound on M_ARENA_MAX.
+  MALLOC_ARENA_HEAP_SIZE    (default: 1M)
+     Size, and alignment, of the blocks that arenas other than the
+     main one carve their chunks from.  Must be a power of two.
   DEFAULT_TRIM_THRESHOLD
   DEFAULT_TOP_PAD       
   DEFAULT_MMAP_THRESHOLD
@@ -753,6 +771,7 @@ struct mallinfo {
 #define M_TOP_PAD           -2
 #define M_MMAP_THRESHOLD    -3
 #define M_MMAP_MAX          -4
+#define M_ARENA_MAX         -8
 
 
 
@@ -916,6 +935,18 @@ struct mallinfo {
 
 
 
+/*
+    M_ARENA_MAX is the number of arenas that threads are spread over,
+      from 1 (the default: everything comes from the main arena) up to
+      MALLOC_MAX_ARENAS.  Each thread is given an arena, round-robin,
+      the first time it allocates once more than one is allowed, and
+      keeps it; lowering the value only affects threads that have not
+      allocated yet.  If MALLOC_ARENAS is not set, setting it to
+      anything but 1 in mallopt fails.
+*/
+
+
+
 
 /* 
 
@@ -1017,6 +1048,7 @@ extern Void_t*     sbrk();
 #define malloc_usable_size		_malloc_usable_size_r
 
 #define malloc_update_mallinfo		__malloc_update_mallinfo
+#define malloc_arenas_mallinfo		__malloc_arenas_mallinfo
 
 #define malloc_av_			__malloc_av_
 #define malloc_current_mallinfo		__malloc_current_mallinfo
@@ -1025,6 +1057,13 @@ extern Void_t*     sbrk();
 #define malloc_sbrk_base		__malloc_sbrk_base
 #define malloc_top_pad			__malloc_top_pad
 #define malloc_trim_threshold		__malloc_trim_threshold
+#define malloc_main_arena		__malloc_main_arena
+#define malloc_arena_table		__malloc_arena_table
+#define malloc_arena_max		__malloc_arena_max
+#define malloc_arena_next		__malloc_arena_next
+#define malloc_heap_table		__malloc_heap_table
+#define malloc_n_heaps			__malloc_n_heaps
+#define malloc_arena_assign		__malloc_arena_assign
 
 #else /* ! INTERNAL_NEWLIB */
 
@@ -1755,6 +1794,316 @@ extern unsigned long max_mmapped_mem;
 /* The total memory obtained from system via sbrk */
 #define sbrked_mem  (current_mallinfo.arena)
 
+
+
+/*
+  Arenas
+
+    With MALLOC_ARENAS, the bins above become the main arena, and up
+    to MALLOC_MAX_ARENAS - 1 more arenas can be made, each with its
+    own bins, top chunk and lock.  Once M_ARENA_MAX allows more than
+    one, each thread is handed an arena, round-robin, the first time it
+    allocates, and requests of up to ARENA_MAX_CHUNK bytes are served
+    from it from then on.  Larger requests always use the main arena.
+
+    The other arenas carve their chunks out of heaps: blocks of
+    MALLOC_ARENA_HEAP_SIZE bytes, aligned to their size, memaligned
+    from the main arena.  A heap starts with a struct malloc_heap
+    naming its arena; the first heap of an arena also holds the
+    struct malloc_arena and its bins.  When the top chunk of an arena
+    runs out, what is left of it is fenced off and freed, as after a
+    foreign sbrk, and a new heap becomes top.  Heaps are never given
+    back.
+
+    free and realloc find the arena of a chunk from its address: each
+    heap is entered in heap_table, hashed on its base, and a chunk in
+    none of them belongs to the main arena.  Heaps are only ever added,
+    under MALLOC_LOCK, so lookups need no lock.
+
+    The main arena is locked by MALLOC_LOCK, the others by their own
+    <sys/lock.h> lock.  Code holding an arena's lock may take
+    MALLOC_LOCK (to make a heap, say) but never the other way round,
+    and never holds two other arenas' locks at once.
+*/
+
+#ifndef MALLOC_ARENAS
+/* The stub <sys/lock.h> of most targets does nothing, even where
+   __malloc_lock is real, so only enable arenas where it locks. */
+#if defined(INTERNAL_NEWLIB) && defined(_REENT_MALLOC_ARENA) \
+    && defined(__DYNAMIC_REENT__) && !defined(__SINGLE_THREAD__) \
+    && !defined(SMALL_MEMORY) && (defined(__linux__) || defined(__rtems__))
+#define MALLOC_ARENAS 1
+#else
+#define MALLOC_ARENAS 0
+#endif
+#endif
+
+#if MALLOC_ARENAS
+
+#include <sys/lock.h>
+
+#ifndef MALLOC_MAX_ARENAS
+#define MALLOC_MAX_ARENAS 64
+#endif
+
+#ifndef MALLOC_ARENA_HEAP_SIZE
+#define MALLOC_ARENA_HEAP_SIZE (1024L * 1024L)
+#endif
+
+#define HEAP_SIZE          ((POINTER_UINT)MALLOC_ARENA_HEAP_SIZE)
+#define HEAP_TABLE_SIZE    1024            /* power of two */
+#define ARENA_MAX_CHUNK    (HEAP_SIZE / 4) /* largest chunk from a heap */
+
+struct malloc_arena
+{
+  mbinptr *av;                /* bins, laid out as av_ */
+  _LOCK_RECURSIVE_T lock;     /* unused in the main arena */
+};
+
+struct malloc_heap
+{
+  struct malloc_arena *arena; /* owner */
+};
+
+/* Room taken by a struct malloc_heap at the start of a heap */
+#define HEAP_HDR_SIZE \
+  ((sizeof(struct malloc_heap) + MALLOC_ALIGN_MASK) & ~MALLOC_ALIGN_MASK)
+
+#ifdef SEPARATE_OBJECTS
+#define main_arena		malloc_main_arena
+#define arena_table		malloc_arena_table
+#define arena_max		malloc_arena_max
+#define arena_next		malloc_arena_next
+#define heap_table		malloc_heap_table
+#define n_heaps			malloc_n_heaps
+#endif
+
+#ifdef DEFINE_MALLOC
+
+STATIC struct malloc_arena main_arena = { av_ };
+
+/* Arenas by number; slot 0 stands for the main arena */
+STATIC struct malloc_arena *arena_table[MALLOC_MAX_ARENAS];
+
+STATIC int arena_max = 1;             /* M_ARENA_MAX */
+STATIC unsigned int arena_next = 0;   /* next arena to hand out */
+
+STATIC struct malloc_heap *heap_table[HEAP_TABLE_SIZE];
+STATIC int n_heaps = 0;
+
+#else /* ! DEFINE_MALLOC */
+
+extern struct malloc_arena main_arena;
+extern struct malloc_arena *arena_table[MALLOC_MAX_ARENAS];
+extern int arena_max;
+extern unsigned int arena_next;
+extern struct malloc_heap *heap_table[HEAP_TABLE_SIZE];
+extern int n_heaps;
+
+#endif /* ! DEFINE_MALLOC */
+
+/* From here on, the bins are those of the arena `ar_' in scope. */
+
+#undef av_
+#define av_ (ar_->av)
+
+#define is_main_arena(a) ((a) == &main_arena)
+
+#define ARENA_LOCK(a) \
+{ \
+  if (is_main_arena(a)) \
+    MALLOC_LOCK; \
+  else \
+    __lock_acquire_recursive((a)->lock); \
+}
+
+#define ARENA_UNLOCK(a) \
+{ \
+  if (is_main_arena(a)) \
+    MALLOC_UNLOCK; \
+  else \
+    __lock_release_recursive((a)->lock); \
+}
+
+/* Arena argument for routines that look at the bins */
+#if __STD_C
+#define AARG struct malloc_arena *ar_,
+#else
+#define AARG ar_,
+#define ADECL struct malloc_arena *ar_;
+#endif
+#define ACALL ar_,
+
+/* The arena that chunk p belongs to */
+
+static __inline__ struct malloc_arena *arena_of(mchunkptr p)
+{
+  POINTER_UINT key = (POINTER_UINT)p / HEAP_SIZE;
+  struct malloc_heap *h;
+  int i;
+
+  if (n_heaps == 0)
+    return &main_arena;
+  for (i = key & (HEAP_TABLE_SIZE - 1); (h = heap_table[i]) != NULL;
+       i = (i + 1) & (HEAP_TABLE_SIZE - 1))
+    if ((POINTER_UINT)h / HEAP_SIZE == key)
+      return h->arena;
+  return &main_arena;
+}
+
+extern struct malloc_arena *malloc_arena_assign(RONEARG);
+
+/* The arena to serve a request for nb bytes from the calling thread */
+
+static __inline__ struct malloc_arena *arena_get(RARG INTERNAL_SIZE_T nb)
+{
+  struct malloc_arena *ar = (struct malloc_arena *)
+    _REENT_MALLOC_ARENA(reent_ptr);
+
+  if (nb > ARENA_MAX_CHUNK)
+    return &main_arena;
+  if (ar == NULL)
+  {
+    if (arena_max <= 1)
+      return &main_arena;
+    ar = malloc_arena_assign(RONECALL);
+  }
+  return ar;
+}
+
+#else /* ! MALLOC_ARENAS */
+
+#define is_main_arena(a) 1
+#define ARENA_LOCK(a)    MALLOC_LOCK
+#define ARENA_UNLOCK(a)  MALLOC_UNLOCK
+#define AARG
+#define ADECL
+#define ACALL
+
+#endif /* ! MALLOC_ARENAS */
+
+
+
+/*
+  Thread caches
+
+    Each thread keeps singly linked lists of recently freed small
+    chunks, one list per chunk size up to TCACHE_MAX_CHUNK, hung off
+    its struct _reent.  A cached chunk stays marked in use as far as
+    the bins are concerned, so nothing else ever looks at it, and
+    malloc and free can push and pop it without MALLOC_LOCK.
+
+    When a list is empty, malloc takes the lock once and moves
+    TCACHE_FILL chunks of that size into it.  When a list is full, or
+    the thread already caches MALLOC_TCACHE_MAX_BYTES, free takes the
+    lock once and returns a batch of chunks to the bins.  Whatever is
+    left is released when the thread exits, or by _reclaim_reent.
+    Only the calling thread's cache is used; calls with some other
+    struct _reent go to the bins under the lock.
+
+    Cached chunks count as in use in mallinfo and malloc_stats.
+*/
+
+#ifndef MALLOC_TCACHE
+#if defined(INTERNAL_NEWLIB) && defined(_REENT_MALLOC_TCACHE) \
+    && defined(__DYNAMIC_REENT__) && !defined(__SINGLE_THREAD__) \
+    && !defined(SMALL_MEMORY)
+#define MALLOC_TCACHE 1
+#else
+#define MALLOC_TCACHE 0
+#endif
+#endif
+
+#if MALLOC_TCACHE
+
+#ifndef MALLOC_TCACHE_MAX_BYTES
+#define MALLOC_TCACHE_MAX_BYTES (64 * 1024)
+#endif
+
+#define TCACHE_MAX_CHUNK    512   /* largest cached chunk size */
+#define TCACHE_NBINS        ((TCACHE_MAX_CHUNK - MINSIZE) / MALLOC_ALIGNMENT + 1)
+#define TCACHE_COUNT        16    /* chunks per list */
+#define TCACHE_FILL         8     /* chunks moved per refill */
+
+/* List index for a chunk size of at most TCACHE_MAX_CHUNK */
+#define tcache_index(sz)    ((int)(((sz) - MINSIZE) / MALLOC_ALIGNMENT))
+
+struct malloc_tcache
+{
+  mchunkptr bins[TCACHE_NBINS];       /* linked through fd */
+  unsigned char count[TCACHE_NBINS];
+  unsigned long bytes;                /* sum of cached chunk sizes */
+  int busy;                           /* refilling or flushing */
+};
+
+/* Marks a struct _reent whose cache is being allocated. */
+#define TCACHE_CREATING ((struct malloc_tcache *)(-1))
+
+/* Whether the cache of reent_ptr may be used: only the calling thread's
+   own.  A struct _reent passed in by another thread has a cache that
+   its owner may be in the middle of changing. */
+#define tcache_usable() (reent_ptr == _REENT)
+
+#define tcache_push(tc, p, i) \
+{ \
+  (p)->fd = (tc)->bins[i]; \
+  (tc)->bins[i] = (p); \
+  (tc)->count[i]++; \
+  (tc)->bytes += chunksize(p); \
+}
+
+#define tcache_pop(tc, p, i) \
+{ \
+  (p) = (tc)->bins[i]; \
+  (tc)->bins[i] = (p)->fd; \
+  (tc)->count[i]--; \
+  (tc)->bytes -= chunksize(p); \
+}
+
+/* Cached chunks are checked under the lock: their neighbours belong to
+   the global bins and may be changing under other threads. */
+#if DEBUG && MALLOC_ARENAS
+#define check_tcache_chunk(P) \
+{ \
+  struct malloc_arena *ar_ = arena_of(P); \
+  ARENA_LOCK(ar_); \
+  check_inuse_chunk(P); \
+  ARENA_UNLOCK(ar_); \
+}
+#elif DEBUG
+#define check_tcache_chunk(P) \
+{ \
+  MALLOC_LOCK; \
+  check_inuse_chunk(P); \
+  MALLOC_UNLOCK; \
+}
+#else
+#define check_tcache_chunk(P)
+#endif
+
+/* Free a chunk split off while an arena lock is held.  It goes straight
+   to the bins: in the cache it could set off a flush, which takes the
+   lock of the thread's own arena on top of the one already held. */
+#define free_locked(mem) \
+{ \
+  struct malloc_tcache *tc_ = _REENT_MALLOC_TCACHE(reent_ptr); \
+  if (tc_ != NULL && tc_ != TCACHE_CREATING && !tc_->busy \
+      && tcache_usable()) \
+  { \
+    tc_->busy = 1; \
+    fREe(RCALL (mem)); \
+    tc_->busy = 0; \
+  } \
+  else \
+    fREe(RCALL (mem)); \
+}
+
+#else
+
+#define free_locked(mem) fREe(RCALL (mem))
+
+#endif /* MALLOC_TCACHE */
+
 
 
 /* 
@@ -1773,9 +2122,9 @@ extern unsigned long max_mmapped_mem;
 */
 
 #if __STD_C
-static void do_check_chunk(mchunkptr p) 
+static void do_check_chunk(AARG mchunkptr p) 
 #else
-static void do_check_chunk(p) mchunkptr p;
+static void do_check_chunk(AARG p) ADECL mchunkptr p;
 #endif
 { 
   INTERNAL_SIZE_T sz = p->size & ~PREV_INUSE;
@@ -1783,6 +2132,16 @@ static void do_check_chunk(p) mchunkptr p;
   /* No checkable chunk is mmapped */
   assert(!chunk_is_mmapped(p));
 
+#if MALLOC_ARENAS
+  if (!is_main_arena(ar_))
+  {
+    /* ... inside one of the arena's heaps */
+    assert(arena_of(p) == ar_);
+    assert((POINTER_UINT)p % HEAP_SIZE + sz <= HEAP_SIZE);
+    return;
+  }
+#endif
+
   /* Check for legal address ... */
   assert((char*)p >= sbrk_base);
   if (p != top) 
@@ -1794,15 +2153,15 @@ static void do_check_chunk(p) mchunkptr p;
 
 
 #if __STD_C
-static void do_check_free_chunk(mchunkptr p) 
+static void do_check_free_chunk(AARG mchunkptr p) 
 #else
-static void do_check_free_chunk(p) mchunkptr p;
+static void do_check_free_chunk(AARG p) ADECL mchunkptr p;
 #endif
 { 
   INTERNAL_SIZE_T sz = p->size & ~PREV_INUSE;
   mchunkptr next = chunk_at_offset(p, sz);
 
-  do_check_chunk(p);
+  do_check_chunk(ACALL p);
 
   /* Check whether it claims to be free ... */
   assert(!inuse(p));
@@ -1827,13 +2186,13 @@ static void do_check_free_chunk(p) mchunkptr p;
 }
 
 #if __STD_C
-static void do_check_inuse_chunk(mchunkptr p) 
+static void do_check_inuse_chunk(AARG mchunkptr p) 
 #else
-static void do_check_inuse_chunk(p) mchunkptr p;
+static void do_check_inuse_chunk(AARG p) ADECL mchunkptr p;
 #endif
 { 
   mchunkptr next = next_chunk(p);
-  do_check_chunk(p);
+  do_check_chunk(ACALL p);
 
   /* Check whether it claims to be in use ... */
   assert(inuse(p));
@@ -1846,7 +2205,7 @@ static void do_check_inuse_chunk(p) mchunkptr p;
   {
     mchunkptr prv = prev_chunk(p);
     assert(next_chunk(prv) == p);
-    do_check_free_chunk(prv);
+    do_check_free_chunk(ACALL prv);
   }
   if (next == top)
   {
@@ -1854,20 +2213,20 @@ static void do_check_inuse_chunk(p) mchunkptr p;
     assert(chunksize(next) >= MINSIZE);
   }
   else if (!inuse(next))
-    do_check_free_chunk(next);
+    do_check_free_chunk(ACALL next);
 
 }
 
 #if __STD_C
-static void do_check_malloced_chunk(mchunkptr p, INTERNAL_SIZE_T s) 
+static void do_check_malloced_chunk(AARG mchunkptr p, INTERNAL_SIZE_T s) 
 #else
-static void do_check_malloced_chunk(p, s) mchunkptr p; INTERNAL_SIZE_T s;
+static void do_check_malloced_chunk(AARG p, s) ADECL mchunkptr p; INTERNAL_SIZE_T s;
 #endif
 {
   INTERNAL_SIZE_T sz = p->size & ~PREV_INUSE;
   long room = long_sub_size_t(sz, s);
 
-  do_check_inuse_chunk(p);
+  do_check_inuse_chunk(ACALL p);
 
   /* Legal size ... */
   assert((long)sz >= (long)MINSIZE);
@@ -1885,10 +2244,10 @@ static void do_check_malloced_chunk(p, s) mchunkptr p; INTERNAL_SIZE_T s;
 }
 
 
-#define check_free_chunk(P)  do_check_free_chunk(P)
-#define check_inuse_chunk(P) do_check_inuse_chunk(P)
-#define check_chunk(P) do_check_chunk(P)
-#define check_malloced_chunk(P,N) do_check_malloced_chunk(P,N)
+#define check_free_chunk(P)  do_check_free_chunk(ACALL P)
+#define check_inuse_chunk(P) do_check_inuse_chunk(ACALL P)
+#define check_chunk(P) do_check_chunk(ACALL P)
+#define check_malloced_chunk(P,N) do_check_malloced_chunk(ACALL P,N)
 #else
 #define check_free_chunk(P) 
 #define check_inuse_chunk(P)
@@ -2139,6 +2498,9 @@ static void malloc_extend_top(RARG INTERNAL_SIZE_T nb)
 static void malloc_extend_top(RARG nb) RDECL INTERNAL_SIZE_T nb;
 #endif
 {
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_ = &main_arena; /* only the main arena sbrks */
+#endif
   char*     brk;                  /* return value from sbrk */
   INTERNAL_SIZE_T front_misalign; /* unusable bytes at front of sbrked space */
   INTERNAL_SIZE_T correction;     /* bytes for 2nd sbrk call */
@@ -2235,7 +2597,7 @@ static void malloc_extend_top(RARG nb) RDECL INTERNAL_SIZE_T nb;
         SIZE_SZ|PREV_INUSE;
       /* If possible, release the rest. */
       if (old_top_size >= MINSIZE) 
-        fREe(RCALL chunk2mem(old_top));
+        free_locked(chunk2mem(old_top));
     }
   }
 
@@ -2254,6 +2616,108 @@ static void malloc_extend_top(RARG nb) RDECL INTERNAL_SIZE_T nb;
 	 || correction_failed);
 }
 
+#if MALLOC_ARENAS
+
+/* Memalign a heap for arena ar from the main arena and enter it in
+   heap_table.  Returns 0 if there is no memory or no room left. */
+
+static struct malloc_heap *heap_new(RARG struct malloc_arena *ar)
+{
+  int errno_save = RERRNO;
+  struct malloc_heap *h;
+  int i;
+
+  MALLOC_LOCK;
+  /* Keep the table no more than 3/4 full, so lookups stay short. */
+  if (n_heaps >= HEAP_TABLE_SIZE / 4 * 3 ||
+      (h = (struct malloc_heap *) mEMALIGn(RCALL HEAP_SIZE, HEAP_SIZE)) == 0)
+  {
+    MALLOC_UNLOCK;
+    RERRNO = errno_save; /* the caller falls back on the main arena */
+    return 0;
+  }
+  h->arena = ar;
+  for (i = ((POINTER_UINT)h / HEAP_SIZE) & (HEAP_TABLE_SIZE - 1);
+       heap_table[i] != 0; i = (i + 1) & (HEAP_TABLE_SIZE - 1))
+    ;
+  heap_table[i] = h;
+  n_heaps++;
+  MALLOC_UNLOCK;
+  return h;
+}
+
+/* Make the space in heap h past its first `used' bytes the top chunk
+   of arena ar_. */
+
+static void heap_set_top(struct malloc_arena *ar_, struct malloc_heap *h,
+                         INTERNAL_SIZE_T used)
+{
+  char* end = (char*)h + HEAP_SIZE;
+  POINTER_UINT mem = (POINTER_UINT)chunk2mem((char*)h + used);
+
+  top = mem2chunk((mem + MALLOC_ALIGN_MASK) & ~MALLOC_ALIGN_MASK);
+  set_head(top, ((end - (char*)top) & ~MALLOC_ALIGN_MASK) | PREV_INUSE);
+}
+
+/* Move arena ar_ on to a new heap once its top chunk is used up. */
+
+static void arena_extend_top(RARG struct malloc_arena *ar_)
+{
+  mchunkptr old_top = top;
+  INTERNAL_SIZE_T old_top_size = chunksize(old_top);
+  struct malloc_heap *h = heap_new(RCALL ar_);
+
+  if (h == 0)
+    return;
+  heap_set_top(ar_, h, HEAP_HDR_SIZE);
+
+  /* Fence off the rest of the old heap, as malloc_extend_top does
+     after a foreign sbrk, and release it. */
+  old_top_size = (old_top_size - 3*SIZE_SZ) & ~MALLOC_ALIGN_MASK;
+  set_head_size(old_top, old_top_size);
+  chunk_at_offset(old_top, old_top_size          )->size =
+    SIZE_SZ|PREV_INUSE;
+  chunk_at_offset(old_top, old_top_size + SIZE_SZ)->size =
+    SIZE_SZ|PREV_INUSE;
+  if (old_top_size >= MINSIZE)
+    free_locked(chunk2mem(old_top));
+}
+
+/* Hand the calling thread the next arena in turn, making it if need
+   be.  The main arena stands in for one that cannot be made. */
+
+struct malloc_arena *malloc_arena_assign(RONEARG)
+{
+  struct malloc_arena *ar_;
+  struct malloc_heap *h;
+  int n, i;
+
+  MALLOC_LOCK;
+  n = arena_next++ % arena_max;
+  ar_ = n == 0 ? &main_arena : arena_table[n];
+  if (ar_ == 0)
+  {
+    ar_ = &main_arena;
+    if ((h = heap_new(RCALL 0)) != 0)
+    {
+      ar_ = (struct malloc_arena *)((char*)h + HEAP_HDR_SIZE);
+      ar_->av = (mbinptr *)(ar_ + 1);
+      MALLOC_ZERO(ar_->av, (NAV * 2 + 2) * sizeof(mbinptr));
+      for (i = 0; i < NAV; i++)
+        bin_at(i)->fd = bin_at(i)->bk = bin_at(i);
+      __lock_init_recursive(ar_->lock);
+      heap_set_top(ar_, h, (char*)(ar_->av + NAV * 2 + 2) - (char*)h);
+      h->arena = ar_;
+      arena_table[n] = ar_;
+    }
+  }
+  MALLOC_UNLOCK;
+  _REENT_MALLOC_ARENA(reent_ptr) = ar_;
+  return ar_;
+}
+
+#endif /* MALLOC_ARENAS */
+
 #endif /* DEFINE_MALLOC */
 
 
@@ -2320,6 +2784,66 @@ static void malloc_extend_top(RARG nb) RDECL INTERNAL_SIZE_T nb;
 
 */
 
+#if MALLOC_TCACHE
+
+/* The calling thread's cache, allocated on first use; NULL while the
+   cache cannot be used. */
+
+static struct malloc_tcache *tcache_get(RONEARG)
+{
+  struct malloc_tcache *tc = _REENT_MALLOC_TCACHE(reent_ptr);
+
+  if (tc == NULL)
+  {
+    _REENT_MALLOC_TCACHE(reent_ptr) = TCACHE_CREATING;
+    tc = (struct malloc_tcache *) mALLOc(RCALL sizeof(struct malloc_tcache));
+    if (tc != NULL)
+      MALLOC_ZERO(tc, sizeof(struct malloc_tcache));
+    _REENT_MALLOC_TCACHE(reent_ptr) = tc;
+    return tc;
+  }
+  if (tc == TCACHE_CREATING || tc->busy)
+    return NULL;
+  return tc;
+}
+
+/* Move up to TCACHE_FILL chunks for requests of `bytes' into the
+   cache, under a single acquisition of the lock. */
+
+static void tcache_fill(RARG struct malloc_tcache *tc, size_t bytes)
+{
+  int errno_save = RERRNO;
+  Void_t* mem;
+  mchunkptr p;
+  int n, i;
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_ = arena_get(RCALL request2size(bytes));
+#endif
+
+  ARENA_LOCK(ar_);
+  tc->busy = 1;
+  for (n = 0; n < TCACHE_FILL; n++)
+  {
+    if (tc->bytes + TCACHE_MAX_CHUNK > MALLOC_TCACHE_MAX_BYTES)
+      break;
+    if ((mem = mALLOc(RCALL bytes)) == NULL)
+    {
+      RERRNO = errno_save;
+      break;
+    }
+    p = mem2chunk(mem);
+    i = tcache_index(chunksize(p));
+    if (chunksize(p) <= TCACHE_MAX_CHUNK && tc->count[i] < TCACHE_COUNT)
+      tcache_push(tc, p, i)
+    else
+      fREe(RCALL mem);
+  }
+  tc->busy = 0;
+  ARENA_UNLOCK(ar_);
+}
+
+#endif /* MALLOC_TCACHE */
+
 #if __STD_C
 Void_t* mALLOc(RARG size_t bytes)
 #else
@@ -2344,6 +2868,9 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
   mchunkptr fwd;                     /* misc temp for linking */
   mchunkptr bck;                     /* misc temp for linking */
   mbinptr q;                         /* misc temp */
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_;          /* arena to allocate from */
+#endif
 
   INTERNAL_SIZE_T nb  = request2size(bytes);  /* padded request size; */
 
@@ -2354,7 +2881,35 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
     return 0;
   }
 
-  MALLOC_LOCK;
+#if MALLOC_TCACHE
+  if (nb <= TCACHE_MAX_CHUNK && tcache_usable())
+  {
+    struct malloc_tcache *tc = tcache_get(RONECALL);
+
+    if (tc != NULL)
+    {
+      idx = tcache_index(nb);
+      if (tc->bins[idx] == NULL)
+        tcache_fill(RCALL tc, bytes);
+      if (tc->bins[idx] != NULL)
+      {
+        tcache_pop(tc, victim, idx);
+        /* Not check_malloced_chunk: the chunk in front may have been
+           freed while this one sat in the cache.  */
+        check_tcache_chunk(victim);
+        return chunk2mem(victim);
+      }
+    }
+  }
+#endif
+
+#if MALLOC_ARENAS
+  ar_ = arena_get(RCALL nb);
+#endif
+  ARENA_LOCK(ar_);
+#if MALLOC_ARENAS
+ search:
+#endif
 
   /* Check for exact match in a bin */
 
@@ -2381,7 +2936,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
       unlink(victim, bck, fwd);
       set_inuse_bit_at_offset(victim, victim_size);
       check_malloced_chunk(victim, nb);
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return chunk2mem(victim);
     }
 
@@ -2409,7 +2964,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
         unlink(victim, bck, fwd);
         set_inuse_bit_at_offset(victim, victim_size);
         check_malloced_chunk(victim, nb);
-	MALLOC_UNLOCK;
+	ARENA_UNLOCK(ar_);
         return chunk2mem(victim);
       }
     }
@@ -2433,7 +2988,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
       set_head(remainder, remainder_size | PREV_INUSE);
       set_foot(remainder, remainder_size);
       check_malloced_chunk(victim, nb);
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return chunk2mem(victim);
     }
 
@@ -2443,7 +2998,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
     {
       set_inuse_bit_at_offset(victim, victim_size);
       check_malloced_chunk(victim, nb);
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return chunk2mem(victim);
     }
 
@@ -2499,7 +3054,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
             set_head(remainder, remainder_size | PREV_INUSE);
             set_foot(remainder, remainder_size);
             check_malloced_chunk(victim, nb);
-	    MALLOC_UNLOCK;
+	    ARENA_UNLOCK(ar_);
             return chunk2mem(victim);
           }
 
@@ -2508,7 +3063,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
             set_inuse_bit_at_offset(victim, victim_size);
             unlink(victim, bck, fwd);
             check_malloced_chunk(victim, nb);
-	    MALLOC_UNLOCK;
+	    ARENA_UNLOCK(ar_);
             return chunk2mem(victim);
           }
 
@@ -2566,17 +3121,30 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
     if ((unsigned long)nb >= (unsigned long)mmap_threshold &&
         (victim = mmap_chunk(nb)) != 0)
     {
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return chunk2mem(victim);
     }
 #endif
 
     /* Try to extend */
+#if MALLOC_ARENAS
+    if (!is_main_arena(ar_))
+      arena_extend_top(RCALL ar_);
+    else
+#endif
     malloc_extend_top(RCALL nb);
     remainder_size = long_sub_size_t(chunksize(top), nb);
     if (chunksize(top) < nb || remainder_size < (long)MINSIZE)
     {
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
+#if MALLOC_ARENAS
+      if (!is_main_arena(ar_)) /* out of heaps: try the main arena */
+      {
+        ar_ = &main_arena;
+        ARENA_LOCK(ar_);
+        goto search;
+      }
+#endif
       return 0; /* propagate failure */
     }
   }
@@ -2586,7 +3154,7 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
   top = chunk_at_offset(victim, nb);
   set_head(top, remainder_size | PREV_INUSE);
   check_malloced_chunk(victim, nb);
-  MALLOC_UNLOCK;
+  ARENA_UNLOCK(ar_);
   return chunk2mem(victim);
 
 #endif /* MALLOC_PROVIDED */
@@ -2618,6 +3186,98 @@ Void_t* mALLOc(RARG bytes) RDECL size_t bytes;
 */
 
 
+#if MALLOC_TCACHE
+
+/* Return chunks from the cache to the bins, under a single acquisition
+   of the lock, until list `idx' has room and `sz' more bytes fit. */
+
+#if MALLOC_ARENAS
+
+/* Chunks go back to their own arena.  Those of the calling thread's
+   arena are freed while its lock is held; the others are set aside
+   and freed one at a time afterwards, so that no two arena locks are
+   ever held together. */
+
+#define tcache_return(p) \
+{ \
+  if (arena_of(p) == ar_) \
+    fREe(RCALL chunk2mem(p)); \
+  else \
+  { \
+    (p)->fd = spill; \
+    spill = (p); \
+  } \
+}
+
+#define tcache_return_spill() \
+{ \
+  while (spill != 0) \
+  { \
+    p = spill; \
+    spill = p->fd; \
+    fREe(RCALL chunk2mem(p)); \
+  } \
+}
+
+#else
+
+#define tcache_return(p) fREe(RCALL chunk2mem(p))
+#define tcache_return_spill()
+
+#endif /* MALLOC_ARENAS */
+
+static void tcache_flush(RARG struct malloc_tcache *tc, int idx,
+                         INTERNAL_SIZE_T sz)
+{
+  mchunkptr p;
+  int i;
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_ = (struct malloc_arena *)
+    _REENT_MALLOC_ARENA(reent_ptr);
+  mchunkptr spill = 0;
+
+  if (ar_ == 0)
+    ar_ = &main_arena;
+#endif
+
+  ARENA_LOCK(ar_);
+  tc->busy = 1;
+  while (tc->count[idx] > TCACHE_COUNT / 2)
+  {
+    tcache_pop(tc, p, idx);
+    tcache_return(p);
+  }
+  /* Over budget: drain the lists holding the biggest chunks first. */
+  for (i = TCACHE_NBINS - 1;
+       i >= 0 && tc->bytes + sz > MALLOC_TCACHE_MAX_BYTES / 2; i--)
+  {
+    while (tc->bins[i] != NULL)
+    {
+      tcache_pop(tc, p, i);
+      tcache_return(p);
+    }
+  }
+  ARENA_UNLOCK(ar_);
+  tcache_return_spill();
+  tc->busy = 0;
+}
+
+/* Called by _reclaim_reent and at thread exit: give back everything
+   the thread cached.  The thread must be done with malloc. */
+
+void __malloc_tcache_release(RONEARG)
+{
+  struct malloc_tcache *tc = _REENT_MALLOC_TCACHE(reent_ptr);
+
+  if (tc == NULL || tc == TCACHE_CREATING)
+    return;
+  tcache_flush(RCALL tc, 0, MALLOC_TCACHE_MAX_BYTES);
+  _REENT_MALLOC_TCACHE(reent_ptr) = NULL;
+  fREe(RCALL tc);
+}
+
+#endif /* MALLOC_TCACHE */
+
 #if __STD_C
 void fREe(RARG Void_t* mem)
 #else
@@ -2640,20 +3300,47 @@ void fREe(RARG mem) RDECL Void_t* mem;
   mchunkptr bck;       /* misc temp for linking */
   mchunkptr fwd;       /* misc temp for linking */
   int       islr;      /* track whether merging with last_remainder */
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_;  /* arena that p belongs to */
+#endif
 
   if (mem == 0)                              /* free(0) has no effect */
     return;
 
-  MALLOC_LOCK;
+#if MALLOC_TCACHE
+  {
+    struct malloc_tcache *tc = _REENT_MALLOC_TCACHE(reent_ptr);
+
+    p = mem2chunk(mem);
+    sz = chunksize(p);
+    if (tc != NULL && tc != TCACHE_CREATING && !tc->busy
+        && !chunk_is_mmapped(p) && sz <= TCACHE_MAX_CHUNK
+        && tcache_usable())
+    {
+      check_tcache_chunk(p);
+      idx = tcache_index(sz);
+      if (tc->count[idx] >= TCACHE_COUNT
+          || tc->bytes + sz > MALLOC_TCACHE_MAX_BYTES)
+        tcache_flush(RCALL tc, idx, sz);
+      tcache_push(tc, p, idx);
+      return;
+    }
+  }
+#endif
 
   p = mem2chunk(mem);
+#if MALLOC_ARENAS
+  ar_ = arena_of(p);
+#endif
+  ARENA_LOCK(ar_);
+
   hd = p->size;
 
 #if HAVE_MMAP
   if (hd & IS_MMAPPED)                       /* release mmapped memory. */
   {
     munmap_chunk(p);
-    MALLOC_UNLOCK;
+    ARENA_UNLOCK(ar_);
     return;
   }
 #endif
@@ -2678,9 +3365,10 @@ void fREe(RARG mem) RDECL Void_t* mem;
 
     set_head(p, sz | PREV_INUSE);
     top = p;
-    if ((unsigned long)(sz) >= (unsigned long)trim_threshold) 
+    if ((unsigned long)(sz) >= (unsigned long)trim_threshold
+        && is_main_arena(ar_))
       malloc_trim(RCALL top_pad); 
-    MALLOC_UNLOCK;
+    ARENA_UNLOCK(ar_);
     return;
   }
 
@@ -2719,7 +3407,7 @@ void fREe(RARG mem) RDECL Void_t* mem;
   if (!islr)
     frontlink(p, sz, idx, bck, fwd);  
 
-  MALLOC_UNLOCK;
+  ARENA_UNLOCK(ar_);
 
 #endif /* MALLOC_PROVIDED */
 }
@@ -2796,6 +3484,9 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
 
   mchunkptr bck;              /* misc temp for linking */
   mchunkptr fwd;              /* misc temp for linking */
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_;   /* arena that oldp belongs to */
+#endif
 
 #ifdef REALLOC_ZERO_BYTES_FREES
   if (bytes == 0) { fREe(RCALL oldmem); return 0; }
@@ -2805,9 +3496,12 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
   /* realloc of null is supposed to be same as malloc */
   if (oldmem == 0) return mALLOc(RCALL bytes);
 
-  MALLOC_LOCK;
-
   newp    = oldp    = mem2chunk(oldmem);
+#if MALLOC_ARENAS
+  ar_ = arena_of(oldp);
+#endif
+  ARENA_LOCK(ar_);
+
   newsize = oldsize = chunksize(oldp);
 
 
@@ -2816,6 +3510,7 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
   /* Check for overflow and just fail, if so. */
   if (nb > INT_MAX || nb < bytes)
   {
+    ARENA_UNLOCK(ar_);
     RERRNO = ENOMEM;
     return 0;
   }
@@ -2827,26 +3522,26 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
     newp = mremap_chunk(oldp, nb);
     if(newp)
     {
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return chunk2mem(newp);
     }
 #endif
     /* Note the extra SIZE_SZ overhead. */
     if(oldsize - SIZE_SZ >= nb)
     {
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return oldmem; /* do nothing */
     }
     /* Must alloc, copy, free. */
     newmem = mALLOc(RCALL bytes);
     if (newmem == 0)
     {
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return 0; /* propagate failure */
     }
     MALLOC_COPY(newmem, oldmem, oldsize - 2*SIZE_SZ);
     munmap_chunk(oldp);
-    MALLOC_UNLOCK;
+    ARENA_UNLOCK(ar_);
     return newmem;
   }
 #endif
@@ -2872,7 +3567,7 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
           top = chunk_at_offset(oldp, nb);
           set_head(top, (newsize - nb) | PREV_INUSE);
           set_head_size(oldp, nb);
-	  MALLOC_UNLOCK;
+	  ARENA_UNLOCK(ar_);
           return chunk2mem(oldp);
         }
       }
@@ -2915,7 +3610,7 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
             top = chunk_at_offset(newp, nb);
             set_head(top, (newsize - nb) | PREV_INUSE);
             set_head_size(newp, nb);
-	    MALLOC_UNLOCK;
+	    ARENA_UNLOCK(ar_);
             return newmem;
           }
         }
@@ -2947,11 +3642,25 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
 
     /* Must allocate */
 
+#if MALLOC_ARENAS
+    /* From another arena: let go of this one first, as its lock must
+       not be held with that of the other. */
+    if (arena_get(RCALL nb) != ar_)
+    {
+      ARENA_UNLOCK(ar_);
+      if ((newmem = mALLOc(RCALL bytes)) == 0)
+        return 0;
+      MALLOC_COPY(newmem, oldmem, oldsize - SIZE_SZ);
+      fREe(RCALL oldmem);
+      return newmem;
+    }
+#endif
+
     newmem = mALLOc (RCALL bytes);
 
     if (newmem == 0)  /* propagate failure */
     {
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return 0;
     }
 
@@ -2967,8 +3676,8 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
 
     /* Otherwise copy, free, and exit */
     MALLOC_COPY(newmem, oldmem, oldsize - SIZE_SZ);
-    fREe(RCALL oldmem);
-    MALLOC_UNLOCK;
+    free_locked(oldmem);
+    ARENA_UNLOCK(ar_);
     return newmem;
   }
 
@@ -2983,7 +3692,7 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
     set_head_size(newp, nb);
     set_head(remainder, remainder_size | PREV_INUSE);
     set_inuse_bit_at_offset(remainder, remainder_size);
-    fREe(RCALL chunk2mem(remainder)); /* let free() deal with it */
+    free_locked(chunk2mem(remainder)); /* let free() deal with it */
   }
   else
   {
@@ -2992,7 +3701,7 @@ Void_t* rEALLOc(RARG oldmem, bytes) RDECL Void_t* oldmem; size_t bytes;
   }
 
   check_inuse_chunk(newp);
-  MALLOC_UNLOCK;
+  ARENA_UNLOCK(ar_);
   return chunk2mem(newp);
 
 #endif /* MALLOC_PROVIDED */
@@ -3036,6 +3745,9 @@ Void_t* mEMALIGn(RARG alignment, bytes) RDECL size_t alignment; size_t bytes;
   INTERNAL_SIZE_T  leadsize;  /* leading space befor alignment point */
   mchunkptr remainder;        /* spare room at end to split off */
   long      remainder_size;   /* its size */
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_;   /* arena that p belongs to */
+#endif
 
   /* If need less alignment than we give anyway, just relay to malloc */
 
@@ -3060,16 +3772,18 @@ Void_t* mEMALIGn(RARG alignment, bytes) RDECL size_t alignment; size_t bytes;
 
   if (m == 0) return 0; /* propagate failure */
 
-  MALLOC_LOCK;
-
   p = mem2chunk(m);
+#if MALLOC_ARENAS
+  ar_ = arena_of(p);
+#endif
+  ARENA_LOCK(ar_);
 
   if ((((unsigned long)(m)) % alignment) == 0) /* aligned */
   {
 #if HAVE_MMAP
     if(chunk_is_mmapped(p))
     {
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return chunk2mem(p); /* nothing more to do */
     }
 #endif
@@ -3097,7 +3811,7 @@ Void_t* mEMALIGn(RARG alignment, bytes) RDECL size_t alignment; size_t bytes;
     {
       newp->prev_size = p->prev_size + leadsize;
       set_head(newp, newsize|IS_MMAPPED);
-      MALLOC_UNLOCK;
+      ARENA_UNLOCK(ar_);
       return chunk2mem(newp);
     }
 #endif
@@ -3107,7 +3821,7 @@ Void_t* mEMALIGn(RARG alignment, bytes) RDECL size_t alignment; size_t bytes;
     set_head(newp, newsize | PREV_INUSE);
     set_inuse_bit_at_offset(newp, newsize);
     set_head_size(p, leadsize);
-    fREe(RCALL chunk2mem(p));
+    free_locked(chunk2mem(p));
     p = newp;
 
     assert (newsize >= nb && (((unsigned long)(chunk2mem(p))) % alignment) == 0);
@@ -3122,11 +3836,11 @@ Void_t* mEMALIGn(RARG alignment, bytes) RDECL size_t alignment; size_t bytes;
     remainder = chunk_at_offset(p, nb);
     set_head(remainder, remainder_size | PREV_INUSE);
     set_head_size(p, nb);
-    fREe(RCALL chunk2mem(remainder));
+    free_locked(chunk2mem(remainder));
   }
 
   check_inuse_chunk(p);
-  MALLOC_UNLOCK;
+  ARENA_UNLOCK(ar_);
   return chunk2mem(p);
 
 }
@@ -3313,6 +4027,9 @@ int malloc_trim(RARG pad) RDECL size_t pad;
   char* new_brk;         /* address returned by negative sbrk call */
 
   unsigned long pagesz = malloc_getpagesize;
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_ = &main_arena; /* only the main arena sbrks */
+#endif
 
   MALLOC_LOCK;
 
@@ -3397,7 +4114,15 @@ size_t malloc_usable_size(RARG mem) RDECL Void_t* mem;
     if(!chunk_is_mmapped(p))
     {
       if (!inuse(p)) return 0;
-#if DEBUG
+#if DEBUG && MALLOC_ARENAS
+      {
+        struct malloc_arena *ar_ = arena_of(p);
+
+        ARENA_LOCK(ar_);
+        check_inuse_chunk(p);
+        ARENA_UNLOCK(ar_);
+      }
+#elif DEBUG
       MALLOC_LOCK;
       check_inuse_chunk(p);
       MALLOC_UNLOCK;
@@ -3416,6 +4141,9 @@ size_t malloc_usable_size(RARG mem) RDECL Void_t* mem;
 
 STATIC void malloc_update_mallinfo() 
 {
+#if MALLOC_ARENAS
+  struct malloc_arena *ar_ = &main_arena;
+#endif
   int i;
   mbinptr b;
   mchunkptr p;
@@ -3454,6 +4182,55 @@ STATIC void malloc_update_mallinfo()
 
 }
 
+#if MALLOC_ARENAS
+
+/* Count the free chunks of the arenas other than the main one into
+   mi->ordblks and mi->fordblks, and return how many there are.  The
+   main arena's heaps hold them, so they already count as in use
+   there.  Must be called without MALLOC_LOCK held. */
+
+int malloc_arenas_mallinfo(RARG struct mallinfo *mi)
+{
+  struct malloc_arena *arenas[MALLOC_MAX_ARENAS];
+  struct malloc_arena *ar_;
+  mbinptr b;
+  mchunkptr p;
+  int n, i, j;
+
+  MALLOC_LOCK;
+  for (i = 1; i < MALLOC_MAX_ARENAS; i++)
+    arenas[i] = arena_table[i];
+  MALLOC_UNLOCK;
+
+  mi->ordblks = mi->fordblks = 0;
+  for (n = 1, i = 1; i < MALLOC_MAX_ARENAS; i++)
+  {
+    if ((ar_ = arenas[i]) == 0)
+      continue;
+    n++;
+    __lock_acquire_recursive(ar_->lock);
+    if ((long)chunksize(top) >= (long)MINSIZE)
+    {
+      mi->fordblks += chunksize(top);
+      mi->ordblks++;
+    }
+    for (j = 1; j < NAV; ++j)
+    {
+      b = bin_at(j);
+      for (p = last(b); p != b; p = p->bk)
+      {
+        check_free_chunk(p);
+        mi->fordblks += chunksize(p);
+        mi->ordblks++;
+      }
+    }
+    __lock_release_recursive(ar_->lock);
+  }
+  return n;
+}
+
+#endif /* MALLOC_ARENAS */
+
 #else /* ! DEFINE_MALLINFO */
 
 #if __STD_C
@@ -3462,6 +4239,10 @@ extern void malloc_update_mallinfo(void);
 extern void malloc_update_mallinfo();
 #endif
 
+#if MALLOC_ARENAS
+extern int malloc_arenas_mallinfo(RARG struct mallinfo *);
+#endif
+
 #endif /* ! DEFINE_MALLINFO */
 
 #ifdef DEFINE_MALLOC_STATS
@@ -3492,9 +4273,16 @@ void malloc_stats(RONEARG) RDECL
   struct mallinfo local_mallinfo;
 #if HAVE_MMAP
   unsigned long local_mmapped_mem, local_max_n_mmaps;
+#endif
+#if MALLOC_ARENAS
+  struct mallinfo others;
+  int local_n_arenas;
 #endif
   FILE *fp;
 
+#if MALLOC_ARENAS
+  local_n_arenas = malloc_arenas_mallinfo(RCALL &others);
+#endif
   MALLOC_LOCK;
   malloc_update_mallinfo();
   local_max_total_mem = max_total_mem;
@@ -3505,6 +4293,9 @@ void malloc_stats(RONEARG) RDECL
   local_max_n_mmaps = max_n_mmaps;
 #endif
   MALLOC_UNLOCK;
+#if MALLOC_ARENAS
+  local_mallinfo.uordblks -= others.fordblks;
+#endif
 
 #ifdef INTERNAL_NEWLIB
   _REENT_SMALL_CHECK_INIT(reent_ptr);
@@ -3531,6 +4322,10 @@ void malloc_stats(RONEARG) RDECL
   fprintf(fp, "max mmap regions = %10u\n", 
 	  (unsigned int)local_max_n_mmaps);
 #endif
+#if MALLOC_ARENAS
+  fprintf(fp, "arenas           = %10u\n", 
+	  (unsigned int)local_n_arenas);
+#endif
 }
 
 #endif /* DEFINE_MALLOC_STATS */
@@ -3548,11 +4343,21 @@ struct mallinfo mALLINFo(RONEARG) RDECL
 #endif
 {
   struct mallinfo ret;
+#if MALLOC_ARENAS
+  struct mallinfo others;
 
+  malloc_arenas_mallinfo(RCALL &others);
+#endif
   MALLOC_LOCK;
   malloc_update_mallinfo();
   ret = current_mallinfo;
   MALLOC_UNLOCK;
+#if MALLOC_ARENAS
+  /* The other arenas live in chunks the main arena counts as used.  */
+  ret.ordblks += others.ordblks;
+  ret.uordblks -= others.fordblks;
+  ret.fordblks += others.fordblks;
+#endif
   return ret;
 }
 
@@ -3598,6 +4403,14 @@ int mALLOPt(RARG param_number, value) RDECL int param_number; int value;
 #else
       MALLOC_UNLOCK; return value == 0;
 #endif
+    case M_ARENA_MAX:
+#if MALLOC_ARENAS
+      if (value >= 1 && value <= MALLOC_MAX_ARENAS)
+      {
+        arena_max = value; MALLOC_UNLOCK; return 1;
+      }
+#endif
+      MALLOC_UNLOCK; return value == 1;
 
     default:
       MALLOC_UNLOCK;
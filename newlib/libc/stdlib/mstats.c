@@ -74,7 +74,10 @@ sets the maximum amount of unused space in the top most block before
 releasing it back to the system in <<free>> (the space is released by
 calling <<_sbrk_r>> with a negative argument); <<M_TOP_PAD>> is the
 amount of padding to allocate whenever <<_sbrk_r>> is called to
-allocate more space.
+allocate more space; <<M_ARENA_MAX>> sets how many arenas, each with
+its own lock, threads are spread over (1, the default, keeps every
+thread on the one heap; other values are only accepted on targets
+with real locks).
 
 The alternate functions <<_mallinfo_r>>, <<_malloc_stats_r>>, and
 <<_mallopt_r>> are reentrant versions.  The extra argument <[reent]>
@@ -30,6 +30,12 @@
  * as to be reenterable.
  *
  * Interface documentation refer to malloc.c.
+ *
+ * By default free chunks are kept in a single list ordered by address,
+ * which malloc and free both walk.  Building with NANO_MALLOC_BINS set
+ * to a number of size classes (2 to 32, e.g. -DNANO_MALLOC_BINS=16)
+ * keeps them in that many lists by size instead, so that malloc and
+ * free take constant time while a fitting chunk is at hand.
  */
 
 #include <stdio.h>
@@ -100,8 +106,18 @@
 #define nano_mallopt		mallopt
 #endif /* ! INTERNAL_NEWLIB */
 
+#ifndef NANO_MALLOC_BINS
+#define NANO_MALLOC_BINS 0
+#elif NANO_MALLOC_BINS != 0 && (NANO_MALLOC_BINS < 2 || NANO_MALLOC_BINS > 32)
+#error NANO_MALLOC_BINS must be 0 or from 2 to 32
+#endif
+
 /* Redefine names to avoid conflict with user names */
 #define free_list __malloc_free_list
+#define free_bins __malloc_free_bins
+#define free_map __malloc_free_map
+#define free_unmerged __malloc_free_unmerged
+#define free_merged __malloc_free_merged
 #define sbrk_start __malloc_sbrk_start
 #define current_mallinfo __malloc_current_mallinfo
 
@@ -167,7 +183,14 @@ struct mallinfo
 #define MALLOC_MINCHUNK (CHUNK_OFFSET + MALLOC_PADDING + MALLOC_MINSIZE)
 
 /* Forward data declarations */
+#if NANO_MALLOC_BINS
+extern chunk * free_bins[NANO_MALLOC_BINS];
+extern unsigned int free_map;
+extern malloc_size_t free_unmerged;
+extern malloc_size_t free_merged;
+#else
 extern chunk * free_list;
+#endif
 extern char * sbrk_start;
 extern struct mallinfo current_mallinfo;
 
@@ -193,9 +216,50 @@ static inline chunk * get_chunk_from_ptr(void * ptr)
     return c;
 }
 
+#if NANO_MALLOC_BINS
+/* Size classes: list i holds free chunks of 16 << i bytes up to twice
+ * that, list 0 also the smaller ones and the last list everything
+ * bigger.  Bit i of free_map is set while list i is not empty.
+ *
+ * free only pushes chunks on their list.  Neighbours are merged by
+ * bin_merge, which malloc calls before it asks sbrk for more memory, so
+ * the heap still only grows when no run of free memory is big enough.
+ * To keep fragmentation down malloc also merges, rather than split a
+ * chunk of a bigger class, once a quarter as many chunks have been
+ * freed as the last merge left, which keeps its cost per free down to
+ * the log of the number of free chunks. */
+static inline int bin_index(malloc_size_t size)
+{
+    int i;
+
+    for (i = 0, size >>= 5; size != 0 && i < NANO_MALLOC_BINS - 1; i++)
+        size >>= 1;
+    return i;
+}
+
+static inline void bin_push(chunk * c)
+{
+    int i = bin_index(c->size);
+
+    c->next = free_bins[i];
+    free_bins[i] = c;
+    free_map |= 1U << i;
+}
+#endif /* NANO_MALLOC_BINS */
+
 #ifdef DEFINE_MALLOC
+#if NANO_MALLOC_BINS
+/* List headers of free blocks, by size */
+chunk * free_bins[NANO_MALLOC_BINS];
+unsigned int free_map;
+
+/* Chunks freed since the last bin_merge, and left by it */
+malloc_size_t free_unmerged;
+malloc_size_t free_merged;
+#else
 /* List list header of free blocks */
 chunk * free_list = NULL;
+#endif
 
 /* Starting point of memory allocated from system */
 char * sbrk_start = NULL;
@@ -230,14 +294,177 @@ static void* sbrk_aligned(RARG malloc_size_t s)
     return align_p;
 }
 
+#if NANO_MALLOC_BINS
+static inline chunk * bin_pop(int i)
+{
+    chunk * c = free_bins[i];
+
+    if ((free_bins[i] = c->next) == NULL)
+        free_map &= ~(1U << i);
+    return c;
+}
+
+/** Function bin_take
+  * Algorithm:
+  *   Split off the tail of free chunk r for a block of alloc_size bytes
+  *   and put the rest back on its list, or hand over all of r if the
+  *   rest would be too small to be a chunk.
+  */
+static chunk * bin_take(chunk * r, malloc_size_t alloc_size)
+{
+    long rem = r->size - alloc_size;
+
+    if (rem >= MALLOC_MINCHUNK)
+    {
+        r->size = rem;
+        bin_push(r);
+        r = (chunk *)((char *)r + rem);
+        r->size = alloc_size;
+    }
+    return r;
+}
+
+/** Function bin_find
+  * Algorithm:
+  *   Try the head of the list for alloc_size, then walk the rest of it
+  *   for a first fit.  Failing that, if bigger is set, take the head of
+  *   the first non-empty list of bigger chunks, which always fits.
+  */
+static chunk * bin_find(malloc_size_t alloc_size, int bigger)
+{
+    chunk *p, *r;
+    unsigned int map;
+    int i = bin_index(alloc_size);
+
+    r = free_bins[i];
+    if (r != NULL && r->size >= alloc_size)
+        return bin_take(bin_pop(i), alloc_size);
+
+    for (p = r; r != NULL; p = r, r = r->next)
+    {
+        if (r->size >= alloc_size)
+        {
+            p->next = r->next;
+            return bin_take(r, alloc_size);
+        }
+    }
+
+    map = free_map & ~((2U << i) - 1);
+    if (bigger && map != 0)
+    {
+        int j = i + 1;
+
+        while ((map & (1U << j)) == 0)
+            j++;
+        return bin_take(bin_pop(j), alloc_size);
+    }
+    return NULL;
+}
+
+/** Function bin_sort
+  * Algorithm:
+  *   Bottom-up merge sort of a list of chunks by address, so that no
+  *   recursion nor extra memory is needed.
+  */
+static chunk * bin_sort(chunk * list)
+{
+    chunk *p, *q, *e, *tail;
+    int insize, nmerges, psize, qsize;
+
+    for (insize = 1; ; insize *= 2)
+    {
+        p = list;
+        list = tail = NULL;
+        nmerges = 0;
+        while (p)
+        {
+            nmerges++;
+            for (q = p, psize = 0; q && psize < insize; psize++)
+                q = q->next;
+            qsize = insize;
+            while (psize > 0 || (qsize > 0 && q))
+            {
+                if (psize > 0 && (qsize == 0 || !q || p <= q))
+                {
+                    e = p;
+                    p = p->next;
+                    psize--;
+                }
+                else
+                {
+                    e = q;
+                    q = q->next;
+                    qsize--;
+                }
+                if (tail) tail->next = e;
+                else list = e;
+                tail = e;
+            }
+            p = q;
+        }
+        if (tail) tail->next = NULL;
+        if (nmerges <= 1)
+            return list;
+    }
+}
+
+/** Function bin_merge
+  * Algorithm:
+  *   Empty all lists into one, sort it by address, merge chunks that
+  *   are adjacent and deal them back out to the lists, lowest address
+  *   first.  A chunk overlapping the one before it was freed twice and
+  *   is dropped.
+  */
+static void bin_merge(void)
+{
+    chunk *list = NULL, *tail[NANO_MALLOC_BINS], *c, *n;
+    int i;
+
+    for (i = 0; i < NANO_MALLOC_BINS; i++)
+    {
+        while ((c = free_bins[i]) != NULL)
+        {
+            free_bins[i] = c->next;
+            c->next = list;
+            list = c;
+        }
+    }
+    free_map = 0;
+    free_merged = 0;
+
+    for (c = bin_sort(list); c; c = n)
+    {
+        for (n = c->next; n && (char *)c + c->size >= (char *)n; n = n->next)
+        {
+            if ((char *)c + c->size == (char *)n)
+                c->size += n->size;
+        }
+        i = bin_index(c->size);
+        if (free_map & (1U << i)) tail[i]->next = c;
+        else free_bins[i] = c;
+        free_map |= 1U << i;
+        tail[i] = c;
+        c->next = NULL;
+        free_merged++;
+    }
+    free_unmerged = 0;
+}
+#endif /* NANO_MALLOC_BINS */
+
 /** Function nano_malloc
   * Algorithm:
   *   Walk through the free list to find the first match. If fails to find
-  *   one, call sbrk to allocate a new chunk.
+  *   one, call sbrk to allocate a new chunk.  With NANO_MALLOC_BINS, look
+  *   in the size classes instead, merging free chunks once before giving
+  *   up on them.
   */
 void * nano_malloc(RARG malloc_size_t s)
 {
+#if NANO_MALLOC_BINS
+    chunk *r;
+#else
     chunk *p, *r;
+#endif
     char * ptr, * align_ptr;
     int offset;
 
@@ -256,6 +483,14 @@ void * nano_malloc(RARG malloc_size_t s)
 
     MALLOC_LOCK;
 
+#if NANO_MALLOC_BINS
+    r = bin_find(alloc_size, free_unmerged <= free_merged / 4);
+    if (r == NULL && free_unmerged)
+    {
+        bin_merge();
+        r = bin_find(alloc_size, 1);
+    }
+#else
     p = free_list;
     r = p;
 
@@ -290,6 +525,7 @@ void * nano_malloc(RARG malloc_size_t s)
         p=r;
         r=r->next;
     }
+#endif
 
     /* Failed to find a appropriate chunk. Ask for more memory */
     if (r == NULL)
@@ -333,6 +569,8 @@ void * nano_malloc(RARG malloc_size_t s)
   *  When free, insert the to-be-freed chunk into free list. The place to
   *  insert should make sure all chunks are sorted by address from low to
   *  high.  Then merge with neighbor chunks if adjacent.
+  *  With NANO_MALLOC_BINS, just push the chunk on the list for its size
+  *  and leave merging to malloc.
   */
 void nano_free (RARG void * free_p)
 {
@@ -344,6 +582,11 @@ void nano_free (RARG void * free_p)
     p_to_free = get_chunk_from_ptr(free_p);
 
     MALLOC_LOCK;
+#if NANO_MALLOC_BINS
+    bin_push(p_to_free);
+    if (free_unmerged <= free_merged)
+        free_unmerged++;
+#else
     if (free_list == NULL)
     {
         /* Set first free list element */
@@ -420,6 +663,7 @@ void nano_free (RARG void * free_p)
         p_to_free->next = q;
         p->next = p_to_free;
     }
+#endif
     MALLOC_UNLOCK;
 }
 #endif /* DEFINE_FREE */
@@ -495,8 +739,18 @@ struct mallinfo nano_mallinfo(RONEARG)
             total_size = (size_t) (sbrk_now - sbrk_start);
     }
 
+#if NANO_MALLOC_BINS
+    {
+        int i;
+
+        for (i = 0; i < NANO_MALLOC_BINS; i++)
+            for (pf = free_bins[i]; pf; pf = pf->next)
+                free_size += pf->size;
+    }
+#else
     for (pf = free_list; pf; pf = pf->next)
         free_size += pf->size;
+#endif
 
     current_mallinfo.arena = total_size;
     current_mallinfo.fordblks = free_size;
@@ -154,6 +154,7 @@ THIS SOFTWARE.
 #include "gdtoa.h"
 #include "gd_qnan.h"
 #include "../locale/setlocale.h"
+#include "local.h"
 
 /* #ifndef NO_FENV_H */
 /* #include <fenv.h> */
@@ -567,6 +568,21 @@ _strtod_l (struct _reent *ptr, const char *__restrict s00, char **__restrict se,
 			}
 #endif
 		}
+#if defined (_WANT_DTOA_FAST) && !defined (Honor_FLT_ROUNDS) \
+ && !defined (SET_INEXACT)
+	if (Flt_Rounds == 1) {
+		/* Try the first 19 digits without Bigints. */
+		__uint64_t w = 0;
+
+		for(i = 0, s1 = s0; i < nd && i < 19; i++, s1++) {
+			if (i == nd0)
+				s1 += dec_len;
+			w = 10*w + *s1 - '0';
+			}
+		if (__strtod_fast(w, e + nd - i, nd > i, &dval(rv)))
+			goto ret;
+		}
+#endif
 	e1 += nd - k;
 
 #ifdef IEEE_Arith
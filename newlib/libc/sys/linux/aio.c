@@ -2,76 +2,87 @@
 
 /* Copyright 2002, Red Hat Inc. */
 
-/* Currently asynchronous I/O is not implemented. */
+/* Asynchronous I/O needs threads: these stubs are replaced by the
+   implementation in linuxthreads when a program links with it.  */
 
 #define _GNU_SOURCE 1
 
 #include <sys/types.h>
 #include <aio.h>
 #include <errno.h>
+#include <machine/weakalias.h>
 
 int
-aio_cancel (int fd, struct aiocb *cb)
+__libc_aio_cancel (int fd, struct aiocb *cb)
 {
   errno = ENOSYS;
   return -1;
 }
+weak_alias (__libc_aio_cancel, aio_cancel)
 
 int
-aio_error (const struct aiocb *cb)
+__libc_aio_error (const struct aiocb *cb)
 {
   errno = ENOSYS;
   return -1;
 }
+weak_alias (__libc_aio_error, aio_error)
 
 int
-aio_fsync (int op, struct aiocb *cb)
+__libc_aio_fsync (int op, struct aiocb *cb)
 {
   errno = ENOSYS;
   return -1;
 }
+weak_alias (__libc_aio_fsync, aio_fsync)
 
 int
-aio_read (struct aiocb *cb)
+__libc_aio_read (struct aiocb *cb)
 {
   errno = ENOSYS;
   return -1;
 }
+weak_alias (__libc_aio_read, aio_read)
 
 ssize_t
-aio_return (struct aiocb *cb)
+__libc_aio_return (struct aiocb *cb)
 {
   errno = ENOSYS;
   return -1;
 }
+weak_alias (__libc_aio_return, aio_return)
 
 int
-aio_suspend (const struct aiocb *const list[], int nent,
-             const struct timespec *timeout)
+__libc_aio_suspend (const struct aiocb *const list[], int nent,
+                    const struct timespec *timeout)
 {
   errno = ENOSYS;
   return -1;
 }
+weak_alias (__libc_aio_suspend, aio_suspend)
 
 int
-aio_write (struct aiocb *cb)
+__libc_aio_write (struct aiocb *cb)
 {
   errno = ENOSYS;
   return -1;
 }
+weak_alias (__libc_aio_write, aio_write)
 
 int
-lio_listio (int mode, struct aiocb * const list[], int nent,
-            struct sigevent *sig)
+__libc_lio_listio (int mode, struct aiocb * const list[], int nent,
+                   struct sigevent *sig)
 {
   errno = ENOSYS;
   return -1;
 }
+weak_alias (__libc_lio_listio, lio_listio)
 
 #if !defined(_ELIX_LEVEL) || _ELIX_LEVEL >= 4
 void 
-aio_init (const struct aioinit *INIT)
+__libc_aio_init (const struct aioinit *INIT)
 {
   errno = ENOSYS;
 }
+weak_alias (__libc_aio_init, aio_init)
 #endif
@@ -0,0 +1,115 @@
+/* libc/sys/linux/include/aio.h - asynchronous input and output */
+
+/* Copyright (C) 2026 by the newlib contributors. All rights reserved.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#ifndef _AIO_H
+#define _AIO_H
+
+#include <sys/types.h>
+#define __need_sigevent_t 1
+#include <bits/siginfo.h>
+#include <time.h>
+
+/* An asynchronous I/O request.  struct aiocb64 is laid out the same
+   except for the width of aio_offset, so that one implementation
+   serves both.  */
+struct aiocb
+{
+  int aio_fildes;		/* File descriptor.  */
+  int aio_lio_opcode;		/* Operation for lio_listio.  */
+  int aio_reqprio;		/* Request priority offset.  */
+  volatile void *aio_buf;	/* Location of buffer.  */
+  size_t aio_nbytes;		/* Length of transfer.  */
+  struct sigevent aio_sigevent;	/* Completion notification.  */
+
+  /* Used by the implementation.  */
+  int __error_code;
+  ssize_t __return_value;
+
+  off_t aio_offset;		/* File offset.  */
+  char __pad[sizeof (_off64_t) - sizeof (off_t)];
+  char __unused[32];
+};
+
+struct aiocb64
+{
+  int aio_fildes;
+  int aio_lio_opcode;
+  int aio_reqprio;
+  volatile void *aio_buf;
+  size_t aio_nbytes;
+  struct sigevent aio_sigevent;
+
+  int __error_code;
+  ssize_t __return_value;
+
+  _off64_t aio_offset;
+  char __unused[32];
+};
+
+#if !defined(_ELIX_LEVEL) || _ELIX_LEVEL >= 4
+/* Tuning for the aio_* functions.  */
+struct aioinit
+{
+  int aio_threads;		/* Most threads to run requests on.  */
+  int aio_num;			/* Number of requests expected at once.  */
+  int aio_locks;		/* Not used.  */
+  int aio_usedba;		/* Not used.  */
+  int aio_debug;		/* Not used.  */
+  int aio_numusers;		/* Not used.  */
+  int aio_idle_time;		/* Seconds an idle thread waits for work.  */
+  int aio_engine;		/* AIO_ENGINE_*: what runs the requests.  */
+};
+#endif
+
+/* Values of aio_engine.  The default is io_uring where the kernel has
+   it, and the thread pool elsewhere.  */
+#define AIO_ENGINE_DEFAULT	0
+#define AIO_ENGINE_THREADS	1
+#define AIO_ENGINE_URING	2
+
+/* Return values of aio_cancel.  */
+#define AIO_CANCELED	0
+#define AIO_NOTCANCELED	1
+#define AIO_ALLDONE	2
+
+/* Operation codes for aio_lio_opcode.  */
+#define LIO_READ	0
+#define LIO_WRITE	1
+#define LIO_NOP		2
+
+/* Synchronization modes for lio_listio.  */
+#define LIO_WAIT	0
+#define LIO_NOWAIT	1
+
+/* prototypes */
+int aio_read (struct aiocb *__aiocbp);
+int aio_write (struct aiocb *__aiocbp);
+int lio_listio (int __mode, struct aiocb *const __list[], int __nent,
+		struct sigevent *__sig);
+int aio_error (const struct aiocb *__aiocbp);
+ssize_t aio_return (struct aiocb *__aiocbp);
+int aio_cancel (int __fildes, struct aiocb *__aiocbp);
+int aio_suspend (const struct aiocb *const __list[], int __nent,
+		 const struct timespec *__timeout);
+int aio_fsync (int __op, struct aiocb *__aiocbp);
+
+int aio_read64 (struct aiocb64 *__aiocbp);
+int aio_write64 (struct aiocb64 *__aiocbp);
+int lio_listio64 (int __mode, struct aiocb64 *const __list[], int __nent,
+		  struct sigevent *__sig);
+int aio_error64 (const struct aiocb64 *__aiocbp);
+ssize_t aio_return64 (struct aiocb64 *__aiocbp);
+int aio_cancel64 (int __fildes, struct aiocb64 *__aiocbp);
+int aio_suspend64 (const struct aiocb64 *const __list[], int __nent,
+		   const struct timespec *__timeout);
+int aio_fsync64 (int __op, struct aiocb64 *__aiocbp);
+
+#if !defined(_ELIX_LEVEL) || _ELIX_LEVEL >= 4
+void aio_init (const struct aioinit *__init);
+#endif
+
+#endif /* _AIO_H */
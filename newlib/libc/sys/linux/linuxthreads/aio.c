@@ -0,0 +1,826 @@
+/* linuxthreads/aio.c - POSIX asynchronous I/O on a pool of threads */
+
+/* Copyright (C) 2026 by the newlib contributors. All rights reserved.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+/* Requests are queued per file descriptor in the order they are made,
+   and worker threads take them from a run queue and do the I/O.
+   Reads in a row on one descriptor may run at once, since pread64 and
+   pwrite64 leave the file position alone; a write or a sync waits for
+   everything queued on its descriptor before it, and everything after
+   waits for it, so that writes land in order and aio_fsync covers what
+   came before.  Workers are started as requests need them, up to a
+   limit, and leave after a while without work.
+
+   Where the kernel has io_uring, requests that may start go to a ring
+   instead (see aio_uring.c), and one thread waits there for those that
+   do not finish as soon as they are submitted.  Should the ring refuse
+   work with nothing in flight, the workers take over.  aio_init picks
+   either way explicitly.  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include <sysdep.h>
+
+#include "internals.h"
+#include "aio_misc.h"
+
+#ifndef O_DSYNC
+#define O_DSYNC O_SYNC
+#endif
+
+#define FDHASH		64	/* buckets for the descriptor queues */
+#define MAX_THREADS	20	/* default limit on workers */
+#define IDLE_TIME	1	/* default seconds a worker waits for work */
+
+/* The unfinished requests on one descriptor.  Those before PENDING
+   have been dispatched, and ACTIVE of them are running.  */
+struct fdqueue
+{
+  int fd;
+  struct request *head, *tail;
+  struct request *pending;
+  int active;
+  int barrier;			/* a write or a sync is among the active */
+  struct fdqueue *next;		/* in its hash chain */
+};
+
+/* A batch of requests from lio_listio.  */
+struct group
+{
+  int left;			/* requests not finished */
+  int failed;			/* some request failed */
+  int wait;			/* LIO_WAIT: the caller waits and owns it */
+  pid_t pid;
+  struct sigevent sig;		/* LIO_NOWAIT: the notification when done */
+};
+
+struct notice
+{
+  void (*function) (union sigval);
+  union sigval value;
+};
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t done = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t ring = PTHREAD_COND_INITIALIZER;
+
+static struct fdqueue *fdhash[FDHASH];
+static struct request *runhead, *runtail;
+static struct request *freereq;
+
+static int max_threads = MAX_THREADS;
+static int idle_time = IDLE_TIME;
+static int nthreads;		/* workers */
+static int nidle;		/* workers waiting for work */
+static int nwake;		/* of those, ones signalled that have not woken */
+static int nrequests;		/* queued and not finished */
+
+static int want;		/* engine asked for by aio_init */
+static int engine;		/* engine of the requests outstanding */
+static int ring_size;		/* most in flight on the ring; -1: no ring */
+static int inflight;		/* submitted to the ring and not reaped */
+static int reaper;		/* 0: none, 1: idle, 2: waiting on the ring */
+
+static void *worker (void *);
+static void *reap_thread (void *);
+
+static struct fdqueue *
+find_queue (int fd, int create)
+{
+  struct fdqueue **qp, *q;
+
+  for (qp = &fdhash[(unsigned) fd % FDHASH]; (q = *qp) != NULL; qp = &q->next)
+    if (q->fd == fd)
+      return q;
+  if (!create || (q = (struct fdqueue *) malloc (sizeof *q)) == NULL)
+    return NULL;
+  memset (q, 0, sizeof *q);
+  q->fd = fd;
+  *qp = q;
+  return q;
+}
+
+/* Take R off the queue of its descriptor, and free the queue if that
+   leaves it empty.  Return the queue, or NULL if it was freed.  */
+static struct fdqueue *
+unqueue (struct request *r)
+{
+  struct fdqueue *q = r->q, **qp;
+
+  if (r->dispatched)
+    {
+      q->active--;
+      if ((r->op & ~LIO_64) != LIO_READ)
+	q->barrier = 0;
+    }
+  else if (q->pending == r)
+    q->pending = r->next;
+  if (r->prev != NULL)
+    r->prev->next = r->next;
+  else
+    q->head = r->next;
+  if (r->next != NULL)
+    r->next->prev = r->prev;
+  else
+    q->tail = r->prev;
+  if (q->head != NULL)
+    return q;
+
+  for (qp = &fdhash[(unsigned) q->fd % FDHASH]; *qp != q; qp = &(*qp)->next)
+    ;
+  *qp = q->next;
+  free (q);
+  return NULL;
+}
+
+/* Move the requests of Q that may start now to the run queue, and
+   return how many there were.  */
+static int
+dispatch (struct fdqueue *q)
+{
+  struct request *r;
+  int n = 0;
+
+  while ((r = q->pending) != NULL && !q->barrier)
+    {
+      if ((r->op & ~LIO_64) != LIO_READ)
+	{
+	  if (q->active != 0)
+	    break;
+	  q->barrier = 1;
+	}
+      q->pending = r->next;
+      q->active++;
+      r->dispatched = 1;
+      r->run = NULL;
+      if (runtail != NULL)
+	runtail->run = r;
+      else
+	runhead = r;
+      runtail = r;
+      n++;
+    }
+  return n;
+}
+
+/* Find workers for N more requests on the run queue: wake idle ones,
+   and start new ones while under the limit.  Return nonzero if there
+   is no worker at all.  */
+static int
+wake (int n)
+{
+  pthread_attr_t attr;
+  pthread_t id;
+
+  for (; n > 0 && nidle > 0; n--)
+    {
+      nidle--;
+      nwake++;
+      pthread_cond_signal (&work);
+    }
+  if (n > 0 && nthreads < max_threads)
+    {
+      pthread_attr_init (&attr);
+      pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED);
+      for (; n > 0 && nthreads < max_threads; n--)
+	{
+	  if (pthread_create (&id, &attr, worker, NULL) != 0)
+	    break;
+	  nthreads++;
+	}
+      pthread_attr_destroy (&attr);
+    }
+  return nthreads == 0;
+}
+
+/* Pick the engine for requests about to be queued, when none are
+   outstanding.  */
+static void
+choose (void)
+{
+  engine = AIO_ENGINE_THREADS;
+  if (want == AIO_ENGINE_THREADS)
+    return;
+  if (ring_size == 0 && (ring_size = __aio_uring_setup ()) == 0)
+    ring_size = -1;
+  if (ring_size > 0)
+    engine = AIO_ENGINE_URING;
+}
+
+/* Start N more requests from the run queue, on the ring if that is the
+   engine.  Return nonzero if nothing will run them.  */
+static int
+start (int n)
+{
+  struct request *r;
+  int k;
+
+  if (engine == AIO_ENGINE_URING)
+    {
+      k = __aio_uring_submit (runhead, ring_size - inflight);
+      for (inflight += k; k > 0; k--)
+	runhead = runhead->run;
+      if (runhead == NULL)
+	{
+	  runtail = NULL;
+	  return 0;
+	}
+      /* The rest go when something in flight comes back.  */
+      if (inflight > 0)
+	return 0;
+      for (n = 0, r = runhead; r != NULL; r = r->run)
+	n++;
+    }
+  return wake (n);
+}
+
+static void *
+notify_thread (void *arg)
+{
+  struct notice n = *(struct notice *) arg;
+
+  free (arg);
+  n.function (n.value);
+  return NULL;
+}
+
+/* Deliver the notification SIG asks for to process PID.  */
+static void
+notify (const struct sigevent *sig, pid_t pid)
+{
+  pthread_attr_t attr, *ap;
+  struct notice *n;
+  pthread_t id;
+
+  switch (sig->sigev_notify)
+    {
+    case SIGEV_SIGNAL:
+#ifdef __NR_rt_sigqueueinfo
+      {
+	siginfo_t info;
+
+	memset (&info, 0, sizeof (siginfo_t));
+	info.si_signo = sig->sigev_signo;
+	info.si_code = SI_ASYNCIO;
+	info.si_pid = pid;
+	info.si_uid = getuid ();
+	info.si_value = sig->sigev_value;
+
+	INLINE_SYSCALL (rt_sigqueueinfo, 3, pid, info.si_signo, &info);
+      }
+#else
+      kill (pid, sig->sigev_signo);
+#endif
+      break;
+
+    case SIGEV_THREAD:
+      if ((n = (struct notice *) malloc (sizeof *n)) == NULL)
+	break;
+      n->function = sig->sigev_notify_function;
+      n->value = sig->sigev_value;
+      if ((ap = (pthread_attr_t *) sig->sigev_notify_attributes) == NULL)
+	{
+	  ap = &attr;
+	  pthread_attr_init (ap);
+	  pthread_attr_setdetachstate (ap, PTHREAD_CREATE_DETACHED);
+	}
+      if (pthread_create (&id, ap, notify_thread, n) != 0)
+	free (n);
+      if (ap == &attr)
+	pthread_attr_destroy (ap);
+      break;
+    }
+}
+
+/* Record the result of R, which is not on the run queue, notify
+   whoever asked to be, and release R.  The return value is stored
+   before the error code, which aio_error and aio_return read without
+   the lock.  */
+static void
+finish (struct request *r, ssize_t ret, int err)
+{
+  struct aiocb *cb = r->cb;
+  struct group *g = r->group;
+  struct fdqueue *q;
+  int n;
+
+  cb->__return_value = ret;
+  WRITE_MEMORY_BARRIER ();
+  *(volatile int *) &cb->__error_code = err;
+  nrequests--;
+  n = (q = unqueue (r)) != NULL ? dispatch (q) : 0;
+  if (runhead != NULL)
+    start (n);
+
+  /* lio_listio ignores the notifications of the requests it waits for.  */
+  if (g == NULL || !g->wait)
+    notify (&cb->aio_sigevent, r->pid);
+  if (g != NULL)
+    {
+      if (err != 0)
+	g->failed = 1;
+      if (--g->left == 0 && !g->wait)
+	{
+	  notify (&g->sig, g->pid);
+	  free (g);
+	}
+    }
+  pthread_cond_broadcast (&done);
+
+  r->next = freereq;
+  freereq = r;
+}
+
+static ssize_t
+perform (struct request *r, int *errp)
+{
+  struct aiocb *cb = r->cb;
+  _off64_t off;
+  ssize_t ret;
+
+  if (r->op & LIO_64)
+    off = ((struct aiocb64 *) cb)->aio_offset;
+  else
+    off = cb->aio_offset;
+
+  /* The kernel takes the offset as two words, low first.  A pipe or a
+     socket has no offset, and is read or written where it stands.  */
+  switch (r->op & ~LIO_64)
+    {
+    case LIO_READ:
+      ret = INLINE_SYSCALL (pread64, 5, cb->aio_fildes, (void *) cb->aio_buf,
+			    cb->aio_nbytes, (long) off, (long) (off >> 32));
+      if (ret == -1 && errno == ESPIPE)
+	ret = read (cb->aio_fildes, (void *) cb->aio_buf, cb->aio_nbytes);
+      break;
+    case LIO_WRITE:
+      ret = INLINE_SYSCALL (pwrite64, 5, cb->aio_fildes, (void *) cb->aio_buf,
+			    cb->aio_nbytes, (long) off, (long) (off >> 32));
+      if (ret == -1 && errno == ESPIPE)
+	ret = write (cb->aio_fildes, (void *) cb->aio_buf, cb->aio_nbytes);
+      break;
+    case LIO_DSYNC:
+      ret = fdatasync (cb->aio_fildes);
+      break;
+    default:
+      ret = fsync (cb->aio_fildes);
+      break;
+    }
+  *errp = ret == -1 ? errno : 0;
+  return ret;
+}
+
+static void *
+worker (void *arg)
+{
+  struct request *r;
+  struct timeval now;
+  struct timespec until;
+  sigset_t all;
+  ssize_t ret;
+  int err, rc;
+
+  /* Leave signals to the threads of the program.  */
+  sigfillset (&all);
+  pthread_sigmask (SIG_BLOCK, &all, NULL);
+
+  pthread_mutex_lock (&lock);
+  for (;;)
+    {
+      if ((r = runhead) == NULL)
+	{
+	  gettimeofday (&now, NULL);
+	  until.tv_sec = now.tv_sec + idle_time;
+	  until.tv_nsec = now.tv_usec * 1000;
+	  nidle++;
+	  rc = pthread_cond_timedwait (&work, &lock, &until);
+	  /* Whoever signalled took us off the idle count.  */
+	  if (nwake > 0)
+	    nwake--;
+	  else
+	    {
+	      nidle--;
+	      if (rc == ETIMEDOUT && runhead == NULL)
+		break;
+	    }
+	  continue;
+	}
+      if ((runhead = r->run) == NULL)
+	runtail = NULL;
+      pthread_mutex_unlock (&lock);
+      ret = perform (r, &err);
+      pthread_mutex_lock (&lock);
+      finish (r, ret, err);
+    }
+  nthreads--;
+  pthread_mutex_unlock (&lock);
+  return NULL;
+}
+
+/* Finish the requests the ring has completed.  */
+static void
+reap (void)
+{
+  struct request *r, *next;
+
+  for (r = __aio_uring_reap (); r != NULL; r = next)
+    {
+      next = r->run;
+      inflight--;
+      if (r->res < 0)
+	finish (r, -1, -r->res);
+      else
+	finish (r, r->res, 0);
+    }
+}
+
+/* After requests have gone to the ring: finish those that are done
+   already, and see that the reaper waits for the rest.  */
+static void
+settle (void)
+{
+  pthread_attr_t attr;
+  pthread_t id;
+
+  if (inflight == 0)
+    return;
+  reap ();
+  if (inflight == 0 || reaper == 2)
+    return;
+  if (reaper == 1)
+    {
+      reaper = 2;
+      pthread_cond_signal (&ring);
+      return;
+    }
+  pthread_attr_init (&attr);
+  pthread_attr_setdetachstate (&attr, PTHREAD_CREATE_DETACHED);
+  if (pthread_create (&id, &attr, reap_thread, NULL) == 0)
+    reaper = 2;
+  pthread_attr_destroy (&attr);
+}
+
+static void *
+reap_thread (void *arg)
+{
+  struct timeval now;
+  struct timespec until;
+  sigset_t all;
+  int rc;
+
+  sigfillset (&all);
+  pthread_sigmask (SIG_BLOCK, &all, NULL);
+
+  pthread_mutex_lock (&lock);
+  for (;;)
+    {
+      if (inflight == 0)
+	{
+	  gettimeofday (&now, NULL);
+	  until.tv_sec = now.tv_sec + idle_time;
+	  until.tv_nsec = now.tv_usec * 1000;
+	  reaper = 1;
+	  rc = pthread_cond_timedwait (&ring, &lock, &until);
+	  reaper = 2;
+	  if (rc == ETIMEDOUT && inflight == 0)
+	    break;
+	  continue;
+	}
+      pthread_mutex_unlock (&lock);
+      __aio_uring_wait ();
+      pthread_mutex_lock (&lock);
+      reap ();
+    }
+  reaper = 0;
+  pthread_mutex_unlock (&lock);
+  return NULL;
+}
+
+/* Queue CB for operation OP as part of group G.  Called with the
+   lock held.  */
+static int
+enqueue (struct aiocb *cb, int op, struct group *g)
+{
+  struct request *r;
+  struct fdqueue *q;
+  _off64_t off;
+  int n;
+
+  if (op & LIO_64)
+    off = ((struct aiocb64 *) cb)->aio_offset;
+  else
+    off = cb->aio_offset;
+  if (cb->aio_reqprio < 0
+      || (((op & ~LIO_64) == LIO_READ || (op & ~LIO_64) == LIO_WRITE)
+	  && off < 0)
+      || ((g == NULL || !g->wait)
+	  && cb->aio_sigevent.sigev_notify != SIGEV_NONE
+	  && cb->aio_sigevent.sigev_notify != SIGEV_SIGNAL
+	  && cb->aio_sigevent.sigev_notify != SIGEV_THREAD))
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  if ((r = freereq) != NULL)
+    freereq = r->next;
+  else if ((r = (struct request *) malloc (sizeof *r)) == NULL)
+    {
+      errno = EAGAIN;
+      return -1;
+    }
+  if ((q = find_queue (cb->aio_fildes, 1)) == NULL)
+    {
+      r->next = freereq;
+      freereq = r;
+      errno = EAGAIN;
+      return -1;
+    }
+
+  if (nrequests++ == 0)
+    choose ();
+  r->cb = cb;
+  r->op = op;
+  r->dispatched = 0;
+  r->pid = getpid ();
+  r->q = q;
+  r->group = g;
+  r->next = NULL;
+  if ((r->prev = q->tail) != NULL)
+    q->tail->next = r;
+  else
+    q->head = r;
+  q->tail = r;
+  if (q->pending == NULL)
+    q->pending = r;
+  cb->__error_code = EINPROGRESS;
+  cb->__return_value = 0;
+
+  if ((n = dispatch (q)) != 0 && start (n))
+    {
+      /* With no worker and nothing on the ring, nothing else can be
+	 running or on the run queue: R is all there is to take back.  */
+      runhead = runtail = NULL;
+      nrequests--;
+      unqueue (r);
+      r->next = freereq;
+      freereq = r;
+      errno = EAGAIN;
+      return -1;
+    }
+  return 0;
+}
+
+int
+__aio_enqueue (struct aiocb *cb, int op)
+{
+  int rc;
+
+  pthread_mutex_lock (&lock);
+  rc = enqueue (cb, op, NULL);
+  settle ();
+  pthread_mutex_unlock (&lock);
+  return rc;
+}
+
+int
+__aio_listio (int mode, struct aiocb *const list[], int nent,
+	      struct sigevent *sig, int is64)
+{
+  struct group *g, wg;
+  int i, op, failed = 0;
+
+  if ((mode != LIO_WAIT && mode != LIO_NOWAIT) || nent < 0)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  g = NULL;
+  if (mode == LIO_WAIT)
+    {
+      g = &wg;
+      memset (g, 0, sizeof *g);
+      g->wait = 1;
+    }
+  else if (sig != NULL && sig->sigev_notify != SIGEV_NONE)
+    {
+      if ((g = (struct group *) malloc (sizeof *g)) == NULL)
+	{
+	  errno = EAGAIN;
+	  return -1;
+	}
+      memset (g, 0, sizeof *g);
+      g->sig = *sig;
+      g->pid = getpid ();
+    }
+
+  pthread_mutex_lock (&lock);
+  /* Hold the group open until every request is queued.  */
+  if (g != NULL)
+    g->left = 1;
+  for (i = 0; i < nent; i++)
+    {
+      if (list[i] == NULL || (op = list[i]->aio_lio_opcode) == LIO_NOP)
+	continue;
+      if (op != LIO_READ && op != LIO_WRITE)
+	errno = EINVAL;
+      else
+	{
+	  if (g != NULL)
+	    g->left++;
+	  if (enqueue (list[i], op | is64, g) == 0)
+	    continue;
+	  if (g != NULL)
+	    g->left--;
+	}
+      list[i]->__error_code = errno;
+      list[i]->__return_value = -1;
+      failed = 1;
+    }
+
+  /* The whole batch went to the ring in as few calls as it could.  */
+  settle ();
+  if (mode == LIO_WAIT)
+    {
+      g->left--;
+      while (g->left != 0)
+	pthread_cond_wait (&done, &lock);
+      failed |= g->failed;
+    }
+  else if (g != NULL && --g->left == 0)
+    {
+      notify (&g->sig, g->pid);
+      free (g);
+    }
+  pthread_mutex_unlock (&lock);
+
+  if (failed)
+    {
+      errno = EIO;
+      return -1;
+    }
+  return 0;
+}
+
+int
+aio_read (struct aiocb *cb)
+{
+  return __aio_enqueue (cb, LIO_READ);
+}
+
+int
+aio_write (struct aiocb *cb)
+{
+  return __aio_enqueue (cb, LIO_WRITE);
+}
+
+int
+aio_fsync (int op, struct aiocb *cb)
+{
+  if (op != O_SYNC && op != O_DSYNC)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+  return __aio_enqueue (cb, op == O_SYNC ? LIO_SYNC : LIO_DSYNC);
+}
+
+int
+lio_listio (int mode, struct aiocb *const list[], int nent,
+	    struct sigevent *sig)
+{
+  return __aio_listio (mode, list, nent, sig, 0);
+}
+
+/* aio_error and aio_return are async-signal-safe, and are often called
+   from the handler for a request's signal, so they take no lock: the
+   interrupted thread might hold it.  Requests on the ring are finished
+   by the reaper that settle starts when they are queued, or failing
+   that by aio_suspend.  */
+int
+aio_error (const struct aiocb *cb)
+{
+  int err;
+
+  err = *(volatile const int *) &cb->__error_code;
+  READ_MEMORY_BARRIER ();
+  return err;
+}
+
+ssize_t
+aio_return (struct aiocb *cb)
+{
+  READ_MEMORY_BARRIER ();
+  return cb->__return_value;
+}
+
+int
+aio_suspend (const struct aiocb *const list[], int nent,
+	     const struct timespec *timeout)
+{
+  struct timeval now;
+  struct timespec until;
+  int i, timedout = 0;
+
+  if (timeout != NULL)
+    {
+      gettimeofday (&now, NULL);
+      until.tv_sec = now.tv_sec + timeout->tv_sec;
+      until.tv_nsec = now.tv_usec * 1000 + timeout->tv_nsec;
+      if (until.tv_nsec >= 1000000000)
+	{
+	  until.tv_sec++;
+	  until.tv_nsec -= 1000000000;
+	}
+    }
+
+  pthread_mutex_lock (&lock);
+  pthread_cleanup_push ((void (*) (void *)) pthread_mutex_unlock, &lock);
+  for (;;)
+    {
+      settle ();
+      for (i = 0; i < nent; i++)
+	if (list[i] != NULL && list[i]->__error_code != EINPROGRESS)
+	  break;
+      if (i < nent || timedout)
+	break;
+      if (timeout == NULL)
+	pthread_cond_wait (&done, &lock);
+      else
+	timedout = pthread_cond_timedwait (&done, &lock, &until) == ETIMEDOUT;
+    }
+  pthread_cleanup_pop (1);
+
+  if (i == nent)
+    {
+      errno = EAGAIN;
+      return -1;
+    }
+  return 0;
+}
+
+int
+aio_cancel (int fd, struct aiocb *cb)
+{
+  struct fdqueue *q;
+  struct request *r, *prev;
+  int result = AIO_ALLDONE;
+
+  if (fcntl (fd, F_GETFL) == -1)
+    return -1;
+  if (cb != NULL && cb->aio_fildes != fd)
+    {
+      errno = EINVAL;
+      return -1;
+    }
+
+  pthread_mutex_lock (&lock);
+  /* Only requests not yet dispatched can be taken back.  Going from
+     the last, taking one back never lets a later one start.  */
+  if ((q = find_queue (fd, 0)) != NULL)
+    for (r = q->tail; r != NULL; r = prev)
+      {
+	prev = r->prev;
+	if (cb != NULL && r->cb != cb)
+	  continue;
+	if (r->dispatched)
+	  result = AIO_NOTCANCELED;
+	else
+	  {
+	    if (result == AIO_ALLDONE)
+	      result = AIO_CANCELED;
+	    finish (r, -1, ECANCELED);
+	  }
+      }
+  settle ();
+  pthread_mutex_unlock (&lock);
+  return result;
+}
+
+#if !defined(_ELIX_LEVEL) || _ELIX_LEVEL >= 4
+void
+aio_init (const struct aioinit *init)
+{
+  pthread_mutex_lock (&lock);
+  if (init->aio_threads > 0)
+    max_threads = init->aio_threads;
+  if (init->aio_idle_time > 0)
+    idle_time = init->aio_idle_time;
+  /* Taken up once nothing is outstanding.  */
+  if (init->aio_engine >= AIO_ENGINE_DEFAULT
+      && init->aio_engine <= AIO_ENGINE_URING)
+    want = init->aio_engine;
+  pthread_mutex_unlock (&lock);
+}
+#endif
@@ -0,0 +1,64 @@
+/* linuxthreads/aio64.c - POSIX asynchronous I/O with 64-bit offsets */
+
+/* Copyright (C) 2026 by the newlib contributors. All rights reserved.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+/* A struct aiocb64 differs from a struct aiocb only in aio_offset, so
+   everything but reads and writes is done by the aio.c functions.  */
+
+#include <errno.h>
+#include <sys/types.h>
+
+#include "aio_misc.h"
+
+int
+aio_read64 (struct aiocb64 *cb)
+{
+  return __aio_enqueue ((struct aiocb *) cb, LIO_READ | LIO_64);
+}
+
+int
+aio_write64 (struct aiocb64 *cb)
+{
+  return __aio_enqueue ((struct aiocb *) cb, LIO_WRITE | LIO_64);
+}
+
+int
+aio_fsync64 (int op, struct aiocb64 *cb)
+{
+  return aio_fsync (op, (struct aiocb *) cb);
+}
+
+int
+lio_listio64 (int mode, struct aiocb64 *const list[], int nent,
+	      struct sigevent *sig)
+{
+  return __aio_listio (mode, (struct aiocb *const *) list, nent, sig, LIO_64);
+}
+
+int
+aio_error64 (const struct aiocb64 *cb)
+{
+  return aio_error ((const struct aiocb *) cb);
+}
+
+ssize_t
+aio_return64 (struct aiocb64 *cb)
+{
+  return aio_return ((struct aiocb *) cb);
+}
+
+int
+aio_suspend64 (const struct aiocb64 *const list[], int nent,
+	       const struct timespec *timeout)
+{
+  return aio_suspend ((const struct aiocb *const *) list, nent, timeout);
+}
+
+int
+aio_cancel64 (int fd, struct aiocb64 *cb)
+{
+  return aio_cancel (fd, (struct aiocb *) cb);
+}
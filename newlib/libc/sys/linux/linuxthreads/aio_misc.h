@@ -0,0 +1,47 @@
+/* linuxthreads/aio_misc.h - internals of POSIX asynchronous I/O */
+
+/* Copyright (C) 2026 by the newlib contributors. All rights reserved.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+#include <aio.h>
+#include <sys/uio.h>
+
+/* Operations that only aio_fsync queues, after those of <aio.h>.  */
+#define LIO_DSYNC	(LIO_NOP + 1)
+#define LIO_SYNC	(LIO_NOP + 2)
+
+/* Or'ed into an operation whose control block is a struct aiocb64.
+   Only aio_offset differs between the two, so nothing else needs to
+   know.  */
+#define LIO_64		0x100
+
+extern int __aio_enqueue (struct aiocb *, int);
+extern int __aio_listio (int, struct aiocb *const [], int,
+			 struct sigevent *, int);
+
+struct fdqueue;
+struct group;
+
+/* One request, from the time it is queued until it is finished.  */
+struct request
+{
+  struct aiocb *cb;
+  int op;			/* LIO_*, or'ed with LIO_64 */
+  int dispatched;		/* handed to a worker or the ring */
+  pid_t pid;			/* to signal when done */
+  struct fdqueue *q;
+  struct group *group;		/* lio_listio batch, or NULL */
+  struct request *prev, *next;	/* on Q in the order queued */
+  struct request *run;		/* on the run queue, or reaped from the ring */
+  struct iovec iov;		/* what the ring reads or writes */
+  long res;			/* what the ring returned: a count or -errno */
+};
+
+/* The io_uring engine, in aio_uring.c.  All but __aio_uring_wait are
+   called with the lock of aio.c held.  */
+extern int __aio_uring_setup (void);
+extern int __aio_uring_submit (struct request *, int);
+extern struct request *__aio_uring_reap (void);
+extern void __aio_uring_wait (void);
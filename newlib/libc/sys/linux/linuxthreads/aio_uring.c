@@ -0,0 +1,270 @@
+/* linuxthreads/aio_uring.c - POSIX asynchronous I/O through io_uring */
+
+/* Copyright (C) 2026 by the newlib contributors. All rights reserved.
+
+   Permission to use, copy, modify, and distribute this software
+   is freely granted, provided that this notice is preserved.  */
+
+/* Where the kernel has io_uring (Linux 5.1 and later), aio.c hands the
+   requests it dispatches to one ring shared by the process instead of
+   to worker threads: a batch of them costs one system call, and a read
+   the page cache can satisfy is done by the time the call returns, so
+   no thread has to wake up for it.  This file only moves requests in
+   and out of the ring; aio.c still decides what may start, and keeps
+   a thread waiting in the kernel for what does not finish at once.
+
+   The kernel headers of the day do not describe io_uring, so what is
+   used of its interface is spelled out here.  */
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sysdep.h>
+
+#include "internals.h"
+#include "aio_misc.h"
+
+#ifndef __NR_io_uring_setup
+#define __NR_io_uring_setup	425
+#endif
+#ifndef __NR_io_uring_enter
+#define __NR_io_uring_enter	426
+#endif
+
+#define ENTRIES		128	/* submission queue entries asked for */
+
+/* Operations.  */
+#define IORING_OP_READV		1
+#define IORING_OP_WRITEV	2
+#define IORING_OP_FSYNC		3
+
+#define IORING_FSYNC_DATASYNC	1
+#define IORING_ENTER_GETEVENTS	1
+#define IORING_FEAT_SINGLE_MMAP	1
+
+/* Offsets to give mmap for each part of the ring.  */
+#define IORING_OFF_SQ_RING	0L
+#define IORING_OFF_CQ_RING	0x8000000L
+#define IORING_OFF_SQES		0x10000000L
+
+struct uring_sqe
+{
+  unsigned char opcode;
+  unsigned char flags;
+  unsigned short ioprio;
+  int fd;
+  unsigned long long off;
+  unsigned long long addr;
+  unsigned int len;
+  unsigned int op_flags;	/* fsync_flags, rw_flags, ... */
+  unsigned long long user_data;
+  unsigned long long __pad[3];
+};
+
+struct uring_cqe
+{
+  unsigned long long user_data;
+  int res;
+  unsigned int flags;
+};
+
+struct uring_params
+{
+  unsigned int sq_entries;
+  unsigned int cq_entries;
+  unsigned int flags;
+  unsigned int sq_thread_cpu;
+  unsigned int sq_thread_idle;
+  unsigned int features;
+  unsigned int wq_fd;
+  unsigned int resv[3];
+  struct
+  {
+    unsigned int head, tail, ring_mask, ring_entries, flags, dropped, array;
+    unsigned int resv1;
+    unsigned long long resv2;
+  } sq_off;
+  struct
+  {
+    unsigned int head, tail, ring_mask, ring_entries, overflow, cqes, flags;
+    unsigned int resv1;
+    unsigned long long resv2;
+  } cq_off;
+};
+
+static int ringfd = -1;
+static unsigned int sq_entries;
+static volatile unsigned int *sq_head, *sq_tail;
+static unsigned int sq_mask;
+static struct uring_sqe *sqes;
+static volatile unsigned int *cq_head, *cq_tail;
+static unsigned int cq_mask;
+static struct uring_cqe *cqes;
+
+/* Set up the ring, and return how many requests may be in flight on
+   it at once; or 0 if the kernel has no io_uring.  */
+int
+__aio_uring_setup (void)
+{
+  struct uring_params p;
+  unsigned int *array, i;
+  size_t sqsize, cqsize;
+  char *sq, *cq;
+  void *s;
+  int fd, saved = errno;
+
+  memset (&p, 0, sizeof p);
+  if ((fd = INLINE_SYSCALL (io_uring_setup, 2, ENTRIES, &p)) == -1)
+    {
+      errno = saved;
+      return 0;
+    }
+
+  sqsize = p.sq_off.array + p.sq_entries * sizeof (unsigned int);
+  cqsize = p.cq_off.cqes + p.cq_entries * sizeof (struct uring_cqe);
+  if ((p.features & IORING_FEAT_SINGLE_MMAP) && cqsize > sqsize)
+    sqsize = cqsize;
+  sq = mmap (NULL, sqsize, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+	     IORING_OFF_SQ_RING);
+  if (sq == MAP_FAILED)
+    goto fail;
+  if (p.features & IORING_FEAT_SINGLE_MMAP)
+    cq = sq;
+  else if ((cq = mmap (NULL, cqsize, PROT_READ | PROT_WRITE, MAP_SHARED, fd,
+		       IORING_OFF_CQ_RING)) == MAP_FAILED)
+    goto fail_sq;
+  s = mmap (NULL, p.sq_entries * sizeof (struct uring_sqe),
+	    PROT_READ | PROT_WRITE, MAP_SHARED, fd, IORING_OFF_SQES);
+  if (s == MAP_FAILED)
+    goto fail_cq;
+
+  sq_entries = p.sq_entries;
+  sq_head = (unsigned int *) (sq + p.sq_off.head);
+  sq_tail = (unsigned int *) (sq + p.sq_off.tail);
+  sq_mask = *(unsigned int *) (sq + p.sq_off.ring_mask);
+  sqes = (struct uring_sqe *) s;
+  cq_head = (unsigned int *) (cq + p.cq_off.head);
+  cq_tail = (unsigned int *) (cq + p.cq_off.tail);
+  cq_mask = *(unsigned int *) (cq + p.cq_off.ring_mask);
+  cqes = (struct uring_cqe *) (cq + p.cq_off.cqes);
+
+  /* Entry I of the queue is always slot I.  */
+  array = (unsigned int *) (sq + p.sq_off.array);
+  for (i = 0; i < sq_entries; i++)
+    array[i] = i;
+  ringfd = fd;
+  /* Never more in flight than the completion queue holds, so that no
+     completion is dropped on a kernel that would.  */
+  return p.cq_entries;
+
+fail_cq:
+  if (cq != sq)
+    munmap (cq, cqsize);
+fail_sq:
+  munmap (sq, sqsize);
+fail:
+  close (fd);
+  errno = saved;
+  return 0;
+}
+
+static void
+prepare (struct uring_sqe *s, struct request *r)
+{
+  struct aiocb *cb = r->cb;
+
+  memset (s, 0, sizeof *s);
+  s->fd = cb->aio_fildes;
+  s->user_data = (unsigned long) r;
+  switch (r->op & ~LIO_64)
+    {
+    case LIO_READ:
+    case LIO_WRITE:
+      s->opcode = (r->op & ~LIO_64) == LIO_READ ? IORING_OP_READV
+						: IORING_OP_WRITEV;
+      r->iov.iov_base = (void *) cb->aio_buf;
+      r->iov.iov_len = cb->aio_nbytes;
+      s->addr = (unsigned long) &r->iov;
+      s->len = 1;
+      if (r->op & LIO_64)
+	s->off = ((struct aiocb64 *) cb)->aio_offset;
+      else
+	s->off = cb->aio_offset;
+      break;
+    case LIO_DSYNC:
+      s->opcode = IORING_OP_FSYNC;
+      s->op_flags = IORING_FSYNC_DATASYNC;
+      break;
+    default:
+      s->opcode = IORING_OP_FSYNC;
+      break;
+    }
+}
+
+/* Hand the kernel up to MAX requests from the run queue starting at R,
+   all in one call, and return how many it took.  Those it did not take
+   are left off the ring, to be submitted again.  */
+int
+__aio_uring_submit (struct request *r, int max)
+{
+  unsigned int tail = *sq_tail;
+  int n, ret, saved = errno;
+
+  if (max > (int) sq_entries)
+    max = sq_entries;
+  for (n = 0; r != NULL && n < max; r = r->run, n++)
+    prepare (&sqes[(tail + n) & sq_mask], r);
+  if (n == 0)
+    return 0;
+
+  WRITE_MEMORY_BARRIER ();
+  *sq_tail = tail + n;
+  do
+    ret = INLINE_SYSCALL (io_uring_enter, 5, ringfd, n, 0, 0, NULL);
+  while (ret == -1 && errno == EINTR);
+  if (ret < 0)
+    ret = 0;
+  /* Only the submitter moves the tail, and the kernel looks at it only
+     when asked to submit, so what it left can be taken back.  */
+  if (ret < n)
+    *sq_tail = tail + ret;
+  errno = saved;
+  return ret;
+}
+
+/* Take what has completed off the ring, store the result of each
+   request in its RES, and return the requests chained through RUN.  */
+struct request *
+__aio_uring_reap (void)
+{
+  struct request *first, **last, *r;
+  struct uring_cqe *c;
+  unsigned int head = *cq_head, tail = *cq_tail;
+
+  READ_MEMORY_BARRIER ();
+  last = &first;
+  for (; head != tail; head++)
+    {
+      c = &cqes[head & cq_mask];
+      r = (struct request *) (unsigned long) c->user_data;
+      r->res = c->res;
+      *last = r;
+      last = &r->run;
+    }
+  *last = NULL;
+  MEMORY_BARRIER ();
+  *cq_head = head;
+  return first;
+}
+
+/* Wait until something on the ring has completed.  */
+void
+__aio_uring_wait (void)
+{
+  int saved = errno;
+
+  INLINE_SYSCALL (io_uring_enter, 5, ringfd, 0, 1, IORING_ENTER_GETEVENTS,
+		  NULL);
+  errno = saved;
+}
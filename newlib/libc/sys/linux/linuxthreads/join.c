@@ -23,6 +23,11 @@
 #include "spinlock.h"
 #include "restart.h"
 
+#ifndef MALLOC_PROVIDED
+/* Weak, so that programs using another malloc don't pull in ours.  */
+extern void __malloc_tcache_release (struct _reent *) __attribute__ ((weak));
+#endif
+
 void pthread_exit(void * retval)
 {
   __pthread_do_exit (retval, CURRENT_STACK_FRAME);
@@ -40,6 +45,13 @@ void __pthread_do_exit(void *retval, char *currentframe)
   /* Call cleanup functions and destroy the thread-specific data */
   __pthread_perform_cleanup(currentframe);
   __pthread_destroy_specifics();
+#ifndef MALLOC_PROVIDED
+  /* Give back the chunks malloc cached for the thread, after the
+     destructors above have freed theirs.  Nothing reclaims the thread's
+     struct _reent, which goes away with its descriptor.  */
+  if (__malloc_tcache_release)
+    __malloc_tcache_release(THREAD_GETMEM(self, p_reentp));
+#endif
   /* Store return value */
   __pthread_lock(THREAD_GETMEM(self, p_lock), self);
   THREAD_SETMEM(self, p_retval, retval);
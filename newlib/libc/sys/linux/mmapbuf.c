@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Read buffers for stdio streams opened with mode "m".
+
+   Instead of reading into a malloc'd buffer, __srefill_r calls
+   __smapbuf_r, which maps a window of up to WINDOW bytes of the file
+   around the current offset and hands it over as the stream buffer.
+   The descriptor is then moved to the end of the window, just as if
+   read had filled the buffer, so that ftell, fseek and fflush need
+   not know the difference.  When the window is used up the next one
+   replaces it.
+
+   Anything that cannot be mapped, such as a pipe or a terminal, drops
+   back to ordinary reads for good.  So does the part of a stream from
+   fopen64 that lies beyond what an off_t offset to mmap can reach.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <reent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "local.h"
+
+#ifdef _STDIO_MMAP
+
+/* How much of a file is mapped at a time, and the alignment of the
+   windows, a multiple of any page size.  */
+#define WINDOW	(4 * 1024 * 1024)
+#define ALIGN	(64 * 1024)
+
+#ifdef __LARGE64_FILES
+typedef struct stat64 stat_t;
+typedef _fpos64_t pos_t;
+#define FSTAT _fstat64_r
+#else
+typedef struct stat stat_t;
+typedef _fpos_t pos_t;
+#define FSTAT _fstat_r
+#endif
+
+/* Seek FP's descriptor, 64 bits wide if FP came from fopen64.  */
+static pos_t
+_DEFUN(seek, (ptr, fp, off, whence),
+       struct _reent *ptr _AND
+       FILE *fp _AND
+       pos_t off _AND
+       int whence)
+{
+#ifdef __LARGE64_FILES
+  if (fp->_flags & __SL64)
+    return fp->_seek64 (ptr, fp->_cookie, off, whence);
+#endif
+  return fp->_seek (ptr, fp->_cookie, (_fpos_t) off, whence);
+}
+
+static _VOID
+_DEFUN(unmap, (fp),
+       FILE *fp)
+{
+  if (fp->_bf._base != NULL && !(fp->_flags & __SMBF))
+    {
+      munmap (fp->_bf._base, fp->_bf._size);
+      fp->_bf._base = fp->_p = NULL;
+      fp->_bf._size = 0;
+    }
+}
+
+/* Map the window holding the current offset of FP.  Return 0 if that
+   left data in the buffer, EOF at the end of the file, or 1 if FP is
+   to be read as usual from now on.  */
+int
+_DEFUN(__smapbuf_r, (ptr, fp),
+       struct _reent *ptr _AND
+       FILE *fp)
+{
+  stat_t st;
+  pos_t pos, start;
+  size_t len;
+  char *map;
+
+  if (fp->_flags & __SOFF)
+    pos = fp->_offset;
+  else if ((pos = seek (ptr, fp, 0, SEEK_CUR)) == -1)
+    goto nomap;
+  if (FSTAT (ptr, fp->_file, &st) < 0 || !S_ISREG (st.st_mode))
+    goto nomap;
+  if (pos >= st.st_size)
+    {
+      /* Keep the last window for seeks back into it.  */
+      fp->_flags |= __SEOF;
+      return EOF;
+    }
+
+  /* A buffer from an fseek before the first read goes first.  */
+  if (fp->_flags & __SMBF)
+    {
+      _free_r (ptr, fp->_bf._base);
+      fp->_flags &= ~__SMBF;
+      fp->_bf._base = fp->_p = NULL;
+      fp->_bf._size = 0;
+    }
+  unmap (fp);
+
+  start = pos & ~(pos_t) (ALIGN - 1);
+  len = st.st_size - start > WINDOW ? WINDOW : st.st_size - start;
+  if ((off_t) start != start)
+    goto nomap;
+  map = mmap (NULL, len, PROT_READ, MAP_PRIVATE, fp->_file, start);
+  if (map == MAP_FAILED)
+    goto nomap;
+  if (seek (ptr, fp, start + len, SEEK_SET) == -1)
+    {
+      munmap (map, len);
+      goto nomap;
+    }
+  fp->_bf._base = (unsigned char *) map;
+  fp->_bf._size = len;
+  fp->_p = fp->_bf._base + (pos - start);
+  fp->_r = len - (pos - start);
+  return 0;
+
+nomap:
+  __sunmapbuf (fp);
+  return 1;
+}
+
+_VOID
+_DEFUN(__sunmapbuf, (fp),
+       FILE *fp)
+{
+  unmap (fp);
+  fp->_flags2 &= ~__SMAP;
+}
+
+#endif /* _STDIO_MMAP */
@@ -0,0 +1,52 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* The writev counterpart of __swrite and __swrite64, which __sfvwrite_r
+   uses to send a stream's buffer and a large write after it to the
+   descriptor in one system call, without copying the data into the
+   buffer first.  */
+
+#include <stdio.h>
+#include <errno.h>
+#include <unistd.h>
+#include <reent.h>
+#include <sys/uio.h>
+#include "local.h"
+#include "fvwrite.h"
+
+#ifdef _STDIO_WRITEV
+
+_READ_WRITE_RETURN_TYPE
+_DEFUN(__swritev, (ptr, cookie, iov, count),
+       struct _reent *ptr _AND
+       void *cookie _AND
+       _CONST struct __siov *iov _AND
+       int count)
+{
+  register FILE *fp = (FILE *) cookie;
+  ssize_t w;
+
+  if (fp->_flags & __SAPP)
+    {
+#ifdef __LARGE64_FILES
+      if (fp->_flags & __SL64)
+	_lseek64_r (ptr, fp->_file, (_off64_t) 0, SEEK_END);
+      else
+#endif
+      _lseek_r (ptr, fp->_file, (_off_t) 0, SEEK_END);
+    }
+  fp->_flags &= ~__SOFF;	/* in case O_APPEND mode is set */
+
+  /* A struct __siov is laid out as a struct iovec.  */
+  errno = 0;
+  if ((w = writev (fp->_file, (_CONST struct iovec *) iov, count)) == -1
+      && errno != 0)
+    ptr->_errno = errno;
+  return w;
+}
+
+#endif /* _STDIO_WRITEV */
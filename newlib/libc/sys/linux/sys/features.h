@@ -3,11 +3,15 @@
 
 #include <bits/posix_opt.h>
 
-/* We do not support asynchronous I/O.  */
+/* Asynchronous I/O is supported, on threads.  */
 #undef _POSIX_ASYNCHRONOUS_IO
+#define _POSIX_ASYNCHRONOUS_IO 1
 #undef _POSIX_ASYNC_IO
+#define _POSIX_ASYNC_IO 1
 #undef _LFS_ASYNCHRONOUS_IO
+#define _LFS_ASYNCHRONOUS_IO 1
 #undef _LFS64_ASYNCHRONOUS_IO
+#define _LFS64_ASYNCHRONOUS_IO 1
 
 /* POSIX message queues are supported.  */
 #undef	_POSIX_MESSAGE_PASSING
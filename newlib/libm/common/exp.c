@@ -0,0 +1,141 @@
+/* exp.c -- table driven __ieee754_exp.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_exp(x)
+ *
+ *	x = k ln2/N + r with |r| <= ln2/2N and N = 128, so that
+ *	exp(x) = 2^(k/N) exp(r).  2^(k/N) is 2^(k>>7) times a table entry,
+ *	and exp(r) is 1 + r + a polynomial in r of degree 5.  The table
+ *	keeps the low part of each 2^(i/N) so that it is added in with the
+ *	polynomial rather than rounded away.
+ *
+ *	The error is at most 0.511 ulp, and the result is correctly rounded
+ *	for all but a few in a thousand x.  Overflow, underflow, inf and nan
+ *	give what e_exp.c does, with the same exceptions; errno and matherr
+ *	are w_exp.c's business.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define Shift __exp_data.shift
+#define T __exp_data.tab
+#define C2 __exp_data.poly[0]
+#define C3 __exp_data.poly[1]
+#define C4 __exp_data.poly[2]
+#define C5 __exp_data.poly[3]
+
+/* Finish exp(x) where the scale 2^(k/N) is out of the range of normal
+   doubles, or nearly so: tmp is the part of exp(x)/scale - 1 that was
+   computed, sbits the bits of scale and ki holds k.  */
+static NOINLINE double
+specialcase (double_t tmp, uint64_t sbits, uint64_t ki)
+{
+  double_t scale, y;
+
+  if ((ki & 0x80000000) == 0)
+    {
+      /* k > 0: the exponent of scale may overflow.  */
+      sbits -= 1009ull << 52;
+      scale = asdouble (sbits);
+      y = 0x1p1009 * (scale + scale * tmp);
+      return check_oflow (eval_as_double (y));
+    }
+  /* k < 0: take care over results in the subnormal range.  */
+  sbits += 1022ull << 52;
+  scale = asdouble (sbits);
+  y = scale + scale * tmp;
+  if (y < 1.0)
+    {
+      /* Round y to the precision a subnormal has before scaling it down,
+	 not twice: (1 + y) - 1 drops the same bits.  */
+      double_t hi, lo;
+      lo = scale - y + scale * tmp;
+      hi = 1.0 + y;
+      lo = 1.0 - hi + y + lo;
+      y = eval_as_double (hi + lo) - 1.0;
+      /* Avoid -0.0 in downward rounding.  */
+      if (y == 0.0)
+	y = 0.0;
+      /* Underflow is not raised by the exact scaling below.  */
+      force_eval_double (opt_barrier_double (0x1p-1022) * 0x1p-1022);
+    }
+  y = 0x1p-1022 * y;
+  return check_uflow (eval_as_double (y));
+}
+
+/* Top 12 bits of |x| with the sign taken off.  */
+static ALWAYS_INLINE uint32_t
+abstop12 (double x)
+{
+  return top12 (x) & 0x7ff;
+}
+
+double
+__ieee754_exp (double x)
+{
+  uint32_t abstop;
+  uint64_t ki, idx, top, sbits;
+  double_t kd, z, r, r2, scale, tail, tmp;
+
+  abstop = abstop12 (x);
+  if (unlikely (abstop - top12 (0x1p-54) >= top12 (512.0) - top12 (0x1p-54)))
+    {
+      if (abstop - top12 (0x1p-54) >= 0x80000000)
+	/* |x| < 2^-54: exp(x) rounds to 1, inexactly unless x is 0.  */
+	return 1.0 + x;
+      if (abstop >= top12 (1024.0))
+	{
+	  if (asuint64 (x) == asuint64 (-INFINITY))
+	    return 0.0;
+	  if (abstop >= top12 (INFINITY))
+	    return 1.0 + x;
+	  if (asuint64 (x) >> 63)
+	    return __math_uflow (0);
+	  else
+	    return __math_oflow (0);
+	}
+      /* 512 <= |x| < 1024: left to specialcase.  */
+      abstop = 0;
+    }
+
+  /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N), 2^(1/2N)].  */
+  z = InvLn2N * x;
+  /* Round z to the nearest integer k with the shift, which leaves k in
+     the low bits of kd.  */
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd);
+  kd -= Shift;
+  /* x - k ln2/N: the first product is exact and so is the difference.  */
+  r = x + kd * NegLn2hiN + kd * NegLn2loN;
+  /* 2^(k/N) ~= scale * (1 + tail).  */
+  idx = 2 * (ki % N);
+  top = ki << (52 - EXP_TABLE_BITS);
+  tail = asdouble (T[idx]);
+  /* This may overflow the exponent, which specialcase deals with.  */
+  sbits = T[idx + 1] + top;
+  /* exp(x) = scale * (1 + tail) * exp(r)
+	    ~= scale + scale * (tail + exp(r) - 1).  */
+  r2 = r * r;
+  /* Without fma the worst case error is 0.25/N ulp larger.  */
+  tmp = tail + r + r2 * (C2 + r * C3) + r2 * r2 * (C4 + r * C5);
+  if (unlikely (abstop == 0))
+    return specialcase (tmp, sbits, ki);
+  scale = asdouble (sbits);
+  /* Note: tmp == 0 or |tmp| > 2^-200 and scale > 2^-739, so there is no
+     spurious underflow here even without fma.  */
+  return eval_as_double (scale + scale * tmp);
+}
+
+#endif /* !__OBSOLETE_MATH */
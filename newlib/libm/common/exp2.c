@@ -0,0 +1,121 @@
+/* exp2.c -- table driven __ieee754_exp2.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_exp2(x)
+ *
+ *	x = k/N + r with |r| <= 1/2N and N = 128, which is exact, so that
+ *	2^x = 2^(k/N) 2^r, with 2^(k/N) from the table exp shares and 2^r
+ *	a polynomial of degree 5.
+ *
+ *	The error is at most 0.51 ulp.  Overflow, underflow, inf and nan
+ *	raise the exceptions pow(2, x) does; errno and matherr are left to
+ *	w_exp2.c.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << EXP_TABLE_BITS)
+#define Shift __exp_data.exp2_shift
+#define T __exp_data.tab
+#define C1 __exp_data.exp2_poly[0]
+#define C2 __exp_data.exp2_poly[1]
+#define C3 __exp_data.exp2_poly[2]
+#define C4 __exp_data.exp2_poly[3]
+#define C5 __exp_data.exp2_poly[4]
+
+/* As in exp.c.  */
+static NOINLINE double
+specialcase (double_t tmp, uint64_t sbits, uint64_t ki)
+{
+  double_t scale, y;
+
+  if ((ki & 0x80000000) == 0)
+    {
+      /* k > 0: the exponent of scale may overflow.  */
+      sbits -= 1ull << 52;
+      scale = asdouble (sbits);
+      y = 2 * (scale + scale * tmp);
+      return check_oflow (eval_as_double (y));
+    }
+  /* k < 0: take care over results in the subnormal range.  */
+  sbits += 1022ull << 52;
+  scale = asdouble (sbits);
+  y = scale + scale * tmp;
+  if (y < 1.0)
+    {
+      double_t hi, lo;
+      lo = scale - y + scale * tmp;
+      hi = 1.0 + y;
+      lo = 1.0 - hi + y + lo;
+      y = eval_as_double (hi + lo) - 1.0;
+      if (y == 0.0)
+	y = 0.0;
+      force_eval_double (opt_barrier_double (0x1p-1022) * 0x1p-1022);
+    }
+  y = 0x1p-1022 * y;
+  return check_uflow (eval_as_double (y));
+}
+
+static ALWAYS_INLINE uint32_t
+abstop12 (double x)
+{
+  return top12 (x) & 0x7ff;
+}
+
+double
+__ieee754_exp2 (double x)
+{
+  uint32_t abstop;
+  uint64_t ki, idx, top, sbits;
+  double_t kd, r, r2, scale, tail, tmp;
+
+  abstop = abstop12 (x);
+  if (unlikely (abstop - top12 (0x1p-54) >= top12 (512.0) - top12 (0x1p-54)))
+    {
+      if (abstop - top12 (0x1p-54) >= 0x80000000)
+	return 1.0 + x;
+      if (abstop >= top12 (1024.0))
+	{
+	  if (asuint64 (x) == asuint64 (-INFINITY))
+	    return 0.0;
+	  if (abstop >= top12 (INFINITY))
+	    return 1.0 + x;
+	  if (!(asuint64 (x) >> 63))
+	    return __math_oflow (0);
+	  else if (asuint64 (x) >= asuint64 (-1075.0))
+	    return __math_uflow (0);
+	}
+      /* Past 928 either way scale or scale * tmp may be out of the
+	 normal range: leave those to specialcase.  */
+      if (2 * asuint64 (x) > 2 * asuint64 (928.0))
+	abstop = 0;
+    }
+
+  /* x = k/N + r, with the shift rounding x to a multiple of 1/N.  */
+  kd = eval_as_double (x + Shift);
+  ki = asuint64 (kd);
+  kd -= Shift;
+  r = x - kd;
+  /* 2^(k/N) ~= scale * (1 + tail).  */
+  idx = 2 * (ki % N);
+  top = ki << (52 - EXP_TABLE_BITS);
+  tail = asdouble (T[idx]);
+  sbits = T[idx + 1] + top;
+  /* 2^x ~= scale + scale * (tail + 2^r - 1).  */
+  r2 = r * r;
+  tmp = tail + r * C1 + r2 * (C2 + r * C3) + r2 * r2 * (C4 + r * C5);
+  if (unlikely (abstop == 0))
+    return specialcase (tmp, sbits, ki);
+  scale = asdouble (sbits);
+  return eval_as_double (scale + scale * tmp);
+}
+
+#endif /* !__OBSOLETE_MATH */
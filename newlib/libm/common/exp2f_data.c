@@ -0,0 +1,69 @@
+/* exp2f_data.c -- data for expf, exp2f and powf.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+
+const struct exp2f_data __exp2f_data = {
+  /* 2^(i/N) with i/N taken out of its exponent, as in __exp_data.  */
+  .tab = {
+    0x3ff0000000000000,
+    0x3fefd9b0d3158574,
+    0x3fefb5586cf9890f,
+    0x3fef9301d0125b51,
+    0x3fef72b83c7d517b,
+    0x3fef54873168b9aa,
+    0x3fef387a6e756238,
+    0x3fef1e9df51fdee1,
+    0x3fef06fe0a31b715,
+    0x3feef1a7373aa9cb,
+    0x3feedea64c123422,
+    0x3feece086061892d,
+    0x3feebfdad5362a27,
+    0x3feeb42b569d4f82,
+    0x3feeab07dd485429,
+    0x3feea47eb03a5585,
+    0x3feea09e667f3bcd,
+    0x3fee9f75e8ec5f74,
+    0x3feea11473eb0187,
+    0x3feea589994cce13,
+    0x3feeace5422aa0db,
+    0x3feeb737b0cdc5e5,
+    0x3feec49182a3f090,
+    0x3feed503b23e255d,
+    0x3feee89f995ad3ad,
+    0x3feeff76f2fb5e47,
+    0x3fef199bdd85529c,
+    0x3fef3720dcef9069,
+    0x3fef5818dcfba487,
+    0x3fef7c97337b9b5f,
+    0x3fefa4afa2a490da,
+    0x3fefd0765b6e4540,
+  },
+  .shift_scaled = 0x1.8p52 / N,
+  /* 2^r ~= 1 + C2 r + C1 r^2 + C0 r^3 for |r| <= 1/2N, error 2^-33.2.  */
+  .poly = {
+    0x1.c6b184a8f0dacp-5,
+    0x1.ebfce5102b852p-3,
+    0x1.62e42fef5b2a7p-1,
+  },
+  .shift = 0x1.8p52,
+  .invln2_scaled = 0x1.71547652b82fep+5,
+  /* The same for r scaled by N.  */
+  .poly_scaled = {
+    0x1.c6b184a8f0dacp-20,
+    0x1.ebfce5102b852p-13,
+    0x1.62e42fef5b2a7p-6,
+  },
+};
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,82 @@
+/* expf.c -- table driven __ieee754_expf.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_expf(x)
+ *
+ *	Evaluated in double, which leaves room enough for the result to be
+ *	rounded once at the end without the care e_exp.c needs:
+ *	x = k ln2/N + r with N = 32, |r| <= ln2/2N, and
+ *	exp(x) = 2^(k/N) 2^(r/ln2), with 2^(k/N) from a table of doubles
+ *	and 2^(r/ln2) a polynomial of degree 3.
+ *
+ *	The error is at most 0.502 ulp.  Overflow, underflow, inf and nan
+ *	give what ef_exp.c does, with the same exceptions; errno and matherr
+ *	are left to wf_exp.c.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << EXP2F_TABLE_BITS)
+#define InvLn2N __exp2f_data.invln2_scaled
+#define T __exp2f_data.tab
+#define C __exp2f_data.poly_scaled
+#define Shift __exp2f_data.shift
+
+/* Top 12 bits of a float: sign, exponent and 3 bits of mantissa.  */
+static ALWAYS_INLINE uint32_t
+top12f (float x)
+{
+  return asuint (x) >> 20;
+}
+
+float
+__ieee754_expf (float x)
+{
+  uint32_t abstop;
+  uint64_t ki, t;
+  double_t kd, xd, z, r, r2, y, s;
+
+  xd = (double_t) x;
+  abstop = top12f (x) & 0x7ff;
+  if (unlikely (abstop >= top12f (88.0f)))
+    {
+      /* |x| >= 88 or x is nan.  */
+      if (asuint (x) == asuint (-INFINITY))
+	return 0.0f;
+      if (abstop >= top12f (INFINITY))
+	return x + x;
+      if (x > 0x1.62e42ep6f) /* x > log(0x1p128) ~= 88.72 */
+	return __math_oflowf (0);
+      if (x < -0x1.9fe368p6f) /* x < log(0x1p-150) ~= -103.97 */
+	return __math_uflowf (0);
+    }
+
+  /* x N/ln2 = k + r with |r| <= 1/2 and k an integer, rounded with the
+     shift.  */
+  z = InvLn2N * xd;
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd);
+  kd -= Shift;
+  r = z - kd;
+
+  /* exp(x) = 2^(k/N) 2^(r/N) ~= s (C0 r^3 + C1 r^2 + C2 r + 1).  */
+  t = T[ki % N];
+  t += ki << (52 - EXP2F_TABLE_BITS);
+  s = asdouble (t);
+  z = C[0] * r + C[1];
+  r2 = r * r;
+  y = C[2] * r + 1;
+  y = z * r2 + y;
+  y = y * s;
+  return eval_as_float (y);
+}
+
+#endif /* !__OBSOLETE_MATH */
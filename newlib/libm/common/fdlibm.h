@@ -12,6 +12,11 @@
  */
 
 /* REDHAT LOCAL: Include files.  */
+/* libm's own definitions of the functions with vector versions are not
+   to be cloned into more of them.  */
+#ifndef __DECL_SIMD
+#define __DECL_SIMD
+#endif
 #include <math.h>
 #include <sys/types.h>
 #include <machine/ieeefp.h>
@@ -137,6 +142,31 @@
 
 #define X_TLOSS		1.41484755040568800000e+16 
 
+/* The w_*.c wrappers call the __ieee754_* function and then make one
+   test, on its result or its arguments, that holds in all of their
+   error cases and seldom otherwise.  Only when it holds do they call
+   the code that looks at _LIB_VERSION, sets errno and calls matherr,
+   which is in a function of its own so that a call without an error
+   runs none of it.
+
+   With --disable-newlib-matherr (_MATH_ERRNO_ONLY in newlib.h) errors
+   are reported as _POSIX_ has them, through errno alone: _LIB_VERSION
+   reads as _POSIX_ in libm whatever a program sets it to, and matherr
+   is never called.  exp, exp2, log, log2 and pow and their float
+   versions then set errno themselves in __math_oflow and friends
+   (__MATH_ERRNO_IN_KERNEL), and their wrappers only call them.  */
+
+#ifdef _MATH_ERRNO_ONLY
+#undef _LIB_VERSION
+#define _LIB_VERSION _POSIX_
+#endif
+
+#if defined (_MATH_ERRNO_ONLY) && !__OBSOLETE_MATH
+#define __MATH_ERRNO_IN_KERNEL 1
+#else
+#define __MATH_ERRNO_IN_KERNEL 0
+#endif
+
 /* Functions that are not documented, and are not in <math.h>.  */
 
 #ifdef _SCALB_INT
@@ -178,6 +208,10 @@ extern double __ieee754_scalb __P((double,int));
 #else
 extern double __ieee754_scalb __P((double,double));
 #endif
+#if !__OBSOLETE_MATH
+extern double __ieee754_exp2 __P((double));
+extern double __ieee754_log2 __P((double));
+#endif
 
 /* fdlibm kernel function */
 extern double __kernel_standard __P((double,double,int));
@@ -224,6 +258,10 @@ extern float __ieee754_scalbf __P((float,int));
 #else
 extern float __ieee754_scalbf __P((float,float));
 #endif
+#if !__OBSOLETE_MATH
+extern float __ieee754_exp2f __P((float));
+extern float __ieee754_log2f __P((float));
+#endif
 
 /* float versions of fdlibm kernel functions */
 extern float __kernel_sinf __P((float,float,int));
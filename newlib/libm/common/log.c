@@ -0,0 +1,131 @@
+/* log.c -- table driven __ieee754_log.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_log(x)
+ *
+ *	x = 2^k z with z in [0x1.6p-1, 0x1.6p0), split into N = 128
+ *	intervals.  For the interval z is in, the table gives c near z and
+ *	log(c), and
+ *
+ *		log(x) = k ln2 + log(c) + log1p(z/c - 1)
+ *
+ *	where |z/c - 1| < 0x1.fe1p-9, so that a polynomial of degree 6 is
+ *	enough for log1p.  k ln2 + log(c) + z/c - 1 is kept in two doubles
+ *	so that its rounding errors don't add up.  Near 1 that would lose
+ *	too much to cancellation, and log1p(x - 1) comes from a polynomial
+ *	of degree 12 instead, its leading terms again in two doubles.
+ *
+ *	The error is at most 0.519 ulp, or 0.535 without fma.  log(0),
+ *	log(x < 0), inf and nan give what e_log.c does, with the same
+ *	exceptions; errno and matherr are left to w_log.c.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define T __log_data.tab
+#define T2 __log_data.tab2
+#define B __log_data.poly1
+#define A __log_data.poly
+#define Ln2hi __log_data.ln2hi
+#define Ln2lo __log_data.ln2lo
+#define N (1 << LOG_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+
+/* Top 16 bits of a double.  */
+static ALWAYS_INLINE uint32_t
+top16 (double x)
+{
+  return asuint64 (x) >> 48;
+}
+
+double
+__ieee754_log (double x)
+{
+  double_t w, z, r, r2, r3, y, invc, logc, logctail, kd, hi, lo;
+  uint64_t ix, iz, tmp;
+  uint32_t top;
+  int k, i;
+
+  ix = asuint64 (x);
+  top = top16 (x);
+#define LO asuint64 (1.0 - 0x1p-4)
+#define HI asuint64 (1.0 + 0x1.09p-4)
+  if (unlikely (ix - LO < HI - LO))
+    {
+      /* x is near 1: log1p(r) = r - r^2/2 + r^3 p(r), with r = x - 1
+	 exact and r - r^2/2 worked out in two parts.  */
+      if (ix == asuint64 (1.0))
+	return 0;
+      r = x - 1.0;
+      r2 = r * r;
+      r3 = r * r2;
+      y = r3 * (B[1] + r * B[2] + r2 * B[3]
+		+ r3 * (B[4] + r * B[5] + r2 * B[6]
+			+ r3 * (B[7] + r * B[8] + r2 * B[9] + r3 * B[10])));
+      /* r^2 = rhi^2 + rlo (rhi + r), the first exact.  */
+      w = r * 0x1p27;
+      double_t rhi = r + w - w;
+      double_t rlo = r - rhi;
+      w = rhi * rhi * B[0]; /* B[0] == -0.5.  */
+      hi = r + w;
+      lo = r - hi + w;
+      lo += B[0] * rlo * (rhi + r);
+      y += lo;
+      y += hi;
+      return eval_as_double (y);
+    }
+  if (unlikely (top - 0x0010 >= 0x7ff0 - 0x0010))
+    {
+      /* x < 0x1p-1022 or inf or nan.  */
+      if (ix * 2 == 0)
+	return __math_divzero (1);
+      if (ix == asuint64 (INFINITY))
+	return x;
+      if ((top & 0x8000) || (top & 0x7ff0) == 0x7ff0)
+	return __math_invalid (x);
+      /* x is subnormal: normalize it.  */
+      ix = asuint64 (x * 0x1p52);
+      ix -= 52ULL << 52;
+    }
+
+  /* x = 2^k z, with z in [OFF, 2 OFF) exact and the interval for z given
+     by the top bits of its mantissa.  */
+  tmp = ix - OFF;
+  i = (tmp >> (52 - LOG_TABLE_BITS)) % N;
+  k = (int64_t) tmp >> 52; /* Arithmetic shift.  */
+  iz = ix - (tmp & 0xfffULL << 52);
+  invc = T[i].invc;
+  logc = T[i].logc;
+  logctail = T[i].logctail;
+  z = asdouble (iz);
+
+  /* r = z/c - 1, rounded once.  */
+#if __FP_FAST_FMA
+  r = __builtin_fma (z, invc, -1.0);
+#else
+  /* z - c is exact, and the error in z - chi - clo is below 2^-66.  */
+  r = (z - T2[i].chi - T2[i].clo) * invc;
+#endif
+  kd = (double_t) k;
+
+  /* hi + lo = k ln2 + log(c) + r; k ln2hi + logc is exact.  */
+  w = kd * Ln2hi + logc;
+  hi = w + r;
+  lo = w - hi + r + kd * Ln2lo + logctail;
+
+  /* log(x) = lo + r^2 p(r) + hi.  */
+  r2 = r * r;
+  y = lo + r2 * A[0]
+      + r * r2 * (A[1] + r * A[2] + r2 * (A[3] + r * A[4])) + hi;
+  return eval_as_double (y);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,138 @@
+/* log2.c -- table driven __ieee754_log2.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_log2(x)
+ *
+ *	As log.c, with N = 64 intervals and
+ *
+ *		log2(x) = k + log2(c) + log1p(z/c - 1)/ln2
+ *
+ *	where |z/c - 1| < 0x1.fc1p-8 and the polynomial has degree 7.
+ *	k + log2(c) + r/ln2 is kept in two doubles.  Near 1, where
+ *	|log2(x)| < 2^-4, log1p(x - 1)/ln2 is a polynomial of degree 11.
+ *
+ *	The error is at most 0.547 ulp, or 0.59 ulp without fma.  log2(0), log2(x < 0), inf and nan
+ *	raise the exceptions log does; errno and matherr are left to
+ *	s_log2.c.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define T __log2_data.tab
+#define T2 __log2_data.tab2
+#define B __log2_data.poly1
+#define A __log2_data.poly
+#define InvLn2hi __log2_data.invln2hi
+#define InvLn2lo __log2_data.invln2lo
+#define N (1 << LOG2_TABLE_BITS)
+#define OFF 0x3fe6000000000000
+
+static ALWAYS_INLINE uint32_t
+top16 (double x)
+{
+  return asuint64 (x) >> 48;
+}
+
+double
+__ieee754_log2 (double x)
+{
+  double_t z, r, r2, r4, y, invc, logc, logctail, kd, hi, lo, t1, t2, t3, p;
+  uint64_t ix, iz, tmp;
+  uint32_t top;
+  int k, i;
+
+  ix = asuint64 (x);
+  top = top16 (x);
+  /* |log2(x)| < 2^-4.  */
+#define LO asuint64 (1.0 - 0x1.5b51p-5)
+#define HI asuint64 (1.0 + 0x1.6ab2p-5)
+  if (unlikely (ix - LO < HI - LO))
+    {
+      /* x is near 1: log2(x) = r/ln2 + r^2 p(r) with r = x - 1 exact,
+	 r/ln2 in two parts and the first two terms of r^2 p(r) added
+	 to them with their rounding error kept.  */
+      if (ix == asuint64 (1.0))
+	return 0;
+      r = x - 1.0;
+#if __FP_FAST_FMA
+      hi = r * InvLn2hi;
+      lo = r * InvLn2lo + __builtin_fma (r, InvLn2hi, -hi);
+#else
+      double_t rhi, rlo;
+      rhi = asdouble (asuint64 (r) & -1ULL << 32);
+      rlo = r - rhi;
+      hi = rhi * InvLn2hi;
+      lo = rlo * InvLn2hi + r * InvLn2lo;
+#endif
+      r2 = r * r;
+      r4 = r2 * r2;
+      p = r2 * (B[0] + r * B[1]);
+      y = hi + p;
+      lo += hi - y + p;
+      lo += r4 * (B[2] + r * B[3] + r2 * (B[4] + r * B[5])
+		  + r4 * (B[6] + r * B[7] + r2 * (B[8] + r * B[9])));
+      y += lo;
+      return eval_as_double (y);
+    }
+  if (unlikely (top - 0x0010 >= 0x7ff0 - 0x0010))
+    {
+      /* x < 0x1p-1022 or inf or nan.  */
+      if (ix * 2 == 0)
+	return __math_divzero (1);
+      if (ix == asuint64 (INFINITY))
+	return x;
+      if ((top & 0x8000) || (top & 0x7ff0) == 0x7ff0)
+	return __math_invalid (x);
+      /* x is subnormal: normalize it.  */
+      ix = asuint64 (x * 0x1p52);
+      ix -= 52ULL << 52;
+    }
+
+  /* x = 2^k z, as in log.c.  */
+  tmp = ix - OFF;
+  i = (tmp >> (52 - LOG2_TABLE_BITS)) % N;
+  k = (int64_t) tmp >> 52; /* Arithmetic shift.  */
+  iz = ix - (tmp & 0xfffULL << 52);
+  invc = T[i].invc;
+  logc = T[i].logc;
+  logctail = T[i].logctail;
+  z = asdouble (iz);
+  kd = (double_t) k;
+
+  /* t1 + t2 = r/ln2 with r = z/c - 1.  */
+#if __FP_FAST_FMA
+  r = __builtin_fma (z, invc, -1.0);
+  t1 = r * InvLn2hi;
+  t2 = r * InvLn2lo + __builtin_fma (r, InvLn2hi, -t1);
+#else
+  double_t rhi, rlo;
+  r = (z - T2[i].chi - T2[i].clo) * invc;
+  /* The top 21 bits of r times the 32 bits of InvLn2hi is exact.  */
+  rhi = asdouble (asuint64 (r) & -1ULL << 32);
+  rlo = r - rhi;
+  t1 = rhi * InvLn2hi;
+  t2 = rlo * InvLn2hi + r * InvLn2lo;
+#endif
+
+  /* hi + lo = k + log2(c) + r/ln2; k + logc is exact.  */
+  t3 = kd + logc;
+  hi = t3 + t1;
+  lo = t3 - hi + t1 + t2 + logctail;
+
+  /* log2(x) = lo + r^2 p(r) + hi.  */
+  r2 = r * r;
+  r4 = r2 * r2;
+  p = A[0] + r * A[1] + r2 * (A[2] + r * A[3]) + r4 * (A[4] + r * A[5]);
+  y = lo + r2 * p + hi;
+  return eval_as_double (y);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,186 @@
+/* log2_data.c -- data for log2.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << LOG2_TABLE_BITS)
+
+const struct log2_data __log2_data = {
+  /* 1/ln2 in two parts, the first with 32 bits so that its product with
+     the top 21 bits of r is exact.  */
+  .invln2hi = 0x1.7154765200000p+0,
+  .invln2lo = 0x1.705fc2eefa200p-33,
+  /* log2(1+r) - r/ln2 ~= A0 r^2 + ... + A5 r^7 for |r| <= 0x1.fc1p-8,
+     error 2^-65.1.  */
+  .poly = {
+    -0x1.71547652b833fp-1,
+    0x1.ec709dc3a04fcp-2,
+    -0x1.7154764646272p-2,
+    0x1.2776c4fdb8ca6p-2,
+    -0x1.ec7b86d55df6ep-3,
+    0x1.a6232492b1888p-3,
+  },
+  /* log2(1+r) - r/ln2 ~= B0 r^2 + ... + B9 r^11 for -0x1.5b51p-5 <= r
+     <= 0x1.6ab2p-5, relative error 2^-58.9.  */
+  .poly1 = {
+    -0x1.71547652b82fep-1,
+    0x1.ec709dc3a0400p-2,
+    -0x1.71547652b6df7p-2,
+    0x1.2776c50ef6915p-2,
+    -0x1.ec709de2e4453p-3,
+    0x1.a61762dd03d1ep-3,
+    -0x1.7153ded9c810ep-3,
+    0x1.484a4b78428edp-3,
+    -0x1.28b76576068e8p-3,
+    0x1.0df667e5b1083p-3,
+  },
+  /* For the ith of N intervals of the mantissa z in [0x1.6p-1, 0x1.6p0),
+     invc is near the inverse of its midpoint c, so that |z invc - 1| is
+     at most 0x1.fc1p-8, and logc + logctail is -log2(invc) with logc a
+     multiple of 2^-42, so that k + logc is exact.  */
+  .tab = {
+    {0x1.724287f46debcp+0, -0x1.1096015dee800p-1, 0x1.9319741831906p-44},
+    {0x1.6e1f76b4337c7p+0, -0x1.08494c66b9000p-1, 0x1.0fd3cc96a0334p-45},
+    {0x1.6a13cd1537290p+0, -0x1.0014332be0000p-1, -0x1.90c4d0a037194p-48},
+    {0x1.661ec6a5122f9p+0, -0x1.efec61b012000p-2, 0x1.eaa9ef284dd7ap-48},
+    {0x1.623fa77016240p+0, -0x1.dfdd89d587000p-2, 0x1.d384e5450a273p-46},
+    {0x1.5e75bb8d015e7p+0, -0x1.cffae611ad000p-2, -0x1.29dfe9c1273e8p-46},
+    {0x1.5ac056b015ac0p+0, -0x1.c043859e30000p-2, 0x1.26faeb9870946p-45},
+    {0x1.571ed3c506b3ap+0, -0x1.b0b67f4f47000p-2, 0x1.fb9dbf0f15d38p-44},
+    {0x1.5390948f40febp+0, -0x1.a152f14298000p-2, -0x1.b4cfd5a5dcc0ap-46},
+    {0x1.5015015015015p+0, -0x1.921800924e000p-2, 0x1.62432a1b8df74p-45},
+    {0x1.4cab88725af6ep+0, -0x1.8304d90c12000p-2, 0x1.76e920adfced4p-49},
+    {0x1.49539e3b2d067p+0, -0x1.7418acebbf000p-2, -0x1.8f186a6fadac0p-46},
+    {0x1.460cbc7f5cf9ap+0, -0x1.6552b49986000p-2, -0x1.3b76178bb02fep-45},
+    {0x1.42d6625d51f87p+0, -0x1.56b22e6b58000p-2, 0x1.c6c6171b2fa20p-44},
+    {0x1.3fb013fb013fbp+0, -0x1.48365e695d000p-2, -0x1.e5a9190c091c3p-44},
+    {0x1.3c995a47babe7p+0, -0x1.39de8e155a000p-2, 0x1.237c7293baa42p-47},
+    {0x1.3991c2c187f63p+0, -0x1.2baa0c34be000p-2, -0x1.eaec3d71e7f26p-46},
+    {0x1.3698df3de0748p+0, -0x1.1d982c9d52000p-2, -0x1.c28c69c8cd8b4p-44},
+    {0x1.33ae45b57bcb2p+0, -0x1.0fa848044b000p-2, -0x1.a8cf3ca9f66ecp-45},
+    {0x1.30d190130d190p+0, -0x1.01d9bbcfa6000p-2, -0x1.d4014d477b552p-46},
+    {0x1.2e025c04b8097p+0, -0x1.e857d3d362000p-3, 0x1.9309b4d2ea851p-44},
+    {0x1.2b404ad012b40p+0, -0x1.cd3c712d32000p-3, 0x1.df360962d7abap-44},
+    {0x1.288b01288b013p+0, -0x1.b2602497d6000p-3, 0x1.96b9cb373ea67p-44},
+    {0x1.25e22708092f1p+0, -0x1.97c1cb13c8000p-3, 0x1.403e8aac06e6ap-47},
+    {0x1.23456789abcdfp+0, -0x1.7d60496cfc000p-3, 0x1.2ce913d7a8274p-45},
+    {0x1.20b470c67c0d9p+0, -0x1.633a8bf438000p-3, 0x1.8d1132dead902p-46},
+    {0x1.1e2ef3b3fb874p+0, -0x1.494f863b8e000p-3, 0x1.9bf3ae26c3ae5p-48},
+    {0x1.1bb4a4046ed29p+0, -0x1.2f9e32d5c0000p-3, 0x1.17b8b6c4f846cp-46},
+    {0x1.19453808ca29cp+0, -0x1.162593186e000p-3, 0x1.641a832290aa7p-45},
+    {0x1.16e0689427379p+0, -0x1.f9c95dc1d0000p-4, -0x1.1669fc6ff5757p-44},
+    {0x1.1485f0e0acd3bp+0, -0x1.c7b528b710000p-4, 0x1.c8789e9cc33bep-45},
+    {0x1.12358e75d3033p+0, -0x1.960caf9abc000p-4, 0x1.07dfeac8150f4p-45},
+    {0x1.0fef010fef011p+0, -0x1.64ce26c068000p-4, 0x1.d526958ec10f4p-45},
+    {0x1.0db20a88f4696p+0, -0x1.33f7cde14c000p-4, -0x1.ec5700a3ac0ecp-45},
+    {0x1.0b7e6ec259dc8p+0, -0x1.0387efbca8000p-4, -0x1.a9c04aafcd99fp-46},
+    {0x1.0953f39010954p+0, -0x1.a6f9c377e0000p-5, 0x1.6719bc9348fccp-44},
+    {0x1.073260a47f7c6p+0, -0x1.47aa073578000p-5, 0x1.f87e4a9cc7787p-46},
+    {0x1.05197f7d73404p+0, -0x1.d23afc4910000p-6, -0x1.cf8b293af6f1ep-45},
+    {0x1.03091b51f5e1ap+0, -0x1.16a21e20a0000p-6, -0x1.451d3b4618d0dp-47},
+    {0x1.0101010101010p+0, -0x1.720d9c06c0000p-8, 0x1.7cb86e584c321p-44},
+    {0x1.fc07f01fc07f0p-1, 0x1.6fe50b6f00000p-7, -0x1.ef45eb9c2b748p-44},
+    {0x1.f44659e4a4271p-1, 0x1.11cd1d5130000p-5, 0x1.a0d857e2f4b23p-44},
+    {0x1.ecc07b301ecc0p-1, 0x1.c4dfab90a8000p-5, 0x1.5b53fce557fd4p-44},
+    {0x1.e573ac901e574p-1, 0x1.3aa2fdd280000p-4, -0x1.c823f46e8a2bep-45},
+    {0x1.de5d6e3f8868ap-1, 0x1.918a16e464000p-4, -0x1.943c8ca69647ap-45},
+    {0x1.d77b654b82c34p-1, 0x1.e72ec117fc000p-4, -0x1.a534c3f05dc57p-44},
+    {0x1.d0cb58f6ec074p-1, 0x1.1dcd197552000p-3, 0x1.6f9439c7771b3p-44},
+    {0x1.ca4b3055ee191p-1, 0x1.476a9f9840000p-3, -0x1.1658678e6180cp-44},
+    {0x1.c3f8f01c3f8f0p-1, 0x1.70742d4ef0000p-3, 0x1.3ff1352c1219dp-46},
+    {0x1.bdd2b899406f7p-1, 0x1.98edd077e8000p-3, -0x1.e3e197764e85fp-44},
+    {0x1.b7d6c3dda338bp-1, 0x1.c0db6cdd94000p-3, 0x1.bdec2d8d41273p-44},
+    {0x1.b2036406c80d9p-1, 0x1.e840be74e6000p-3, 0x1.499a6a92f0f67p-44},
+    {0x1.ac5701ac5701bp-1, 0x1.0790adbb03000p-2, 0x1.14a11d368c134p-51},
+    {0x1.a6d01a6d01a6dp-1, 0x1.1ac05b291f000p-2, 0x1.c161471580a9bp-48},
+    {0x1.a16d3f97a4b02p-1, 0x1.2db10fc4da000p-2, -0x1.5477e8443f5aap-44},
+    {0x1.9c2d14ee4a102p-1, 0x1.406463b1b0000p-2, 0x1.1203fa482900bp-44},
+    {0x1.970e4f80cb872p-1, 0x1.52dbdfc4c9000p-2, 0x1.ad4ffb9446bc1p-44},
+    {0x1.920fb49d0e229p-1, 0x1.6518fe4678000p-2, -0x1.166dab4a3f474p-44},
+    {0x1.8d3018d3018d3p-1, 0x1.771d2ba7f0000p-2, -0x1.310572b05468cp-44},
+    {0x1.886e5f0abb04ap-1, 0x1.88e9c72e0b000p-2, 0x1.120861019d27bp-45},
+    {0x1.83c977ab2beddp-1, 0x1.9a802391e2000p-2, 0x1.97e845877c94ap-45},
+    {0x1.7f405fd017f40p-1, 0x1.abe18797f2000p-2, -0x1.6b5a0e2eafde1p-47},
+    {0x1.7ad2208e0ecc3p-1, 0x1.bd0f2e9e79000p-2, 0x1.8fa19b322660ep-49},
+    {0x1.767dce434a9b1p-1, 0x1.ce0a4923a6000p-2, -0x1.e0cc3768fdf36p-44},
+  },
+#if !__FP_FAST_FMA
+  /* chi + clo is 1/invc, for z - 1/invc to be nearly exact.  */
+  .tab2 = {
+    {0x1.6200000000000p-1, 0x1.6200000000000p-59},
+    {0x1.6600000000000p-1, -0x1.9df0000000000p-56},
+    {0x1.6a00000000000p-1, 0x1.0f80000000000p-55},
+    {0x1.6e00000000000p-1, 0x1.6e00000000000p-61},
+    {0x1.7200000000000p-1, -0x1.7200000000000p-55},
+    {0x1.7600000000000p-1, 0x1.8788000000000p-55},
+    {0x1.7a00000000000p-1, 0x1.7a00000000000p-55},
+    {0x1.7e00000000000p-1, -0x1.a1d0000000000p-55},
+    {0x1.8200000000000p-1, -0x1.0358000000000p-55},
+    {0x1.8600000000000p-1, 0x1.8600000000000p-61},
+    {0x1.8a00000000001p-1, -0x1.d5effffffffffp-55},
+    {0x1.8e00000000000p-1, -0x1.a6e0000000000p-57},
+    {0x1.9200000000000p-1, 0x1.1460000000000p-56},
+    {0x1.9600000000000p-1, -0x1.49e0000000000p-57},
+    {0x1.9a00000000000p-1, 0x1.9a00000000000p-61},
+    {0x1.9e00000000000p-1, 0x1.63c8000000000p-55},
+    {0x1.a200000000000p-1, 0x1.25e8000000000p-55},
+    {0x1.a5fffffffffffp-1, 0x1.bbc0000000001p-55},
+    {0x1.aa00000000000p-1, -0x1.5a20000000000p-56},
+    {0x1.ae00000000000p-1, 0x1.ae00000000000p-57},
+    {0x1.b200000000000p-1, 0x1.b200000000000p-61},
+    {0x1.b600000000000p-1, 0x1.b600000000000p-55},
+    {0x1.b9fffffffffffp-1, 0x1.38a8000000001p-55},
+    {0x1.be00000000000p-1, 0x1.d9e0000000000p-57},
+    {0x1.c200000000000p-1, 0x1.c200000000000p-61},
+    {0x1.c5fffffffffffp-1, 0x1.08f8000000001p-55},
+    {0x1.ca00000000000p-1, 0x1.ad60000000000p-55},
+    {0x1.ce00000000000p-1, 0x1.ce00000000000p-61},
+    {0x1.d200000000000p-1, 0x1.d200000000000p-59},
+    {0x1.d600000000000p-1, -0x1.1710000000000p-56},
+    {0x1.da00000000001p-1, -0x1.3197fffffffffp-55},
+    {0x1.de00000000001p-1, -0x1.1c97fffffffffp-55},
+    {0x1.e200000000000p-1, -0x1.e200000000000p-61},
+    {0x1.e5fffffffffffp-1, 0x1.17d0000000001p-55},
+    {0x1.e9fffffffffffp-1, 0x1.c780000000003p-56},
+    {0x1.ee00000000000p-1, -0x1.7280000000000p-57},
+    {0x1.f200000000001p-1, -0x1.8e5fffffffffdp-56},
+    {0x1.f600000000000p-1, 0x1.39c0000000000p-56},
+    {0x1.fa00000000001p-1, -0x1.974ffffffffffp-55},
+    {0x1.fe00000000000p-1, 0x1.fe00000000000p-57},
+    {0x1.0200000000000p+0, 0x1.0200000000000p-56},
+    {0x1.0600000000000p+0, 0x1.7070000000000p-55},
+    {0x1.0a00000000000p+0, 0x1.0a00000000000p-54},
+    {0x1.0e00000000000p+0, -0x1.7340000000000p-55},
+    {0x1.1200000000000p+0, 0x1.4560000000000p-55},
+    {0x1.1600000000000p+0, -0x1.04a0000000000p-54},
+    {0x1.1a00000000000p+0, 0x1.ed80000000000p-56},
+    {0x1.1e00000000000p+0, 0x1.1e00000000000p-60},
+    {0x1.2200000000000p+0, 0x1.2200000000000p-56},
+    {0x1.2600000000000p+0, 0x1.8b10000000000p-55},
+    {0x1.2a00000000000p+0, 0x1.d1a0000000000p-56},
+    {0x1.2e00000000000p+0, 0x1.2e00000000000p-60},
+    {0x1.3200000000000p+0, -0x1.4eb0000000000p-55},
+    {0x1.3600000000000p+0, 0x1.3600000000000p-60},
+    {0x1.3a00000000000p+0, -0x1.1c90000000000p-54},
+    {0x1.3e00000000000p+0, -0x1.3410000000000p-54},
+    {0x1.4200000000000p+0, 0x1.8870000000000p-54},
+    {0x1.4600000000000p+0, -0x1.1310000000000p-55},
+    {0x1.4a00000000000p+0, 0x1.4a00000000000p-60},
+    {0x1.4e00000000000p+0, -0x1.6d50000000000p-54},
+    {0x1.5200000000000p+0, 0x1.1d30000000000p-55},
+    {0x1.5600000000000p+0, 0x1.5600000000000p-54},
+    {0x1.5a00000000000p+0, 0x1.3428000000000p-54},
+    {0x1.5e00000000000p+0, 0x1.5e00000000000p-60},
+  },
+#endif
+};
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,78 @@
+/* log2f.c -- table driven __ieee754_log2f.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_log2f(x)
+ *
+ *	As logf.c, with
+ *
+ *		log2(x) = k + log2(c) + log1p(z/c - 1)/ln2
+ *
+ *	and a polynomial of degree 4 for log1p(r)/ln2.
+ *
+ *	The error is at most 0.75 ulp.  log2f(0), log2f(x < 0), inf and nan
+ *	raise the exceptions logf does; errno and matherr are left to
+ *	sf_log2.c.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define T __log2f_data.tab
+#define A __log2f_data.poly
+#define N (1 << LOG2F_TABLE_BITS)
+#define OFF 0x3f330000
+
+float
+__ieee754_log2f (float x)
+{
+  double_t z, r, r2, p, y, y0, invc, logc;
+  uint32_t ix, iz, tmp;
+  int k, i;
+
+  ix = asuint (x);
+  if (ix == 0x3f800000)
+    return 0;
+  if (unlikely (ix - 0x00800000 >= 0x7f800000 - 0x00800000))
+    {
+      /* x < 0x1p-126 or inf or nan.  */
+      if (ix * 2 == 0)
+	return __math_divzerof (1);
+      if (ix == 0x7f800000) /* log2(inf) == inf.  */
+	return x;
+      if ((ix & 0x80000000) || ix * 2 >= 0xff000000)
+	return __math_invalidf (x);
+      /* x is subnormal: normalize it.  */
+      ix = asuint (x * 0x1p23f);
+      ix -= 23 << 23;
+    }
+
+  /* x = 2^k z, as in logf.c.  */
+  tmp = ix - OFF;
+  i = (tmp >> (23 - LOG2F_TABLE_BITS)) % N;
+  k = (int32_t) tmp >> 23; /* Arithmetic shift.  */
+  iz = ix - (tmp & 0xff800000);
+  invc = T[i].invc;
+  logc = T[i].logc;
+  z = (double_t) asfloat (iz);
+
+  /* log2(x) = log1p(z/c - 1)/ln2 + log2(c) + k.  */
+  r = z * invc - 1;
+  y0 = logc + (double_t) k;
+
+  /* Pipelined evaluation of the polynomial for log1p(r)/ln2.  */
+  r2 = r * r;
+  y = A[1] * r + A[2];
+  y = A[0] * r2 + y;
+  p = A[3] * r + y0;
+  y = y * r2 + p;
+  return eval_as_float (y);
+}
+
+#endif /* !__OBSOLETE_MATH */
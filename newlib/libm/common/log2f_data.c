@@ -0,0 +1,54 @@
+/* log2f_data.c -- data for log2f and powf.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << LOG2F_TABLE_BITS)
+
+const struct log2f_data __log2f_data = {
+  /* As for logf, with logc = -log2(invc).  */
+  .tab = {
+    {0x1.661ec6a5122f9p+0, -0x1.efec61b011f85p-2},
+    {0x1.571ed3c506b3ap+0, -0x1.b0b67f4f46812p-2},
+    {0x1.49539e3b2d067p+0, -0x1.7418acebbf18fp-2},
+    {0x1.3c995a47babe7p+0, -0x1.39de8e1559f6ep-2},
+    {0x1.30d190130d190p+0, -0x1.01d9bbcfa61d4p-2},
+    {0x1.25e22708092f1p+0, -0x1.97c1cb13c7ec0p-3},
+    {0x1.1bb4a4046ed29p+0, -0x1.2f9e32d5bfdd1p-3},
+    {0x1.12358e75d3033p+0, -0x1.960caf9abb7c1p-4},
+    {0x1.0953f39010954p+0, -0x1.a6f9c377dd31dp-5},
+    {0x1.0000000000000p+0, 0x0.0p+0},
+    {0x1.e573ac901e574p-1, 0x1.3aa2fdd27f1bfp-4},
+    {0x1.ca4b3055ee191p-1, 0x1.476a9f983f74dp-3},
+    {0x1.b2036406c80d9p-1, 0x1.e840be74e6a4dp-3},
+    {0x1.9c2d14ee4a102p-1, 0x1.406463b1b0448p-2},
+    {0x1.886e5f0abb04ap-1, 0x1.88e9c72e0b224p-2},
+    {0x1.767dce434a9b1p-1, 0x1.ce0a4923a587dp-2},
+  },
+  /* log2(1+r) ~= A3 r + A2 r^2 + A1 r^3 + A0 r^4, fitted as for logf:
+     at most 0.25 ulp before rounding.  */
+  .poly = {
+    -0x1.72b672d808b9ap-2,
+    0x1.ecab9aa6468dcp-2,
+    -0x1.7154665a11bb8p-1,
+    0x1.715475f934c5bp+0,
+  },
+  /* The same to r^5 for powf, relative error 2^-31.4.  */
+  .powf_poly = {
+    0x1.27ca053e03a7dp-2,
+    -0x1.7199d1e89d3ddp-2,
+    0x1.ec70950e7f5cep-2,
+    -0x1.7154745ecb094p-1,
+    0x1.71547652c1d7bp+0,
+  },
+};
+
+#endif /* !__OBSOLETE_MATH */
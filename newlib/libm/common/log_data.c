@@ -0,0 +1,314 @@
+/* log_data.c -- data for log.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << LOG_TABLE_BITS)
+
+const struct log_data __log_data = {
+  /* ln2 in two parts, the first a multiple of 2^-42 like tab[i].logc so
+     that k*ln2hi + logc is exact.  */
+  .ln2hi = 0x1.62e42fefa3800p-1,
+  .ln2lo = 0x1.ef35793c76730p-45,
+  /* log(1+r) - r ~= A0 r^2 + ... + A4 r^6 for |r| <= 0x1.fe1p-9, error
+     2^-64.1.  */
+  .poly = {
+    -0x1.0000000000001p-1,
+    0x1.555555550b26ap-2,
+    -0x1.fffffffebc74cp-3,
+    0x1.999b49de60030p-3,
+    -0x1.5557617f3ca7ep-3,
+  },
+  /* log(1+r) - r ~= B0 r^2 + ... + B10 r^12 for -0x1p-4 <= r <= 0x1.09p-4,
+     relative error 2^-61.5 for the part after B0 r^2, B0 being -0.5.  */
+  .poly1 = {
+    -0x1.0000000000000p-1,
+    0x1.5555555555577p-2,
+    -0x1.ffffffffffe02p-3,
+    0x1.999999995d344p-3,
+    -0x1.5555555656a9ap-3,
+    0x1.24924a36378d6p-3,
+    -0x1.fffffae74c195p-4,
+    0x1.c7183ddea2d9ap-4,
+    -0x1.999e00948ae50p-4,
+    0x1.781a1ddf65d6bp-4,
+    -0x1.556646d818bc6p-4,
+  },
+  /* For the ith of N intervals of the mantissa z in [0x1.6p-1, 0x1.6p0),
+     invc is near the inverse of its midpoint c, so that |z invc - 1| is
+     at most 0x1.fe1p-9, and logc + logctail is -log(invc) with logc a
+     multiple of 2^-42.  */
+  .tab = {
+    {0x1.734f0c541fe8dp+0, -0x1.7cc7f7db47000p-2, 0x1.7c61c38023cdcp-44},
+    {0x1.713786d9c7c09p+0, -0x1.76feecb947000p-2, -0x1.75b19c9852c57p-46},
+    {0x1.6f26016f26017p+0, -0x1.713e33a46a000p-2, -0x1.7bc12617e9472p-46},
+    {0x1.6d1a62681c861p+0, -0x1.6b85b4cffa000p-2, -0x1.fe6e50d372503p-45},
+    {0x1.6b1490aa31a3dp+0, -0x1.65d558d4ce000p-2, -0x1.558fd2dc5bdc0p-51},
+    {0x1.691473a88d0c0p+0, -0x1.602d08af09000p-2, -0x1.ec69176df3f65p-46},
+    {0x1.6719f3601671ap+0, -0x1.5a8cadbbee000p-2, 0x1.7be9b0af7ecf8p-48},
+    {0x1.6524f853b4aa3p+0, -0x1.54f431b7be000p-2, -0x1.a7ef4c0910952p-46},
+    {0x1.63356b88ac0dep+0, -0x1.4f637ebbaa000p-2, 0x1.fc168cb3124b9p-44},
+    {0x1.614b36831ae94p+0, -0x1.49da7f3bcc000p-2, -0x1.07f134daf4b9ap-44},
+    {0x1.5f66434292dfcp+0, -0x1.44591e053a000p-2, 0x1.6de5892923d88p-47},
+    {0x1.5d867c3ece2a5p+0, -0x1.3edf463c17000p-2, 0x1.f08e4297f2c3fp-44},
+    {0x1.5babcc647fa91p+0, -0x1.396ce359bc000p-2, 0x1.5a15c5663663dp-47},
+    {0x1.59d61f123ccaap+0, -0x1.3401e12aed000p-2, 0x1.17f03556e291dp-44},
+    {0x1.5805601580560p+0, -0x1.2e9e2bce12000p-2, -0x1.42e0c128d1dc2p-45},
+    {0x1.56397ba7c52e2p+0, -0x1.2941afb187000p-2, 0x1.20fd2b730e28bp-44},
+    {0x1.54725e6bb82fep+0, -0x1.23ec5991ec000p-2, 0x1.6dbf448a2e522p-44},
+    {0x1.52aff56a8054bp+0, -0x1.1e9e16788a000p-2, 0x1.82ba6d3c8b65ep-44},
+    {0x1.50f22e111c4c5p+0, -0x1.1956d3b9bc000p-2, -0x1.7c8873ad1aa14p-45},
+    {0x1.4f38f62dd4c9bp+0, -0x1.14167ef367000p-2, -0x1.e11ef824daaf5p-44},
+    {0x1.4d843bedc2c4cp+0, -0x1.0edd060b78000p-2, -0x1.044b52d8435f5p-47},
+    {0x1.4bd3edda68fe1p+0, -0x1.09aa572e6c000p-2, -0x1.b51f9e1734342p-44},
+    {0x1.4a27fad76014ap+0, -0x1.047e60cde8000p-2, -0x1.dba110d397f3cp-45},
+    {0x1.4880522014880p+0, -0x1.feb2233ea0000p-3, -0x1.f2c18de00938bp-45},
+    {0x1.46dce34596066p+0, -0x1.f474b134e0000p-3, 0x1.bb019f1df7b5ep-44},
+    {0x1.453d9e2c776cap+0, -0x1.ea4449f04a000p-3, -0x1.5e90663732a36p-44},
+    {0x1.43a2730abee4dp+0, -0x1.e020cc6236000p-3, 0x1.52df0adb91424p-45},
+    {0x1.420b5265e5951p+0, -0x1.d60a17f904000p-3, 0x1.5d8a86fc20d39p-44},
+    {0x1.40782d10e6566p+0, -0x1.cc000c9db4000p-3, 0x1.d6e985d57aff9p-46},
+    {0x1.3ee8f42a5af07p+0, -0x1.c2028ab180000p-3, 0x1.92a3ee55c7ac6p-45},
+    {0x1.3d5d991aa75c6p+0, -0x1.b811730b82000p-3, -0x1.e9e283b9cd768p-46},
+    {0x1.3bd60d9232955p+0, -0x1.ae2ca6f672000p-3, -0x1.7af2dae54f550p-44},
+    {0x1.3a524387ac822p+0, -0x1.a454082e6a000p-3, -0x1.60587c81f7171p-44},
+    {0x1.38d22d366088ep+0, -0x1.9a8778deba000p-3, -0x1.4744a3efec390p-44},
+    {0x1.3755bd1c945eep+0, -0x1.90c6db9fcc000p-3, 0x1.929357718d7cap-46},
+    {0x1.35dce5f9f2af8p+0, -0x1.871213750e000p-3, -0x1.3272b42f9af75p-44},
+    {0x1.34679ace01346p+0, -0x1.7d6903caf6000p-3, 0x1.4cd0b17c301d7p-45},
+    {0x1.32f5ced6a1dfap+0, -0x1.73cb9074fe000p-3, 0x1.d66b90d0005a6p-44},
+    {0x1.3187758e9ebb6p+0, -0x1.6a399dabbe000p-3, 0x1.8f944e66a15a6p-44},
+    {0x1.301c82ac40260p+0, -0x1.60b3100b0a000p-3, 0x1.71756c988f814p-44},
+    {0x1.2eb4ea1fed14bp+0, -0x1.5737cc9018000p-3, -0x1.9b97fa6b887f6p-44},
+    {0x1.2d50a012d50a0p+0, -0x1.4dc7b897bc000p-3, -0x1.c71b60ae1ff0fp-47},
+    {0x1.2bef98e5a3711p+0, -0x1.4462b9dc9c000p-3, 0x1.84830a711b062p-44},
+    {0x1.2a91c92f3c105p+0, -0x1.3b08b67580000p-3, 0x1.ab150f29320fbp-44},
+    {0x1.293725bb804a5p+0, -0x1.31b994d3a4000p-3, -0x1.f0b76e3a50810p-44},
+    {0x1.27dfa38a1ce4dp+0, -0x1.28753bc11a000p-3, -0x1.74346359302e6p-44},
+    {0x1.268b37cd60127p+0, -0x1.1f3b925f26000p-3, 0x1.5ddee9b083633p-46},
+    {0x1.2539d7e9177b2p+0, -0x1.160c8024b2000p-3, -0x1.ebfb2a9009e3dp-45},
+    {0x1.23eb79717605bp+0, -0x1.0ce7ecdccc000p-3, -0x1.4588dabff5447p-46},
+    {0x1.22a0122a0122ap+0, -0x1.03cdc0a51e000p-3, -0x1.81a8cf169fc5cp-44},
+    {0x1.21579804855e6p+0, -0x1.f57bc7d900000p-4, -0x1.76a2c9ea8b04ep-46},
+    {0x1.2012012012012p+0, -0x1.e3707ee304000p-4, -0x1.0f664e6766abdp-45},
+    {0x1.1ecf43c7fb84cp+0, -0x1.d179788218000p-4, -0x1.36193b5efbeedp-44},
+    {0x1.1d8f5672e4abdp+0, -0x1.bf968769fc000p-4, -0x1.42f7c8d824283p-45},
+    {0x1.1c522fc1ce059p+0, -0x1.adc77ee5b0000p-4, 0x1.5718a09c31904p-44},
+    {0x1.1b17c67f2bae3p+0, -0x1.9c0c32d4d4000p-4, 0x1.ab3589e838668p-44},
+    {0x1.19e0119e0119ep+0, -0x1.8a6477a91c000p-4, -0x1.c28b0af9bd6dfp-44},
+    {0x1.18ab083902bdbp+0, -0x1.78d02263d8000p-4, -0x1.6bb9794b69fb7p-47},
+    {0x1.1778a191bd684p+0, -0x1.674f089364000p-4, -0x1.a78394c9d3302p-44},
+    {0x1.1648d50fc3201p+0, -0x1.55e10050e0000p-4, -0x1.c13340c53c72ep-47},
+    {0x1.151b9a3fdd5c9p+0, -0x1.4485e03dbc000p-4, -0x1.fb04ee8d26ab7p-44},
+    {0x1.13f0e8d344724p+0, -0x1.333d7f8184000p-4, 0x1.6c6b6a81b8848p-49},
+    {0x1.12c8b89edc0acp+0, -0x1.2207b5c784000p-4, -0x1.4a16cfc10c7bfp-44},
+    {0x1.11a3019a74826p+0, -0x1.10e45b3cb0000p-4, 0x1.7d699284a3465p-44},
+    {0x1.107fbbe011080p+0, -0x1.ffa6911ab8000p-5, -0x1.3088c98381a8fp-45},
+    {0x1.0f5edfab325a2p+0, -0x1.dda8adc680000p-5, 0x1.1a74c64d9e42fp-45},
+    {0x1.0e40655826011p+0, -0x1.bbcebfc690000p-5, 0x1.7b8e68c317c2ap-46},
+    {0x1.0d24456359e3ap+0, -0x1.9a187b5740000p-5, 0x1.0bf7e4ec4d90dp-44},
+    {0x1.0c0a7868b4171p+0, -0x1.788595a358000p-5, 0x1.06fed083b3a4cp-46},
+    {0x1.0af2f722eecb5p+0, -0x1.5715c4c040000p-5, 0x1.88f55dfc47628p-44},
+    {0x1.09ddba6af8360p+0, -0x1.35c8bfaa10000p-5, -0x1.8347d5ef9eb35p-44},
+    {0x1.08cabb37565e2p+0, -0x1.149e3e4008000p-5, 0x1.2b99a9a4168fdp-44},
+    {0x1.07b9f29b8eae2p+0, -0x1.e72bf28140000p-6, 0x1.8cb3149774d47p-45},
+    {0x1.06ab59c7912fbp+0, -0x1.a55f548c60000p-6, 0x1.dec609f2d03c9p-45},
+    {0x1.059eea0727586p+0, -0x1.63d6178690000p-6, -0x1.77b7389596542p-47},
+    {0x1.04949cc1664c5p+0, -0x1.228fb1fea0000p-6, -0x1.70513284991fep-45},
+    {0x1.038c6b78247fcp+0, -0x1.c317384c80000p-7, 0x1.41e53fcefb9fep-44},
+    {0x1.02864fc7729e9p+0, -0x1.41929f9680000p-7, -0x1.9862755d01368p-46},
+    {0x1.0182436517a37p+0, -0x1.8121214580000p-8, -0x1.ac06382973f27p-46},
+    {0x1.0080402010080p+0, -0x1.0040155d80000p-9, 0x1.3bf10c7cc7089p-44},
+    {0x1.fe01fe01fe020p-1, 0x1.ff00aa2b00000p-9, 0x1.0ba04a086b56ap-45},
+    {0x1.fa11caa01fa12p-1, 0x1.7dc475f820000p-7, -0x1.eb2d45b5da1f5p-44},
+    {0x1.f6310aca0dbb5p-1, 0x1.3cea443470000p-6, -0x1.69f0c32d6a40bp-44},
+    {0x1.f25f644230ab5p-1, 0x1.b9fc027b00000p-6, -0x1.b99990ae6922ap-44},
+    {0x1.ee9c7f8458e02p-1, 0x1.1b0d989240000p-5, -0x1.340ae9ae889bbp-44},
+    {0x1.eae807aba01ebp-1, 0x1.58a5bafc90000p-5, -0x1.b2d039570ad39p-45},
+    {0x1.e741aa59750e4p-1, 0x1.95c830ec90000p-5, -0x1.c0dc297c5feb8p-45},
+    {0x1.e3a9179dc1a73p-1, 0x1.d276b8adb0000p-5, 0x1.6ac83c78a64b0p-46},
+    {0x1.e01e01e01e01ep-1, 0x1.0759835990000p-4, -0x1.b8ebfe4b59987p-44},
+    {0x1.dca01dca01dcap-1, 0x1.253f62f0a0000p-4, 0x1.41708fb69a701p-44},
+    {0x1.d92f2231e7f8ap-1, 0x1.42edcbea64000p-4, 0x1.bb6aeea7c9acdp-46},
+    {0x1.d5cac807572b2p-1, 0x1.60658a9374000p-4, 0x1.0c3c1dee9c4f8p-44},
+    {0x1.d272ca3fc5b1ap-1, 0x1.7da766d7b0000p-4, 0x1.2d0344480c89bp-44},
+    {0x1.cf26e5c44bfc6p-1, 0x1.9ab4246204000p-4, -0x1.8a46826787061p-45},
+    {0x1.cbe6d9601cbe7p-1, 0x1.b78c82bb10000p-4, -0x1.2604fbc3987e7p-44},
+    {0x1.c8b265afb8a42p-1, 0x1.d4313d66cc000p-4, -0x1.9452379135713p-45},
+    {0x1.c5894d10d4986p-1, 0x1.f0a30c0118000p-4, -0x1.d5bce83368e91p-44},
+    {0x1.c26b5392ea01cp-1, 0x1.0671512ca6000p-3, -0x1.a44979cdc0a3dp-45},
+    {0x1.bf583ee868d8bp-1, 0x1.1478584674000p-3, 0x1.560651027c750p-46},
+    {0x1.bc4fd65883e7bp-1, 0x1.2266f190a6000p-3, -0x1.4cddab840e7f6p-45},
+    {0x1.b951e2b18ff23p-1, 0x1.303d718e48000p-3, -0x1.5b6b5ce3ecb05p-50},
+    {0x1.b65e2e3beee05p-1, 0x1.3dfc2b0ecc000p-3, 0x1.8a9ba62b8c13fp-45},
+    {0x1.b37484ad806cep-1, 0x1.4ba36f39a6000p-3, -0x1.436fbb3f219e5p-44},
+    {0x1.b094b31d922a4p-1, 0x1.59338d9982000p-3, 0x1.0ac68b7555d4ap-48},
+    {0x1.adbe87f94905ep-1, 0x1.66acd4272a000p-3, 0x1.aa1cdbfc6c785p-44},
+    {0x1.aaf1d2f87ebfdp-1, 0x1.740f8f5404000p-3, -0x1.0b9a499018aa1p-44},
+    {0x1.a82e65130e159p-1, 0x1.815c0a1436000p-3, -0x1.02dbaf9201ce8p-44},
+    {0x1.a574107688a4ap-1, 0x1.8e928de886000p-3, 0x1.a8224b13d72d5p-44},
+    {0x1.a2c2a87c51ca0p-1, 0x1.9bb362e7e0000p-3, -0x1.1eca8a1ce0ffcp-45},
+    {0x1.a01a01a01a01ap-1, 0x1.a8becfc882000p-3, 0x1.e3195cf21b9cfp-44},
+    {0x1.9d79f176b682dp-1, 0x1.b5b519e8fc000p-3, -0x1.4b4eaec011f31p-44},
+    {0x1.9ae24ea5510dap-1, 0x1.c2968558c2000p-3, -0x1.cf7d3dee38a40p-45},
+    {0x1.9852f0d8ec0ffp-1, 0x1.cf6354e09c000p-3, 0x1.775339a07d55bp-45},
+    {0x1.95cbb0be377aep-1, 0x1.dc1bca0abe000p-3, 0x1.8f671a628ccc6p-44},
+    {0x1.934c67f9b2ce6p-1, 0x1.e8c0252aa6000p-3, -0x1.6803b80e8e6ffp-45},
+    {0x1.90d4f120190d5p-1, 0x1.f550a564b8000p-3, -0x1.32513a09202fep-45},
+    {0x1.8e6527af1373fp-1, 0x1.00e6c45ad5000p-2, 0x1.cd88d52e01203p-50},
+    {0x1.8bfce8062ff3ap-1, 0x1.071b85fcd6000p-2, -0x1.bcb7ba3e01a11p-44},
+    {0x1.899c0f601899cp-1, 0x1.0d46b579ab000p-2, 0x1.d2d21f640e1e6p-44},
+    {0x1.87427bcc092b9p-1, 0x1.136870293b000p-2, -0x1.d3f3c99d67123p-44},
+    {0x1.84f00c2780614p-1, 0x1.1980d2dd42000p-2, 0x1.b75fa7a361c9ap-45},
+    {0x1.82a4a0182a4a0p-1, 0x1.1f8ff9e48a000p-2, 0x1.7966c040cbe77p-45},
+    {0x1.8060180601806p-1, 0x1.2596010df7000p-2, 0x1.8e7cc224ea3e3p-44},
+    {0x1.7e225515a4f1dp-1, 0x1.2b9303ab8a000p-2, -0x1.6d8c2d6bfb0a5p-45},
+    {0x1.7beb3922e017cp-1, 0x1.31871c9544000p-2, 0x1.84c2b94cecfd9p-46},
+    {0x1.79baa6bb6398bp-1, 0x1.3772662bfe000p-2, -0x1.e8f7eac53b023p-44},
+    {0x1.77908119ac60dp-1, 0x1.3d54fa5c1f000p-2, 0x1.c4054d9a395e3p-44},
+    {0x1.756cac201756dp-1, 0x1.432ef2a04f000p-2, -0x1.fb4c1931715adp-44},
+  },
+#if !__FP_FAST_FMA
+  /* chi + clo is 1/invc, for z - 1/invc to be nearly exact.  */
+  .tab2 = {
+    {0x1.6100000000000p-1, -0x1.2c9a000000000p-55},
+    {0x1.6300000000000p-1, -0x1.5522000000000p-55},
+    {0x1.6500000000000p-1, -0x1.a7f0000000000p-58},
+    {0x1.6700000000000p-1, -0x1.3a20000000000p-59},
+    {0x1.6900000000000p-1, -0x1.c340000000000p-60},
+    {0x1.6b00000000000p-1, -0x1.6b00000000000p-56},
+    {0x1.6d00000000000p-1, -0x1.9aa0000000000p-58},
+    {0x1.6f00000000000p-1, 0x1.dbf4000000000p-56},
+    {0x1.7100000000000p-1, 0x1.7100000000000p-61},
+    {0x1.7300000000000p-1, -0x1.6768000000000p-55},
+    {0x1.7500000000000p-1, -0x1.0070000000000p-56},
+    {0x1.7700000000000p-1, 0x1.c32c000000000p-56},
+    {0x1.7900000000000p-1, 0x1.5e7e000000000p-55},
+    {0x1.7b00000000000p-1, 0x1.e598000000000p-56},
+    {0x1.7d00000000000p-1, 0x1.7d00000000000p-57},
+    {0x1.7f00000000000p-1, -0x1.6710000000000p-57},
+    {0x1.8100000000000p-1, 0x1.8100000000000p-61},
+    {0x1.8300000000000p-1, -0x1.2546000000000p-55},
+    {0x1.8500000000000p-1, 0x1.fb86000000001p-55},
+    {0x1.86fffffffffffp-1, 0x1.beaa000000001p-55},
+    {0x1.88fffffffffffp-1, 0x1.efe8000000001p-55},
+    {0x1.8b00000000000p-1, -0x1.0964000000000p-56},
+    {0x1.8d00000000000p-1, 0x1.8098000000000p-56},
+    {0x1.8f00000000000p-1, 0x1.8f00000000000p-55},
+    {0x1.9100000000000p-1, 0x1.6b68000000000p-56},
+    {0x1.9300000000000p-1, 0x1.9300000000000p-61},
+    {0x1.9500000000000p-1, 0x1.296c000000000p-56},
+    {0x1.9700000000000p-1, 0x1.6a7c000000000p-56},
+    {0x1.9900000000000p-1, 0x1.ff40000000000p-59},
+    {0x1.9b00000000000p-1, -0x1.87bc000000000p-56},
+    {0x1.9d00000000000p-1, -0x1.62ec000000000p-55},
+    {0x1.9efffffffffffp-1, 0x1.6dd6000000001p-55},
+    {0x1.a100000000001p-1, -0x1.fd43fffffffffp-55},
+    {0x1.a300000000000p-1, -0x1.5afc000000000p-55},
+    {0x1.a500000000000p-1, -0x1.4f7c000000000p-55},
+    {0x1.a700000000000p-1, 0x1.7220000000000p-56},
+    {0x1.a900000000001p-1, -0x1.614bfffffffffp-55},
+    {0x1.ab00000000000p-1, 0x1.ab00000000000p-61},
+    {0x1.ad00000000000p-1, 0x1.ad00000000000p-61},
+    {0x1.af00000000000p-1, 0x1.4340000000000p-55},
+    {0x1.b100000000000p-1, 0x1.f4a8000000000p-57},
+    {0x1.b300000000000p-1, 0x1.b300000000000p-57},
+    {0x1.b500000000000p-1, -0x1.1120000000000p-59},
+    {0x1.b700000000000p-1, 0x1.75d6000000000p-55},
+    {0x1.b900000000000p-1, -0x1.a454000000000p-56},
+    {0x1.bb00000000001p-1, -0x1.6409fffffffffp-55},
+    {0x1.bcfffffffffffp-1, 0x1.3e42000000001p-55},
+    {0x1.bf00000000000p-1, 0x1.5d38000000000p-56},
+    {0x1.c100000000000p-1, 0x1.624a000000000p-55},
+    {0x1.c300000000000p-1, 0x1.c300000000000p-61},
+    {0x1.c500000000000p-1, 0x1.c500000000000p-61},
+    {0x1.c700000000000p-1, 0x1.c700000000000p-61},
+    {0x1.c900000000000p-1, 0x1.2be8000000000p-55},
+    {0x1.cafffffffffffp-1, 0x1.c0ac000000003p-56},
+    {0x1.cd00000000000p-1, -0x1.f104000000000p-56},
+    {0x1.cf00000000000p-1, -0x1.fe05fffffffffp-55},
+    {0x1.d100000000000p-1, 0x1.d100000000000p-61},
+    {0x1.d300000000000p-1, -0x1.d6a6000000000p-55},
+    {0x1.d500000000000p-1, 0x1.4270000000000p-56},
+    {0x1.d700000000000p-1, 0x1.2dbc000000000p-56},
+    {0x1.d900000000000p-1, -0x1.6672000000000p-55},
+    {0x1.db00000000000p-1, 0x1.81f0000000000p-56},
+    {0x1.dd00000000000p-1, -0x1.ce18000000000p-55},
+    {0x1.df00000000001p-1, -0x1.4697ffffffffdp-56},
+    {0x1.e100000000000p-1, -0x1.e100000000000p-55},
+    {0x1.e2fffffffffffp-1, 0x1.8d9c000000001p-55},
+    {0x1.e500000000000p-1, -0x1.91a4000000000p-56},
+    {0x1.e700000000000p-1, -0x1.4734000000000p-55},
+    {0x1.e8fffffffffffp-1, 0x1.85fc000000003p-56},
+    {0x1.eb00000000001p-1, -0x1.7f33ffffffffdp-56},
+    {0x1.ed00000000000p-1, 0x1.ed00000000000p-57},
+    {0x1.ef00000000000p-1, 0x1.ef00000000000p-61},
+    {0x1.f0fffffffffffp-1, 0x1.0ebc000000001p-55},
+    {0x1.f300000000001p-1, -0x1.1765fffffffffp-55},
+    {0x1.f500000000001p-1, -0x1.08abfffffffffp-55},
+    {0x1.f700000000001p-1, -0x1.72a7ffffffff9p-57},
+    {0x1.f900000000000p-1, -0x1.b9e0000000000p-57},
+    {0x1.fb00000000000p-1, -0x1.c782000000000p-55},
+    {0x1.fd00000000001p-1, -0x1.6fddfffffffffp-55},
+    {0x1.ff00000000000p-1, 0x1.ff00000000000p-55},
+    {0x1.0100000000000p+0, -0x1.0100000000000p-56},
+    {0x1.0300000000000p+0, -0x1.b510000000000p-56},
+    {0x1.0500000000000p+0, 0x1.e54c000000000p-55},
+    {0x1.0700000000000p+0, 0x1.ab60000000000p-58},
+    {0x1.0900000000000p+0, -0x1.2a20000000000p-57},
+    {0x1.0b00000000000p+0, -0x1.a130000000000p-57},
+    {0x1.0d00000000000p+0, 0x1.c5f0000000000p-55},
+    {0x1.0f00000000000p+0, 0x1.1bb4000000000p-55},
+    {0x1.1100000000000p+0, 0x1.1100000000000p-60},
+    {0x1.1300000000000p+0, 0x1.1300000000000p-60},
+    {0x1.1500000000000p+0, -0x1.62e8000000000p-55},
+    {0x1.1700000000000p+0, 0x1.1700000000000p-60},
+    {0x1.1900000000000p+0, 0x1.030c000000000p-54},
+    {0x1.1b00000000000p+0, 0x1.0950000000000p-56},
+    {0x1.1d00000000000p+0, -0x1.7ef8000000000p-56},
+    {0x1.1f00000000000p+0, 0x1.1f00000000000p-60},
+    {0x1.2100000000000p+0, -0x1.3c18000000000p-55},
+    {0x1.2300000000000p+0, 0x1.9020000000000p-56},
+    {0x1.2500000000000p+0, -0x1.a530000000000p-57},
+    {0x1.2700000000000p+0, 0x1.34d4000000000p-55},
+    {0x1.2900000000000p+0, 0x1.d4b4000000000p-55},
+    {0x1.2b00000000000p+0, 0x1.7f18000000000p-56},
+    {0x1.2d00000000000p+0, -0x1.fbf0000000000p-56},
+    {0x1.2f00000000000p+0, -0x1.0920000000000p-56},
+    {0x1.3100000000000p+0, 0x1.3100000000000p-60},
+    {0x1.3300000000000p+0, -0x1.ee14000000000p-55},
+    {0x1.3500000000000p+0, -0x1.0722000000000p-54},
+    {0x1.3700000000000p+0, 0x1.f960000000000p-57},
+    {0x1.3900000000000p+0, 0x1.d580000000000p-55},
+    {0x1.3b00000000000p+0, 0x1.3b00000000000p-60},
+    {0x1.3d00000000000p+0, 0x1.5fac000000000p-55},
+    {0x1.3f00000000000p+0, 0x1.c098000000000p-55},
+    {0x1.4100000000000p+0, 0x1.4604000000000p-55},
+    {0x1.4300000000000p+0, -0x1.5c3c000000000p-54},
+    {0x1.4500000000000p+0, 0x1.4500000000000p-60},
+    {0x1.4700000000000p+0, -0x1.8450000000000p-57},
+    {0x1.4900000000000p+0, 0x1.7220000000000p-58},
+    {0x1.4b00000000000p+0, 0x1.4b00000000000p-60},
+    {0x1.4d00000000000p+0, 0x1.a040000000000p-57},
+    {0x1.4f00000000000p+0, -0x1.e190000000000p-57},
+    {0x1.5100000000000p+0, -0x1.ba50000000000p-55},
+    {0x1.5300000000000p+0, 0x1.5300000000000p-56},
+    {0x1.5500000000000p+0, 0x1.5500000000000p-60},
+    {0x1.5700000000000p+0, 0x1.8c98000000000p-56},
+    {0x1.5900000000000p+0, -0x1.2de0000000000p-56},
+    {0x1.5b00000000000p+0, 0x1.995a000000000p-54},
+    {0x1.5d00000000000p+0, 0x1.832c000000000p-55},
+    {0x1.5f00000000000p+0, -0x1.3b5a000000000p-54},
+  },
+#endif
+};
+
+#endif /* !__OBSOLETE_MATH */
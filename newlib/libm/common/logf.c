@@ -0,0 +1,82 @@
+/* logf.c -- table driven __ieee754_logf.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_logf(x)
+ *
+ *	Evaluated in double: x = 2^k z with z in [0x1.66p-1, 0x1.66p0),
+ *	split into N = 16 intervals, and for the c near z the table gives
+ *
+ *		log(x) = k ln2 + log(c) + log1p(z/c - 1)
+ *
+ *	where |z/c - 1| < 0x1.e5p-6 and log1p is a polynomial of degree 4.
+ *	The interval that holds 1 has c = 1, so that x near 1 loses nothing
+ *	to cancellation.
+ *
+ *	The error is at most 0.8 ulp.  logf(0), logf(x < 0), inf and nan
+ *	give what ef_log.c does, with the same exceptions; errno and matherr
+ *	are left to wf_log.c.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define T __logf_data.tab
+#define A __logf_data.poly
+#define Ln2 __logf_data.ln2
+#define N (1 << LOGF_TABLE_BITS)
+#define OFF 0x3f330000
+
+float
+__ieee754_logf (float x)
+{
+  double_t z, r, r2, y, y0, invc, logc;
+  uint32_t ix, iz, tmp;
+  int k, i;
+
+  ix = asuint (x);
+  if (ix == 0x3f800000)
+    return 0;
+  if (unlikely (ix - 0x00800000 >= 0x7f800000 - 0x00800000))
+    {
+      /* x < 0x1p-126 or inf or nan.  */
+      if (ix * 2 == 0)
+	return __math_divzerof (1);
+      if (ix == 0x7f800000) /* log(inf) == inf.  */
+	return x;
+      if ((ix & 0x80000000) || ix * 2 >= 0xff000000)
+	return __math_invalidf (x);
+      /* x is subnormal: normalize it.  */
+      ix = asuint (x * 0x1p23f);
+      ix -= 23 << 23;
+    }
+
+  /* x = 2^k z, with z in [OFF, 2 OFF) exact and the interval for z given
+     by the top bits of its mantissa.  */
+  tmp = ix - OFF;
+  i = (tmp >> (23 - LOGF_TABLE_BITS)) % N;
+  k = (int32_t) tmp >> 23; /* Arithmetic shift.  */
+  iz = ix - (tmp & 0xff800000);
+  invc = T[i].invc;
+  logc = T[i].logc;
+  z = (double_t) asfloat (iz);
+
+  /* log(x) = log1p(z/c - 1) + log(c) + k ln2.  */
+  r = z * invc - 1;
+  y0 = logc + (double_t) k * Ln2;
+
+  /* Pipelined evaluation of the polynomial for log1p(r).  */
+  r2 = r * r;
+  y = A[1] * r + A[2];
+  y = A[0] * r2 + y;
+  y = y * r2 + (y0 + r);
+  return eval_as_float (y);
+}
+
+#endif /* !__OBSOLETE_MATH */
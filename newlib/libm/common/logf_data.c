@@ -0,0 +1,49 @@
+/* logf_data.c -- data for logf.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << LOGF_TABLE_BITS)
+
+const struct logf_data __logf_data = {
+  /* For the ith of N intervals of the mantissa z in [0x1.66p-1, 0x1.66p0),
+     invc is the inverse of its midpoint c, or 1 in the interval that holds
+     1, so that |z invc - 1| <= 0x1.e5p-6.  logc is -log(invc).  */
+  .tab = {
+    {0x1.661ec6a5122f9p+0, -0x1.57bf753c8d1fbp-2},
+    {0x1.571ed3c506b3ap+0, -0x1.2bef07cdc9355p-2},
+    {0x1.49539e3b2d067p+0, -0x1.01eae5626c691p-2},
+    {0x1.3c995a47babe7p+0, -0x1.b31d8575bce3bp-3},
+    {0x1.30d190130d190p+0, -0x1.6574ebe8c1339p-3},
+    {0x1.25e22708092f1p+0, -0x1.1aa2b7e23f729p-3},
+    {0x1.1bb4a4046ed29p+0, -0x1.a4e7640b1bc38p-4},
+    {0x1.12358e75d3033p+0, -0x1.1973bd1465561p-4},
+    {0x1.0953f39010954p+0, -0x1.252f32f8d1840p-5},
+    {0x1.0000000000000p+0, 0x0.0p+0},
+    {0x1.e573ac901e574p-1, 0x1.b42dd711971b9p-5},
+    {0x1.ca4b3055ee191p-1, 0x1.c5e548f5bc743p-4},
+    {0x1.b2036406c80d9p-1, 0x1.526e5e3a1b438p-3},
+    {0x1.9c2d14ee4a102p-1, 0x1.bc286742d8cd4p-3},
+    {0x1.886e5f0abb04ap-1, 0x1.1058bf9ae4ad4p-2},
+    {0x1.767dce434a9b1p-1, 0x1.404308686a7e4p-2},
+  },
+  .ln2 = 0x1.62e42fefa39efp-1,
+  /* log(1+r) - r ~= A2 r^2 + A1 r^3 + A0 r^4, fitted to the error of
+     the result in float ulps over all N intervals rather than to log1p:
+     it is at most 0.3 ulp before rounding.  */
+  .poly = {
+    -0x1.01b7b39b12d7ep-2,
+    0x1.5575560a1185fp-2,
+    -0x1.ffffe621b0b56p-2,
+  },
+};
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,233 @@
+/* math_config.h -- internal definitions for the table driven exp, exp2,
+ * log, log2 and pow.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#ifndef _MATH_CONFIG_H
+#define _MATH_CONFIG_H
+
+/* As in fdlibm.h.  */
+#ifndef __DECL_SIMD
+#define __DECL_SIMD
+#endif
+#include <math.h>
+#include <stdint.h>
+
+#ifdef __GNUC__
+# define likely(x) __builtin_expect (!!(x), 1)
+# define unlikely(x) __builtin_expect (x, 0)
+# define HIDDEN __attribute__ ((__visibility__ ("hidden")))
+# define NOINLINE __attribute__ ((__noinline__))
+# define ALWAYS_INLINE __inline__ __attribute__ ((__always_inline__))
+#else
+# define likely(x) (x)
+# define unlikely(x) (x)
+# define HIDDEN
+# define NOINLINE
+# define ALWAYS_INLINE __inline__
+#endif
+
+static ALWAYS_INLINE uint32_t
+asuint (float f)
+{
+  union { float f; uint32_t i; } u = { f };
+  return u.i;
+}
+
+static ALWAYS_INLINE float
+asfloat (uint32_t i)
+{
+  union { uint32_t i; float f; } u = { i };
+  return u.f;
+}
+
+static ALWAYS_INLINE uint64_t
+asuint64 (double f)
+{
+  union { double f; uint64_t i; } u = { f };
+  return u.i;
+}
+
+static ALWAYS_INLINE double
+asdouble (uint64_t i)
+{
+  union { uint64_t i; double f; } u = { i };
+  return u.f;
+}
+
+/* Top 12 bits of a double: sign and exponent.  */
+static ALWAYS_INLINE uint32_t
+top12 (double x)
+{
+  return asuint64 (x) >> 52;
+}
+
+/* Round a double_t or float_t to its type where excess precision would
+   otherwise leak out of an expression.  */
+static ALWAYS_INLINE float
+eval_as_float (float x)
+{
+  return x;
+}
+
+static ALWAYS_INLINE double
+eval_as_double (double x)
+{
+  return x;
+}
+
+/* Hide x from the optimizer so that an operation on it is evaluated at
+   run time, and its floating-point exceptions raised, where it is.  */
+static ALWAYS_INLINE float
+opt_barrier_float (float x)
+{
+  volatile float y = x;
+  return y;
+}
+
+static ALWAYS_INLINE double
+opt_barrier_double (double x)
+{
+  volatile double y = x;
+  return y;
+}
+
+static ALWAYS_INLINE void
+force_eval_float (float x)
+{
+  volatile float y = x;
+  (void) y;
+}
+
+static ALWAYS_INLINE void
+force_eval_double (double x)
+{
+  volatile double y = x;
+  (void) y;
+}
+
+/* Nonzero if the functions here set errno themselves, which they do
+   when their wrappers do not (__MATH_ERRNO_IN_KERNEL in fdlibm.h).  */
+#ifdef __MATH_ERRNO_IN_KERNEL
+# define WANT_ERRNO __MATH_ERRNO_IN_KERNEL
+#else
+# define WANT_ERRNO 0
+#endif
+
+/* These raise the floating-point exceptions of an overflowing,
+   underflowing, infinite or invalid result and return that result.
+   errno is set here if WANT_ERRNO, and by the w_*.c wrappers, along
+   with the call to matherr, if not.  */
+HIDDEN float __math_oflowf (uint32_t);
+HIDDEN float __math_uflowf (uint32_t);
+HIDDEN float __math_divzerof (uint32_t);
+HIDDEN float __math_invalidf (float);
+HIDDEN double __math_oflow (uint32_t);
+HIDDEN double __math_uflow (uint32_t);
+HIDDEN double __math_divzero (uint32_t);
+HIDDEN double __math_invalid (double);
+
+/* y, with errno set to ERANGE if WANT_ERRNO and y has overflowed to
+   inf or underflowed to 0, for the results that come out of range
+   without going through __math_oflow or __math_uflow.  */
+#if WANT_ERRNO
+HIDDEN double __math_check_oflow (double);
+HIDDEN double __math_check_uflow (double);
+# define check_oflow(y) __math_check_oflow (y)
+# define check_uflow(y) __math_check_uflow (y)
+#else
+# define check_oflow(y) (y)
+# define check_uflow(y) (y)
+#endif
+
+#define EXP_TABLE_BITS 7
+#define EXP_POLY_ORDER 5
+extern const struct exp_data
+{
+  double invln2N;
+  double shift;
+  double negln2hiN;
+  double negln2loN;
+  double poly[4]; /* Last four coefficients.  */
+  double exp2_shift;
+  double exp2_poly[EXP_POLY_ORDER];
+  uint64_t tab[2 * (1 << EXP_TABLE_BITS)];
+} __exp_data HIDDEN;
+
+#define LOG_TABLE_BITS 7
+#define LOG_POLY_ORDER 6
+#define LOG_POLY1_ORDER 12
+extern const struct log_data
+{
+  double ln2hi;
+  double ln2lo;
+  double poly[LOG_POLY_ORDER - 1]; /* First coefficient is 1.  */
+  double poly1[LOG_POLY1_ORDER - 1];
+  struct { double invc, logc, logctail; } tab[1 << LOG_TABLE_BITS];
+#if !__FP_FAST_FMA
+  struct { double chi, clo; } tab2[1 << LOG_TABLE_BITS];
+#endif
+} __log_data HIDDEN;
+
+#define LOG2_TABLE_BITS 6
+#define LOG2_POLY_ORDER 7
+#define LOG2_POLY1_ORDER 11
+extern const struct log2_data
+{
+  double invln2hi;
+  double invln2lo;
+  double poly[LOG2_POLY_ORDER - 1];
+  double poly1[LOG2_POLY1_ORDER - 1];
+  struct { double invc, logc, logctail; } tab[1 << LOG2_TABLE_BITS];
+#if !__FP_FAST_FMA
+  struct { double chi, clo; } tab2[1 << LOG2_TABLE_BITS];
+#endif
+} __log2_data HIDDEN;
+
+#define POW_LOG_TABLE_BITS 7
+#define POW_LOG_POLY_ORDER 8
+extern const struct pow_log_data
+{
+  double ln2hi;
+  double ln2lo;
+  double poly[POW_LOG_POLY_ORDER - 2]; /* First two coefficients are 1 and -0.5.  */
+  struct { double invc, logc, logctail; } tab[1 << POW_LOG_TABLE_BITS];
+} __pow_log_data HIDDEN;
+
+#define EXP2F_TABLE_BITS 5
+#define EXP2F_POLY_ORDER 3
+extern const struct exp2f_data
+{
+  uint64_t tab[1 << EXP2F_TABLE_BITS];
+  double shift_scaled;
+  double poly[EXP2F_POLY_ORDER];
+  double shift;
+  double invln2_scaled;
+  double poly_scaled[EXP2F_POLY_ORDER];
+} __exp2f_data HIDDEN;
+
+#define LOGF_TABLE_BITS 4
+#define LOGF_POLY_ORDER 4
+extern const struct logf_data
+{
+  struct { double invc, logc; } tab[1 << LOGF_TABLE_BITS];
+  double ln2;
+  double poly[LOGF_POLY_ORDER - 1]; /* First order coefficient is 1.  */
+} __logf_data HIDDEN;
+
+/* log2f and powf share the table; powf has the longer polynomial.  */
+#define LOG2F_TABLE_BITS 4
+#define LOG2F_POLY_ORDER 4
+#define POWF_LOG2_POLY_ORDER 5
+extern const struct log2f_data
+{
+  struct { double invc, logc; } tab[1 << LOG2F_TABLE_BITS];
+  double poly[LOG2F_POLY_ORDER];
+  double powf_poly[POWF_LOG2_POLY_ORDER];
+} __log2f_data HIDDEN;
+
+#endif /* _MATH_CONFIG_H */
@@ -0,0 +1,82 @@
+/* math_err.c -- results of double precision special cases.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Each of these computes its result with an operation that raises the
+   right floating-point exceptions, kept from being folded at compile
+   time, and sets errno if WANT_ERRNO.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+#if WANT_ERRNO
+#include <errno.h>
+
+/* y, with errno set to e.  */
+static NOINLINE double
+with_errno (double y, int e)
+{
+  errno = e;
+  return y;
+}
+#else
+#define with_errno(y, e) (y)
+#endif
+
+static NOINLINE double
+xflow (uint32_t sign, double y)
+{
+  y = opt_barrier_double (sign ? -y : y) * y;
+  return with_errno (y, ERANGE);
+}
+
+/* +-0 with underflow and inexact.  */
+HIDDEN double
+__math_uflow (uint32_t sign)
+{
+  return xflow (sign, 0x1p-767);
+}
+
+/* +-inf with overflow and inexact.  */
+HIDDEN double
+__math_oflow (uint32_t sign)
+{
+  return xflow (sign, 0x1p769);
+}
+
+/* +-inf with division by zero.  */
+HIDDEN double
+__math_divzero (uint32_t sign)
+{
+  double y = opt_barrier_double (sign ? -1.0 : 1.0) / 0.0;
+  return with_errno (y, ERANGE);
+}
+
+/* nan, with invalid unless x is a quiet nan.  */
+HIDDEN double
+__math_invalid (double x)
+{
+  double y = (x - x) / (x - x);
+  return isnan (x) ? y : with_errno (y, EDOM);
+}
+
+#if WANT_ERRNO
+HIDDEN double
+__math_check_oflow (double y)
+{
+  return isinf (y) ? with_errno (y, ERANGE) : y;
+}
+
+HIDDEN double
+__math_check_uflow (double y)
+{
+  return y == 0.0 ? with_errno (y, ERANGE) : y;
+}
+#endif
+
+#endif /* !__OBSOLETE_MATH */
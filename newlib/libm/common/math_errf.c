@@ -0,0 +1,68 @@
+/* math_errf.c -- results of single precision special cases.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Each of these computes its result with an operation that raises the
+   right floating-point exceptions, kept from being folded at compile
+   time, and sets errno if WANT_ERRNO.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+#if WANT_ERRNO
+#include <errno.h>
+
+/* y, with errno set to e.  */
+static NOINLINE float
+with_errno (float y, int e)
+{
+  errno = e;
+  return y;
+}
+#else
+#define with_errno(y, e) (y)
+#endif
+
+static NOINLINE float
+xflow (uint32_t sign, float y)
+{
+  y = opt_barrier_float (sign ? -y : y) * y;
+  return with_errno (y, ERANGE);
+}
+
+/* +-0 with underflow and inexact.  */
+HIDDEN float
+__math_uflowf (uint32_t sign)
+{
+  return xflow (sign, 0x1p-95f);
+}
+
+/* +-inf with overflow and inexact.  */
+HIDDEN float
+__math_oflowf (uint32_t sign)
+{
+  return xflow (sign, 0x1p97f);
+}
+
+/* +-inf with division by zero.  */
+HIDDEN float
+__math_divzerof (uint32_t sign)
+{
+  float y = opt_barrier_float (sign ? -1.0f : 1.0f) / 0.0f;
+  return with_errno (y, ERANGE);
+}
+
+/* nan, with invalid unless x is a quiet nan.  */
+HIDDEN float
+__math_invalidf (float x)
+{
+  float y = (x - x) / (x - x);
+  return isnan (x) ? y : with_errno (y, EDOM);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,324 @@
+/* pow.c -- table driven __ieee754_pow.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_pow(x,y)
+ *
+ *	x^y = exp(y log(x)).  log(x) is worked out as in log.c but to about
+ *	68 bits, in two doubles hi + lo, with a table of N = 128 c for which
+ *	z/c - 1 is exact.  y (hi + lo) is then kept in two doubles as well,
+ *	and exp of that is exp.c's algorithm with the low part added to r.
+ *	The sign of a negative x to an odd integer y goes into the scale
+ *	factor of exp.
+ *
+ *	The error is at most 0.52 ulp.  The special cases follow C99 Annex F
+ *	and give what e_pow.c does, with the same exceptions; errno and
+ *	matherr are left to w_pow.c.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define T __pow_log_data.tab
+#define A __pow_log_data.poly
+#define Ln2hi __pow_log_data.ln2hi
+#define Ln2lo __pow_log_data.ln2lo
+#define N (1 << POW_LOG_TABLE_BITS)
+#define OFF 0x3fe6955500000000
+
+/* log(x) = hi + *tail for the bits ix of a positive normal x, or of a
+   subnormal x normalized so that its exponent field went negative.  */
+static ALWAYS_INLINE double_t
+log_inline (uint64_t ix, double_t *tail)
+{
+  double_t z, r, r2, y, invc, logc, logctail, kd, hi, t1, t2, lo, lo1, lo2, p;
+  double_t ar, lo3, lo4;
+  uint64_t iz, tmp;
+  int k, i;
+
+  /* x = 2^k z with z in [OFF, 2 OFF) exact, as in log.c.  */
+  tmp = ix - OFF;
+  i = (tmp >> (52 - POW_LOG_TABLE_BITS)) % N;
+  k = (int64_t) tmp >> 52; /* Arithmetic shift.  */
+  iz = ix - (tmp & 0xfffULL << 52);
+  z = asdouble (iz);
+  kd = (double_t) k;
+
+  invc = T[i].invc;
+  logc = T[i].logc;
+  logctail = T[i].logctail;
+
+  /* invc has at most 8 bits and |z invc - 1| < 0x1.78p-8, so that
+     r = z invc - 1 is exact.  */
+#if __FP_FAST_FMA
+  r = __builtin_fma (z, invc, -1.0);
+#else
+  /* Split z so that rhi, rlo and rhi * rhi are exact.  */
+  double_t zhi = asdouble ((iz + (1ULL << 31)) & (-1ULL << 32));
+  double_t zlo = z - zhi;
+  double_t rhi = zhi * invc - 1.0;
+  double_t rlo = zlo * invc;
+  r = rhi + rlo;
+#endif
+
+  /* k ln2 + log(c) + r.  */
+  t1 = kd * Ln2hi + logc;
+  t2 = t1 + r;
+  lo1 = kd * Ln2lo + logctail;
+  lo2 = t1 - t2 + r;
+
+  /* k ln2 + log(c) + r - r^2/2, with the rounding error of each step in
+     lo3 and lo4.  */
+  ar = -0.5 * r;
+#if __FP_FAST_FMA
+  double_t ar2 = r * ar;
+  hi = t2 + ar2;
+  lo3 = __builtin_fma (ar, r, -ar2);
+  lo4 = t2 - hi + ar2;
+#else
+  double_t arhi = -0.5 * rhi;
+  double_t arhi2 = rhi * arhi;
+  hi = t2 + arhi2;
+  lo3 = rlo * (ar + arhi);
+  lo4 = t2 - hi + arhi2;
+#endif
+  /* p = log1p(r) - r + r^2/2.  */
+  r2 = r * r;
+  p = r2 * r * (A[0] + r * A[1] + r2 * (A[2] + r * A[3]
+					+ r2 * (A[4] + r * A[5])));
+  lo = lo1 + lo2 + lo3 + lo4 + p;
+  y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
+
+#undef N
+#undef T
+#define N (1 << EXP_TABLE_BITS)
+#define InvLn2N __exp_data.invln2N
+#define NegLn2hiN __exp_data.negln2hiN
+#define NegLn2loN __exp_data.negln2loN
+#define Shift __exp_data.shift
+#define T __exp_data.tab
+#define C2 __exp_data.poly[0]
+#define C3 __exp_data.poly[1]
+#define C4 __exp_data.poly[2]
+#define C5 __exp_data.poly[3]
+
+/* exp.c's specialcase, with the sign of the result in sbits.  */
+static NOINLINE double
+specialcase (double_t tmp, uint64_t sbits, uint64_t ki)
+{
+  double_t scale, y;
+
+  if ((ki & 0x80000000) == 0)
+    {
+      /* k > 0: the exponent of scale may overflow.  */
+      sbits -= 1009ull << 52;
+      scale = asdouble (sbits);
+      y = 0x1p1009 * (scale + scale * tmp);
+      return check_oflow (eval_as_double (y));
+    }
+  /* k < 0: take care over results in the subnormal range.  */
+  sbits += 1022ull << 52;
+  scale = asdouble (sbits);
+  y = scale + scale * tmp;
+  if (fabs (y) < 1.0)
+    {
+      /* Round y to the precision a subnormal has before scaling it down,
+	 not twice.  */
+      double_t hi, lo, one = 1.0;
+      if (y < 0.0)
+	one = -1.0;
+      lo = scale - y + scale * tmp;
+      hi = one + y;
+      lo = one - hi + y + lo;
+      y = eval_as_double (hi + lo) - one;
+      /* Keep the sign of a zero.  */
+      if (y == 0)
+	y = asdouble (sbits & 0x8000000000000000);
+      force_eval_double (opt_barrier_double (0x1p-1022) * 0x1p-1022);
+    }
+  y = 0x1p-1022 * y;
+  return check_uflow (eval_as_double (y));
+}
+
+#define SIGN_BIAS (0x800 << EXP_TABLE_BITS)
+
+/* exp(x + xtail), negated if sign_bias is SIGN_BIAS.  |xtail| is below
+   2^-8/N times |x|, or tiny.  */
+static ALWAYS_INLINE double
+exp_inline (double_t x, double_t xtail, uint32_t sign_bias)
+{
+  uint32_t abstop;
+  uint64_t ki, idx, top, sbits;
+  double_t kd, z, r, r2, scale, tail, tmp;
+
+  abstop = top12 (x) & 0x7ff;
+  if (unlikely (abstop - top12 (0x1p-54)
+		>= top12 (512.0) - top12 (0x1p-54)))
+    {
+      if (abstop - top12 (0x1p-54) >= 0x80000000)
+	{
+	  /* |x| < 2^-54: the result rounds to +-1.  */
+	  double_t one = 1.0 + x;
+	  return sign_bias ? -one : one;
+	}
+      if (abstop >= top12 (1024.0))
+	{
+	  /* inf and nan were dealt with before.  */
+	  if (asuint64 (x) >> 63)
+	    return __math_uflow (sign_bias);
+	  else
+	    return __math_oflow (sign_bias);
+	}
+      /* 512 <= |x| < 1024: left to specialcase.  */
+      abstop = 0;
+    }
+
+  z = InvLn2N * x;
+  kd = eval_as_double (z + Shift);
+  ki = asuint64 (kd);
+  kd -= Shift;
+  r = x + kd * NegLn2hiN + kd * NegLn2loN;
+  r += xtail;
+  /* 2^(k/N) ~= scale * (1 + tail), with the sign put in with k.  */
+  idx = 2 * (ki % N);
+  top = (ki + sign_bias) << (52 - EXP_TABLE_BITS);
+  tail = asdouble (T[idx]);
+  sbits = T[idx + 1] + top;
+  r2 = r * r;
+  tmp = tail + r + r2 * (C2 + r * C3) + r2 * r2 * (C4 + r * C5);
+  if (unlikely (abstop == 0))
+    return specialcase (tmp, sbits, ki);
+  scale = asdouble (sbits);
+  return eval_as_double (scale + scale * tmp);
+}
+
+/* 0 if iy is not an integer, 1 if it is an odd one and 2 if an even
+   one.  iy is the bits of a finite nonzero double.  */
+static ALWAYS_INLINE int
+checkint (uint64_t iy)
+{
+  int e = iy >> 52 & 0x7ff;
+  if (e < 0x3ff)
+    return 0;
+  if (e > 0x3ff + 52)
+    return 2;
+  if (iy & ((1ULL << (0x3ff + 52 - e)) - 1))
+    return 0;
+  if (iy & (1ULL << (0x3ff + 52 - e)))
+    return 1;
+  return 2;
+}
+
+/* Whether i is the bits of 0, inf or nan.  */
+static ALWAYS_INLINE int
+zeroinfnan (uint64_t i)
+{
+  return 2 * i - 1 >= 2 * asuint64 (INFINITY) - 1;
+}
+
+double
+__ieee754_pow (double x, double y)
+{
+  uint32_t sign_bias = 0;
+  uint64_t ix, iy;
+  uint32_t topx, topy;
+
+  ix = asuint64 (x);
+  iy = asuint64 (y);
+  topx = top12 (x);
+  topy = top12 (y);
+  if (unlikely (topx - 0x001 >= 0x7ff - 0x001
+		|| (topy & 0x7ff) - 0x3be >= 0x43e - 0x3be))
+    {
+      /* x is negative, subnormal, 0, inf or nan, or |y| < 2^-65 or
+	 |y| >= 2^63 or y is nan.  If |y| > 1075 ln2 2^53 ~= 0x1.749p62
+	 then x^y is 0 or inf unless |x| is 1, and if |y| < 2^-54/1075
+	 ~= 0x1.e7b6p-65 x^y rounds to 1.  */
+      if (unlikely (zeroinfnan (iy)))
+	{
+	  if (2 * iy == 0)
+	    return 1.0;
+	  if (ix == asuint64 (1.0))
+	    return 1.0;
+	  if (2 * ix > 2 * asuint64 (INFINITY)
+	      || 2 * iy > 2 * asuint64 (INFINITY))
+	    return x + y;
+	  if (2 * ix == 2 * asuint64 (1.0))
+	    return 1.0;
+	  if ((2 * ix < 2 * asuint64 (1.0)) == !(iy >> 63))
+	    return 0.0; /* |x| < 1 and y is inf, or |x| > 1 and y is -inf.  */
+	  return y * y;
+	}
+      if (unlikely (zeroinfnan (ix)))
+	{
+	  double_t x2 = x * x;
+	  if (ix >> 63 && checkint (iy) == 1)
+	    {
+	      x2 = -x2;
+	      sign_bias = 1;
+	    }
+	  if (WANT_ERRNO && 2 * ix == 0 && iy >> 63)
+	    return __math_divzero (sign_bias);
+	  /* The barrier keeps 1/x2, and its division by zero, from being
+	     hoisted above the test.  */
+	  return iy >> 63 ? opt_barrier_double (1 / x2) : x2;
+	}
+      /* x and y are finite and nonzero.  */
+      if (ix >> 63)
+	{
+	  /* x < 0.  */
+	  int yint = checkint (iy);
+	  if (yint == 0)
+	    return __math_invalid (x);
+	  if (yint == 1)
+	    sign_bias = SIGN_BIAS;
+	  ix &= 0x7fffffffffffffff;
+	  topx &= 0x7ff;
+	}
+      if ((topy & 0x7ff) - 0x3be >= 0x43e - 0x3be)
+	{
+	  /* sign_bias is 0 here, since y is even.  */
+	  if (ix == asuint64 (1.0))
+	    return 1.0;
+	  if ((topy & 0x7ff) < 0x3be)
+	    /* |y| < 2^-65: x^y ~= 1 + y log(x).  */
+	    return ix > asuint64 (1.0) ? 1.0 + y : 1.0 - y;
+	  return (ix > asuint64 (1.0)) == (topy < 0x800) ? __math_oflow (0)
+							  : __math_uflow (0);
+	}
+      if (topx == 0)
+	{
+	  /* Normalize a subnormal x so that its exponent goes negative.  */
+	  ix = asuint64 (x * 0x1p52);
+	  ix &= 0x7fffffffffffffff;
+	  ix -= 52ULL << 52;
+	}
+    }
+
+  double_t lo;
+  double_t hi = log_inline (ix, &lo);
+  double_t ehi, elo;
+#if __FP_FAST_FMA
+  ehi = y * hi;
+  elo = y * lo + __builtin_fma (y, hi, -ehi);
+#else
+  double_t yhi = asdouble (iy & -1ULL << 27);
+  double_t ylo = y - yhi;
+  double_t lhi = asdouble (asuint64 (hi) & -1ULL << 27);
+  double_t llo = hi - lhi + lo;
+  ehi = yhi * lhi;
+  elo = ylo * lhi + y * llo; /* |elo| < |y| 2^-25.  */
+#endif
+  return exp_inline (ehi, elo, sign_bias);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,199 @@
+/* powf.c -- table driven __ieee754_powf.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* __ieee754_powf(x,y)
+ *
+ *	x^y = 2^(y log2(x)), in double.  log2(x) comes from the table
+ *	log2f.c uses and a polynomial of degree 5, good to about 2^-31;
+ *	y log2(x) is exact in double for a float y, and 2^ of it is
+ *	exp2f.c's algorithm.  The sign of a negative x to an odd integer y
+ *	goes into the scale factor of exp2.
+ *
+ *	The error is at most 0.82 ulp.  The special cases follow C99 Annex F
+ *	and give what ef_pow.c does, with the same exceptions; errno and
+ *	matherr are left to wf_pow.c.
+ */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#include "math_config.h"
+
+#define N (1 << LOG2F_TABLE_BITS)
+#define T __log2f_data.tab
+#define A __log2f_data.powf_poly
+#define OFF 0x3f330000
+
+/* log2(x) for the bits ix of a positive normal x, or of a subnormal x
+   normalized so that its exponent field went negative.  */
+static ALWAYS_INLINE double_t
+log2_inline (uint32_t ix)
+{
+  double_t z, r, r2, r4, p, q, y, y0, invc, logc;
+  uint32_t iz, top, tmp;
+  int k, i;
+
+  /* x = 2^k z, as in logf.c.  */
+  tmp = ix - OFF;
+  i = (tmp >> (23 - LOG2F_TABLE_BITS)) % N;
+  top = tmp & 0xff800000;
+  iz = ix - top;
+  k = (int32_t) top >> 23; /* Arithmetic shift.  */
+  invc = T[i].invc;
+  logc = T[i].logc;
+  z = (double_t) asfloat (iz);
+
+  /* log2(x) = log1p(z/c - 1)/ln2 + log2(c) + k.  */
+  r = z * invc - 1;
+  y0 = logc + (double_t) k;
+
+  /* Pipelined evaluation of the polynomial for log1p(r)/ln2.  */
+  r2 = r * r;
+  y = A[0] * r + A[1];
+  p = A[2] * r + A[3];
+  r4 = r2 * r2;
+  q = A[4] * r + y0;
+  q = p * r2 + q;
+  y = y * r4 + q;
+  return y;
+}
+
+#undef N
+#undef T
+#define N (1 << EXP2F_TABLE_BITS)
+#define T __exp2f_data.tab
+#define C __exp2f_data.poly
+#define Shift __exp2f_data.shift_scaled
+#define SIGN_BIAS (1 << (EXP2F_TABLE_BITS + 11))
+
+/* 2^xd for xd in [-150, 128], negated if sign_bias is SIGN_BIAS.  */
+static ALWAYS_INLINE float
+exp2_inline (double_t xd, uint32_t sign_bias)
+{
+  uint64_t ki, ski, t;
+  double_t kd, z, r, r2, y, s;
+
+  /* x = k/N + r with |r| <= 1/2N and k an integer.  */
+  kd = eval_as_double (xd + Shift);
+  ki = asuint64 (kd);
+  kd -= Shift; /* k/N.  */
+  r = xd - kd;
+
+  /* 2^x = 2^(k/N) 2^r ~= s (C0 r^3 + C1 r^2 + C2 r + 1).  */
+  t = T[ki % N];
+  ski = ki + sign_bias;
+  t += ski << (52 - EXP2F_TABLE_BITS);
+  s = asdouble (t);
+  z = C[0] * r + C[1];
+  r2 = r * r;
+  y = C[2] * r + 1;
+  y = z * r2 + y;
+  y = y * s;
+  return eval_as_float (y);
+}
+
+/* 0 if iy is not an integer, 1 if it is an odd one and 2 if an even
+   one.  iy is the bits of a finite nonzero float.  */
+static ALWAYS_INLINE int
+checkint (uint32_t iy)
+{
+  int e = iy >> 23 & 0xff;
+  if (e < 0x7f)
+    return 0;
+  if (e > 0x7f + 23)
+    return 2;
+  if (iy & ((1 << (0x7f + 23 - e)) - 1))
+    return 0;
+  if (iy & (1 << (0x7f + 23 - e)))
+    return 1;
+  return 2;
+}
+
+/* Whether i is the bits of 0, inf or nan.  */
+static ALWAYS_INLINE int
+zeroinfnan (uint32_t ix)
+{
+  return 2 * ix - 1 >= 2u * 0x7f800000 - 1;
+}
+
+float
+__ieee754_powf (float x, float y)
+{
+  uint32_t sign_bias = 0;
+  uint32_t ix, iy;
+
+  ix = asuint (x);
+  iy = asuint (y);
+  if (unlikely (ix - 0x00800000 >= 0x7f800000 - 0x00800000
+		|| zeroinfnan (iy)))
+    {
+      /* x is negative, subnormal, 0, inf or nan, or y is 0, inf or
+	 nan.  */
+      if (unlikely (zeroinfnan (iy)))
+	{
+	  if (2 * iy == 0)
+	    return 1.0f;
+	  if (ix == 0x3f800000)
+	    return 1.0f;
+	  if (2 * ix > 2u * 0x7f800000 || 2 * iy > 2u * 0x7f800000)
+	    return x + y;
+	  if (2 * ix == 2 * 0x3f800000)
+	    return 1.0f;
+	  if ((2 * ix < 2 * 0x3f800000) == !(iy & 0x80000000))
+	    return 0.0f; /* |x| < 1 and y is inf, or |x| > 1 and y is -inf.  */
+	  return y * y;
+	}
+      if (unlikely (zeroinfnan (ix)))
+	{
+	  float_t x2 = x * x;
+	  if (ix & 0x80000000 && checkint (iy) == 1)
+	    {
+	      x2 = -x2;
+	      sign_bias = 1;
+	    }
+	  if (WANT_ERRNO && 2 * ix == 0 && iy & 0x80000000)
+	    return __math_divzerof (sign_bias);
+	  /* The barrier keeps 1/x2, and its division by zero, from being
+	     hoisted above the test.  */
+	  return iy & 0x80000000 ? opt_barrier_float (1 / x2) : x2;
+	}
+      /* x and y are finite and nonzero.  */
+      if (ix & 0x80000000)
+	{
+	  /* x < 0.  */
+	  int yint = checkint (iy);
+	  if (yint == 0)
+	    return __math_invalidf (x);
+	  if (yint == 1)
+	    sign_bias = SIGN_BIAS;
+	  ix &= 0x7fffffff;
+	}
+      if (ix < 0x00800000)
+	{
+	  /* Normalize a subnormal x so that its exponent goes negative.  */
+	  ix = asuint (x * 0x1p23f);
+	  ix &= 0x7fffffff;
+	  ix -= 23 << 23;
+	}
+    }
+  double_t logx = log2_inline (ix);
+  double_t ylogx = y * logx; /* Cannot overflow: y is a float.  */
+  if (unlikely ((asuint64 (ylogx) >> 47 & 0xffff)
+		>= asuint64 (126.0) >> 47))
+    {
+      /* |y log2(x)| >= 126.  */
+      if (ylogx > 0x1.fffffffd1d571p+6)
+	/* |x^y| > 0x1.ffffffp127, which rounds to inf.  */
+	return __math_oflowf (sign_bias);
+      if (ylogx <= -150.0)
+	return __math_uflowf (sign_bias);
+    }
+  return exp2_inline (ylogx, sign_bias);
+}
+
+#endif /* !__OBSOLETE_MATH */
@@ -17,6 +17,13 @@
 
 #include "fdlibm.h"
 
+/* Still there for the programs that set it with _MATH_ERRNO_ONLY,
+   which libm does not look at.  */
+#ifdef _MATH_ERRNO_ONLY
+#undef _LIB_VERSION
+#define _LIB_VERSION __fdlib_version
+#endif
+
 /*
  * define and initialize _LIB_VERSION
  */
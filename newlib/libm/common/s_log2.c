@@ -30,17 +30,17 @@ The <<log2>> functions compute the base-2 logarithm of <[x]>.  A domain error
 occurs if the argument is less than zero.  A range error occurs if the
 argument is zero.
 
-The Newlib implementations are not full, intrinisic calculations, but
-rather are derivatives based on <<log>>.  (Accuracy might be slightly off from
-a direct calculation.)  In addition to functions, they are also implemented as
-macros defined in math.h:
+Unless newlib is built with the table driven math code (see
+__OBSOLETE_MATH in machine/ieeefp.h), the Newlib implementations are not
+full, intrinisic calculations, but rather are derivatives based on <<log>>.
+(Accuracy might be slightly off from a direct calculation.)  In addition to
+functions, <<log2>> is then also implemented as a macro defined in math.h:
 . #define log2(x) (log (x) / _M_LN2)
-. #define log2f(x) (logf (x) / (float) _M_LN2)
-To use the functions instead, just undefine the macros first.
+To use the function instead, just undefine the macro first.
 
 You can use the (non-ANSI) function <<matherr>> to specify error
-handling for these functions, indirectly through the respective <<log>>
-function. 
+handling for these functions; with the older code it is called for the
+respective <<log>> function.
 
 RETURNS
 The <<log2>> functions return
@@ -72,6 +72,49 @@ C99, POSIX, System V Interface Definition (Issue 6).
 
 #ifndef _DOUBLE_IS_32BITS
 
+#if !__OBSOLETE_MATH && !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
+static _NOINLINE double
+log2_error(double x, double z)
+{
+	struct exception exc;
+	if(_LIB_VERSION == _IEEE_ || isnan(x) || x > 0.0) return z;
+#ifndef HUGE_VAL
+#define HUGE_VAL inf
+	double inf = 0.0;
+
+	SET_HIGH_WORD(inf,0x7ff00000);	/* set inf to infinite */
+#endif
+	exc.name = "log2";
+	exc.err = 0;
+	exc.arg1 = exc.arg2 = x;
+	if (_LIB_VERSION == _SVID_)
+	   exc.retval = -HUGE;
+	else
+	   exc.retval = -HUGE_VAL;
+	if(x==0.0) {
+	    /* log2(0) */
+	    exc.type = SING;
+	    if (_LIB_VERSION == _POSIX_)
+	       errno = ERANGE;
+	    else if (!matherr(&exc)) {
+	       errno = ERANGE;
+	    }
+	} else {
+	    /* log2(x<0) */
+	    exc.type = DOMAIN;
+	    if (_LIB_VERSION == _POSIX_)
+	       errno = EDOM;
+	    else if (!matherr(&exc)) {
+	       errno = EDOM;
+	    }
+	    exc.retval = nan("");
+	}
+	if (exc.err != 0)
+	   errno = exc.err;
+	return exc.retval;
+}
+#endif
+
 #ifdef __STDC__
 	double log2(double x)		/* wrapper log2 */
 #else
@@ -79,7 +122,17 @@ C99, POSIX, System V Interface Definition (Issue 6).
 	double x;
 #endif
 {
-  return (log(x) / M_LN2);
+#if __OBSOLETE_MATH
+	return (log(x) / M_LN2);
+#elif defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return __ieee754_log2(x);
+#else
+	double z;
+	z = __ieee754_log2(x);
+	if(__predict_false(x<=0.0))
+	    return log2_error(x,z);
+	return z;
+#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
@@ -104,6 +104,9 @@ If <<matherr>> returns <<0>> (indicating that it was not able to resolve
 the error) the caller sets <<errno>> to an appropriate value, and prints
 an error message.
 
+A library configured with <<--disable-newlib-matherr>> never calls
+<<matherr>>, and only sets <<errno>>.
+
 PORTABILITY
 <<matherr>> is not ANSI C.  
 */
@@ -23,6 +23,49 @@
 #undef log2
 #undef log2f
 
+#if !__OBSOLETE_MATH && !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
+static _NOINLINE float
+log2f_error(float x, float z)
+{
+	struct exception exc;
+	if(_LIB_VERSION == _IEEE_ || isnan(x) || x > (float)0.0) return z;
+#ifndef HUGE_VAL
+#define HUGE_VAL inf
+	double inf = 0.0;
+
+	SET_HIGH_WORD(inf,0x7ff00000);	/* set inf to infinite */
+#endif
+	exc.name = "log2f";
+	exc.err = 0;
+	exc.arg1 = exc.arg2 = (double)x;
+	if (_LIB_VERSION == _SVID_)
+	   exc.retval = -HUGE;
+	else
+	   exc.retval = -HUGE_VAL;
+	if(x==(float)0.0) {
+	    /* log2f(0) */
+	    exc.type = SING;
+	    if (_LIB_VERSION == _POSIX_)
+	       errno = ERANGE;
+	    else if (!matherr(&exc)) {
+	       errno = ERANGE;
+	    }
+	} else {
+	    /* log2f(x<0) */
+	    exc.type = DOMAIN;
+	    if (_LIB_VERSION == _POSIX_)
+	       errno = EDOM;
+	    else if (!matherr(&exc)) {
+	       errno = EDOM;
+	    }
+	    exc.retval = nan("");
+	}
+	if (exc.err != 0)
+	   errno = exc.err;
+	return (float)exc.retval;
+}
+#endif
+
 #ifdef __STDC__
 	float log2f(float x)		/* wrapper log2f */
 #else
@@ -30,7 +73,17 @@
 	float x;
 #endif
 {
-  return (logf(x) / (float_t) M_LN2);
+#if __OBSOLETE_MATH
+	return (logf(x) / (float_t) M_LN2);
+#elif defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return __ieee754_log2f(x);
+#else
+	float z;
+	z = __ieee754_log2f(x);
+	if(__predict_false(x<=(float)0.0))
+	    return log2f_error(x,z);
+	return z;
+#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
@@ -0,0 +1,157 @@
+/* v_exp.h -- vector exp, exp2, expf and exp2f.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* As exp.c, exp2.c, expf.c and exp2f.c, a lane at a time.  Lanes with
+   |x| >= 512, or |x| >= 88 for expf and |x| >= 128 for exp2f, and inf
+   and nan, are left to the scalar functions; they are set to 0 for the
+   vector code so that it raises no exceptions for them.  */
+
+#include "v_math.h"
+
+/* scale, with 2^(k/N) ~= scale (1 + *tail), for ki holding k.  */
+static ALWAYS_INLINE v_f64_t
+v_exp_scale (v_u64_t ki, v_f64_t *tail)
+{
+  v_u64_t idx, sbits;
+
+  idx = 2 * (ki % (1 << EXP_TABLE_BITS));
+  *tail = (v_f64_t) v_lookup_u64 (__exp_data.tab, idx);
+  sbits = v_lookup_u64 (__exp_data.tab + 1, idx)
+	  + (ki << (52 - EXP_TABLE_BITS));
+  return (v_f64_t) sbits;
+}
+
+V_ABI v_f64_t
+V_NAME (v, exp) (v_f64_t x)
+{
+  v_f64_t xs, z, kd, r, r2, scale, tail, tmp, y;
+  v_u64_t ki;
+  v_s64_t special;
+
+  special = ~(v_abs_f64 (x) < 512.0);
+  xs = v_sel_f64 (special, (v_f64_t) {}, x);
+
+  /* exp(x) = 2^(k/N) * exp(r), with exp(r) in [2^(-1/2N), 2^(1/2N)].  */
+  z = __exp_data.invln2N * xs;
+  kd = z + __exp_data.shift;
+  ki = (v_u64_t) kd;
+  kd -= __exp_data.shift;
+  r = xs + kd * __exp_data.negln2hiN + kd * __exp_data.negln2loN;
+  scale = v_exp_scale (ki, &tail);
+  r2 = r * r;
+  tmp = tail + r + r2 * (__exp_data.poly[0] + r * __exp_data.poly[1])
+	+ r2 * r2 * (__exp_data.poly[2] + r * __exp_data.poly[3]);
+  y = scale + scale * tmp;
+  if (unlikely (v_any_s64 (special)))
+    return v_call_f64 (__ieee754_exp, x, y, special);
+  return y;
+}
+
+V_ABI v_f64_t
+V_NAME (v, exp2) (v_f64_t x)
+{
+  const double *C = __exp_data.exp2_poly;
+  v_f64_t xs, kd, r, r2, scale, tail, tmp, y;
+  v_u64_t ki;
+  v_s64_t special;
+
+  special = ~(v_abs_f64 (x) < 512.0);
+  xs = v_sel_f64 (special, (v_f64_t) {}, x);
+
+  /* x = k/N + r, with the shift rounding x to a multiple of 1/N.  */
+  kd = xs + __exp_data.exp2_shift;
+  ki = (v_u64_t) kd;
+  kd -= __exp_data.exp2_shift;
+  r = xs - kd;
+  scale = v_exp_scale (ki, &tail);
+  r2 = r * r;
+  tmp = tail + r * C[0] + r2 * (C[1] + r * C[2])
+	+ r2 * r2 * (C[3] + r * C[4]);
+  y = scale + scale * tmp;
+  if (unlikely (v_any_s64 (special)))
+    return v_call_f64 (__ieee754_exp2, x, y, special);
+  return y;
+}
+
+/* 2^(k/N) 2^(r/N) for expf and exp2f, C being the polynomial for
+   2^(r/N) - 1 and ki holding k.  */
+static ALWAYS_INLINE v_f64_t
+v_exp2f_inline (v_u64_t ki, v_f64_t r, const double *C)
+{
+  v_u64_t t;
+  v_f64_t z, r2, y, s;
+
+  t = v_lookup_u64 (__exp2f_data.tab, ki % (1 << EXP2F_TABLE_BITS));
+  t += ki << (52 - EXP2F_TABLE_BITS);
+  s = (v_f64_t) t;
+  z = C[0] * r + C[1];
+  r2 = r * r;
+  y = C[2] * r + 1;
+  y = z * r2 + y;
+  return y * s;
+}
+
+/* expf of half the lanes, in double.  */
+static ALWAYS_INLINE v_f64_t
+v_expf_half (v_f64_t xd)
+{
+  v_f64_t z, kd, r;
+  v_u64_t ki;
+
+  /* x N/ln2 = k + r with |r| <= 1/2 and k an integer.  */
+  z = __exp2f_data.invln2_scaled * xd;
+  kd = z + __exp2f_data.shift;
+  ki = (v_u64_t) kd;
+  kd -= __exp2f_data.shift;
+  r = z - kd;
+  return v_exp2f_inline (ki, r, __exp2f_data.poly_scaled);
+}
+
+V_ABI v_f32_t
+V_NAMEF (v, expf) (v_f32_t x)
+{
+  v_s32_t special;
+  v_f32_t xs, y;
+
+  special = ((v_u32_t) x & 0x7fffffff) >= asuint (88.0f);
+  xs = v_sel_f32 (special, (v_f32_t) {}, x);
+  y = v_narrow_f64 (v_expf_half (v_lo_f32 (xs)),
+		    v_expf_half (v_hi_f32 (xs)));
+  if (unlikely (v_any_s32 (special)))
+    return v_call_f32 (__ieee754_expf, x, y, special);
+  return y;
+}
+
+static ALWAYS_INLINE v_f64_t
+v_exp2f_half (v_f64_t xd)
+{
+  v_f64_t kd, r;
+  v_u64_t ki;
+
+  /* x = k/N + r with |r| <= 1/2N and k an integer.  */
+  kd = xd + __exp2f_data.shift_scaled;
+  ki = (v_u64_t) kd;
+  kd -= __exp2f_data.shift_scaled;
+  r = xd - kd;
+  return v_exp2f_inline (ki, r, __exp2f_data.poly);
+}
+
+V_ABI v_f32_t
+V_NAMEF (v, exp2f) (v_f32_t x)
+{
+  v_s32_t special;
+  v_f32_t xs, y;
+
+  special = ((v_u32_t) x & 0x7fffffff) >= asuint (128.0f);
+  xs = v_sel_f32 (special, (v_f32_t) {}, x);
+  y = v_narrow_f64 (v_exp2f_half (v_lo_f32 (xs)),
+		    v_exp2f_half (v_hi_f32 (xs)));
+  if (unlikely (v_any_s32 (special)))
+    return v_call_f32 (__ieee754_exp2f, x, y, special);
+  return y;
+}
@@ -0,0 +1,290 @@
+/* v_log.h -- vector log, log2, logf and log2f.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* As log.c, log2.c, logf.c and log2f.c, a lane at a time.  Every lane
+   takes the table path; when a lane of log or log2 is near 1 the
+   polynomial for there is worked out for the whole vector as well and
+   that lane picked from it.  Lanes with x < 0x1p-1022 (0x1p-126 for the
+   float functions), negative x, inf and nan are left to the scalar
+   functions; they are set to 2 for the vector code so that it raises no
+   exceptions for them.  */
+
+#include "v_math.h"
+
+#define V_LOG_OFF 0x3fe6000000000000
+#define V_LOGF_OFF 0x3f330000
+
+/* x = 2^k z with z in [V_LOG_OFF, 2 V_LOG_OFF) exact, as in log.c: set
+   *z and *kd and return the index into a table of 2^bits entries.  */
+static ALWAYS_INLINE v_u64_t
+v_log_reduce (v_u64_t ix, int bits, v_f64_t *z, v_f64_t *kd)
+{
+  v_u64_t tmp;
+
+  tmp = ix - V_LOG_OFF;
+  *kd = v_small_s64_to_f64 ((v_s64_t) tmp >> 52);
+  *z = (v_f64_t) (ix - (tmp & 0xfffULL << 52));
+  return (tmp >> (52 - bits)) % (1 << bits);
+}
+
+V_ABI v_f64_t
+V_NAME (v, log) (v_f64_t x)
+{
+  const double *A = __log_data.poly;
+  const double *B = __log_data.poly1;
+  v_f64_t xs, z, r, r2, r3, y, invc, logc, logctail, kd, w, hi, lo;
+  v_u64_t ix, i;
+  v_s64_t special, near1;
+
+  special = ~((x >= 0x1p-1022) & (x < __builtin_inf ()));
+  xs = v_sel_f64 (special, (v_f64_t) {} + 2.0, x);
+  ix = (v_u64_t) xs;
+
+  i = v_log_reduce (ix, LOG_TABLE_BITS, &z, &kd);
+  invc = V_LOOKUP (__log_data.tab, i, invc);
+  logc = V_LOOKUP (__log_data.tab, i, logc);
+  logctail = V_LOOKUP (__log_data.tab, i, logctail);
+
+  /* r = z/c - 1, rounded once.  */
+#if __FP_FAST_FMA
+  r = v_fma_f64 (z, invc, (v_f64_t) {} - 1.0);
+#else
+  {
+    v_f64_t chi, clo;
+
+    chi = V_LOOKUP (__log_data.tab2, i, chi);
+    clo = V_LOOKUP (__log_data.tab2, i, clo);
+    r = (z - chi - clo) * invc;
+  }
+#endif
+
+  /* hi + lo = k ln2 + log(c) + r; k ln2hi + logc is exact.  */
+  w = kd * __log_data.ln2hi + logc;
+  hi = w + r;
+  lo = w - hi + r + kd * __log_data.ln2lo + logctail;
+
+  /* log(x) = lo + r^2 p(r) + hi.  */
+  r2 = r * r;
+  y = lo + r2 * A[0]
+      + r * r2 * (A[1] + r * A[2] + r2 * (A[3] + r * A[4])) + hi;
+
+  near1 = (xs >= 1.0 - 0x1p-4) & (xs < 1.0 + 0x1.09p-4);
+  if (unlikely (v_any_s64 (near1)))
+    {
+      /* log1p(r) = r - r^2/2 + r^3 p(r), with r = x - 1 exact and
+	 r - r^2/2 worked out in two parts, as log.c does.  */
+      v_f64_t rhi, rlo, y1;
+
+      r = xs - 1.0;
+      r2 = r * r;
+      r3 = r * r2;
+      y1 = r3 * (B[1] + r * B[2] + r2 * B[3]
+		 + r3 * (B[4] + r * B[5] + r2 * B[6]
+			 + r3 * (B[7] + r * B[8] + r2 * B[9] + r3 * B[10])));
+      w = r * 0x1p27;
+      rhi = r + w - w;
+      rlo = r - rhi;
+      w = rhi * rhi * B[0];
+      hi = r + w;
+      lo = r - hi + w;
+      lo += B[0] * rlo * (rhi + r);
+      y1 += lo;
+      y1 += hi;
+      y = v_sel_f64 (near1, y1, y);
+    }
+  if (unlikely (v_any_s64 (special)))
+    return v_call_f64 (__ieee754_log, x, y, special);
+  return y;
+}
+
+V_ABI v_f64_t
+V_NAME (v, log2) (v_f64_t x)
+{
+  const double *A = __log2_data.poly;
+  const double *B = __log2_data.poly1;
+  v_f64_t xs, z, r, r2, r4, y, invc, logc, logctail, kd, hi, lo;
+  v_f64_t t1, t2, t3, p;
+  v_u64_t ix, i;
+  v_s64_t special, near1;
+
+  special = ~((x >= 0x1p-1022) & (x < __builtin_inf ()));
+  xs = v_sel_f64 (special, (v_f64_t) {} + 2.0, x);
+  ix = (v_u64_t) xs;
+
+  i = v_log_reduce (ix, LOG2_TABLE_BITS, &z, &kd);
+  invc = V_LOOKUP (__log2_data.tab, i, invc);
+  logc = V_LOOKUP (__log2_data.tab, i, logc);
+  logctail = V_LOOKUP (__log2_data.tab, i, logctail);
+
+  /* t1 + t2 = r/ln2 with r = z/c - 1.  */
+#if __FP_FAST_FMA
+  r = v_fma_f64 (z, invc, (v_f64_t) {} - 1.0);
+  t1 = r * __log2_data.invln2hi;
+  t2 = r * __log2_data.invln2lo
+       + v_fma_f64 (r, (v_f64_t) {} + __log2_data.invln2hi, -t1);
+#else
+  {
+    v_f64_t chi, clo, rhi, rlo;
+
+    chi = V_LOOKUP (__log2_data.tab2, i, chi);
+    clo = V_LOOKUP (__log2_data.tab2, i, clo);
+    r = (z - chi - clo) * invc;
+    rhi = (v_f64_t) ((v_u64_t) r & -1ULL << 32);
+    rlo = r - rhi;
+    t1 = rhi * __log2_data.invln2hi;
+    t2 = rlo * __log2_data.invln2hi + r * __log2_data.invln2lo;
+  }
+#endif
+
+  /* hi + lo = k + log2(c) + r/ln2; k + logc is exact.  */
+  t3 = kd + logc;
+  hi = t3 + t1;
+  lo = t3 - hi + t1 + t2 + logctail;
+
+  /* log2(x) = lo + r^2 p(r) + hi.  */
+  r2 = r * r;
+  r4 = r2 * r2;
+  p = A[0] + r * A[1] + r2 * (A[2] + r * A[3]) + r4 * (A[4] + r * A[5]);
+  y = lo + r2 * p + hi;
+
+  near1 = (xs >= 1.0 - 0x1.5b51p-5) & (xs < 1.0 + 0x1.6ab2p-5);
+  if (unlikely (v_any_s64 (near1)))
+    {
+      /* log2(x) = r/ln2 + r^2 p(r) with r = x - 1 exact, as log2.c
+	 does.  */
+      v_f64_t y1;
+
+      r = xs - 1.0;
+#if __FP_FAST_FMA
+      hi = r * __log2_data.invln2hi;
+      lo = r * __log2_data.invln2lo
+	   + v_fma_f64 (r, (v_f64_t) {} + __log2_data.invln2hi, -hi);
+#else
+      {
+	v_f64_t rhi, rlo;
+
+	rhi = (v_f64_t) ((v_u64_t) r & -1ULL << 32);
+	rlo = r - rhi;
+	hi = rhi * __log2_data.invln2hi;
+	lo = rlo * __log2_data.invln2hi + r * __log2_data.invln2lo;
+      }
+#endif
+      r2 = r * r;
+      r4 = r2 * r2;
+      p = r2 * (B[0] + r * B[1]);
+      y1 = hi + p;
+      lo += hi - y1 + p;
+      lo += r4 * (B[2] + r * B[3] + r2 * (B[4] + r * B[5])
+		  + r4 * (B[6] + r * B[7] + r2 * (B[8] + r * B[9])));
+      y1 += lo;
+      y = v_sel_f64 (near1, y1, y);
+    }
+  if (unlikely (v_any_s64 (special)))
+    return v_call_f64 (__ieee754_log2, x, y, special);
+  return y;
+}
+
+/* x = 2^k z with z in [V_LOGF_OFF, 2 V_LOGF_OFF) exact, as in logf.c:
+   set *z and *k and return the index into a table of 2^bits entries.  */
+static ALWAYS_INLINE v_u32_t
+v_logf_reduce (v_u32_t ix, int bits, v_f32_t *z, v_s32_t *k)
+{
+  v_u32_t tmp;
+
+  tmp = ix - V_LOGF_OFF;
+  *k = (v_s32_t) tmp >> 23;
+  *z = (v_f32_t) (ix - (tmp & 0xff800000));
+  return (tmp >> (23 - bits)) % (1 << bits);
+}
+
+/* logf of half the lanes, in double, from the halves of what
+   v_logf_reduce gives.  */
+static ALWAYS_INLINE v_f64_t
+v_logf_half (v_f64_t z, v_f64_t kd, v_u64_t i)
+{
+  const double *A = __logf_data.poly;
+  v_f64_t r, r2, y, y0, invc, logc;
+
+  invc = V_LOOKUP (__logf_data.tab, i, invc);
+  logc = V_LOOKUP (__logf_data.tab, i, logc);
+
+  /* log(x) = log1p(z/c - 1) + log(c) + k ln2.  */
+  r = z * invc - 1;
+  y0 = logc + kd * __logf_data.ln2;
+  r2 = r * r;
+  y = A[1] * r + A[2];
+  y = A[0] * r2 + y;
+  return y * r2 + (y0 + r);
+}
+
+V_ABI v_f32_t
+V_NAMEF (v, logf) (v_f32_t x)
+{
+  v_u32_t ix, i;
+  v_s32_t special, k;
+  v_f32_t z, res;
+
+  ix = (v_u32_t) x;
+  special = ix - 0x00800000 >= 0x7f800000 - 0x00800000;
+  ix = v_sel_u32 (special, (v_u32_t) {} + 0x40000000, ix);
+
+  i = v_logf_reduce (ix, LOGF_TABLE_BITS, &z, &k);
+  res = v_narrow_f64 (v_logf_half (v_lo_f32 (z), v_lo_s32_f64 (k),
+				   v_lo_u32 (i)),
+		      v_logf_half (v_hi_f32 (z), v_hi_s32_f64 (k),
+				   v_hi_u32 (i)));
+  /* The table has no entry for c = 1 to make log(1) exactly 0.  */
+  res = v_sel_f32 (ix == 0x3f800000, (v_f32_t) {}, res);
+  if (unlikely (v_any_s32 (special)))
+    return v_call_f32 (__ieee754_logf, x, res, special);
+  return res;
+}
+
+static ALWAYS_INLINE v_f64_t
+v_log2f_half (v_f64_t z, v_f64_t kd, v_u64_t i)
+{
+  const double *A = __log2f_data.poly;
+  v_f64_t r, r2, p, y, y0, invc, logc;
+
+  invc = V_LOOKUP (__log2f_data.tab, i, invc);
+  logc = V_LOOKUP (__log2f_data.tab, i, logc);
+
+  /* log2(x) = log1p(z/c - 1)/ln2 + log2(c) + k.  */
+  r = z * invc - 1;
+  y0 = logc + kd;
+  r2 = r * r;
+  y = A[1] * r + A[2];
+  y = A[0] * r2 + y;
+  p = A[3] * r + y0;
+  return y * r2 + p;
+}
+
+V_ABI v_f32_t
+V_NAMEF (v, log2f) (v_f32_t x)
+{
+  v_u32_t ix, i;
+  v_s32_t special, k;
+  v_f32_t z, res;
+
+  ix = (v_u32_t) x;
+  special = ix - 0x00800000 >= 0x7f800000 - 0x00800000;
+  ix = v_sel_u32 (special, (v_u32_t) {} + 0x40000000, ix);
+
+  i = v_logf_reduce (ix, LOG2F_TABLE_BITS, &z, &k);
+  res = v_narrow_f64 (v_log2f_half (v_lo_f32 (z), v_lo_s32_f64 (k),
+				    v_lo_u32 (i)),
+		      v_log2f_half (v_hi_f32 (z), v_hi_s32_f64 (k),
+				    v_hi_u32 (i)));
+  res = v_sel_f32 (ix == 0x3f800000, (v_f32_t) {}, res);
+  if (unlikely (v_any_s32 (special)))
+    return v_call_f32 (__ieee754_log2f, x, res, special);
+  return res;
+}
+
+#undef V_LOG_OFF
+#undef V_LOGF_OFF
@@ -0,0 +1,278 @@
+/* v_math.h -- internal definitions for the vector math functions.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* The vector functions are written once, in v_exp.h, v_log.h, v_pow.h
+   and v_sincos.h, with GCC's vector extensions, and compiled once per
+   instruction set by a file in libm/machine that defines
+
+	V_ISA		the letter of the instruction set in the names the
+			vector function ABI gives the functions: b, c, d
+			and e for SSE2, AVX, AVX2 and AVX-512 on x86_64,
+			n for AdvSIMD on AArch64
+	V_N		the number of doubles in a vector
+	V_NF		the number of floats in a vector, 2 * V_N
+	V_PTRREG	the size in bytes of the pieces a vector of
+			pointers is passed in
+	V_ABI		attributes the ABI wants on the functions, if any
+
+   and then includes the templates, after fdlibm.h.  Each function works
+   out its lanes as the scalar one in libm/common does, with the same
+   tables, and the lanes that the scalar one would send down a special
+   case branch are computed again by it, one at a time.  They are not
+   meant to set errno, math.h only declaring them with -fno-math-errno,
+   but those lanes may with --disable-newlib-matherr.  They may raise
+   invalid for a quiet NaN, which their range checks compare.  */
+
+#ifndef _V_MATH_H
+#define _V_MATH_H
+
+#include "math_config.h"
+
+#ifndef V_ABI
+# define V_ABI
+#endif
+
+#define V_MANGLE_(isa, n, args, f) _ZGV ## isa ## N ## n ## args ## _ ## f
+#define V_MANGLE(isa, n, args, f) V_MANGLE_ (isa, n, args, f)
+/* The name of the V_N lane version of f, args being the letters for its
+   parameters, v for a vector and l<step> for a linear pointer.  */
+#define V_NAME(args, f) V_MANGLE (V_ISA, V_N, args, f)
+#define V_NAMEF(args, f) V_MANGLE (V_ISA, V_NF, args, f)
+
+#define V_BYTES (V_N * 8)
+
+typedef double v_f64_t __attribute__ ((__vector_size__ (V_BYTES)));
+typedef uint64_t v_u64_t __attribute__ ((__vector_size__ (V_BYTES)));
+typedef int64_t v_s64_t __attribute__ ((__vector_size__ (V_BYTES)));
+typedef float v_f32_t __attribute__ ((__vector_size__ (V_BYTES)));
+typedef uint32_t v_u32_t __attribute__ ((__vector_size__ (V_BYTES)));
+typedef int32_t v_s32_t __attribute__ ((__vector_size__ (V_BYTES)));
+/* Half of a vector of floats, for the float functions, which work in
+   double as the scalar ones do, on each half in turn.  */
+typedef float v_f32h_t __attribute__ ((__vector_size__ (V_BYTES / 2)));
+typedef uint32_t v_u32h_t __attribute__ ((__vector_size__ (V_BYTES / 2)));
+typedef int32_t v_s32h_t __attribute__ ((__vector_size__ (V_BYTES / 2)));
+
+/* A vector of pointers comes in pieces of this type.  */
+typedef uint64_t v_ptr_t __attribute__ ((__vector_size__ (V_PTRREG)));
+
+/* Masks are the result of comparisons: all ones in a lane for true.  */
+
+static ALWAYS_INLINE v_f64_t
+v_sel_f64 (v_s64_t m, v_f64_t a, v_f64_t b)
+{
+  return (v_f64_t) (((v_s64_t) a & m) | ((v_s64_t) b & ~m));
+}
+
+static ALWAYS_INLINE v_u32_t
+v_sel_u32 (v_s32_t m, v_u32_t a, v_u32_t b)
+{
+  return (a & (v_u32_t) m) | (b & ~(v_u32_t) m);
+}
+
+static ALWAYS_INLINE v_f32_t
+v_sel_f32 (v_s32_t m, v_f32_t a, v_f32_t b)
+{
+  return (v_f32_t) (((v_s32_t) a & m) | ((v_s32_t) b & ~m));
+}
+
+static ALWAYS_INLINE int
+v_any_s64 (v_s64_t m)
+{
+  int64_t r = 0;
+  int i;
+
+  for (i = 0; i < V_N; i++)
+    r |= m[i];
+  return r != 0;
+}
+
+static ALWAYS_INLINE int
+v_any_s32 (v_s32_t m)
+{
+  int32_t r = 0;
+  int i;
+
+  for (i = 0; i < V_NF; i++)
+    r |= m[i];
+  return r != 0;
+}
+
+/* Halves of vectors of floats and of 32 bit integers, widened to
+   double and 64 bit lanes, and back.  */
+
+#define V_HALF(name, t, th, tw, h)				\
+static ALWAYS_INLINE tw						\
+name (t x)							\
+{								\
+  th r;								\
+								\
+  __builtin_memcpy (&r, (char *) &x + (h) * sizeof r, sizeof r);	\
+  return __builtin_convertvector (r, tw);			\
+}
+
+V_HALF (v_lo_f32, v_f32_t, v_f32h_t, v_f64_t, 0)
+V_HALF (v_hi_f32, v_f32_t, v_f32h_t, v_f64_t, 1)
+V_HALF (v_lo_u32, v_u32_t, v_u32h_t, v_u64_t, 0)
+V_HALF (v_hi_u32, v_u32_t, v_u32h_t, v_u64_t, 1)
+V_HALF (v_lo_s32_f64, v_s32_t, v_s32h_t, v_f64_t, 0)
+V_HALF (v_hi_s32_f64, v_s32_t, v_s32h_t, v_f64_t, 1)
+
+#undef V_HALF
+
+static ALWAYS_INLINE v_f32_t
+v_narrow_f64 (v_f64_t lo, v_f64_t hi)
+{
+  v_f32h_t h[2] = { __builtin_convertvector (lo, v_f32h_t),
+		    __builtin_convertvector (hi, v_f32h_t) };
+  v_f32_t r;
+
+  __builtin_memcpy (&r, h, sizeof r);
+  return r;
+}
+
+static ALWAYS_INLINE v_s32_t
+v_narrow_s64 (v_s64_t lo, v_s64_t hi)
+{
+  v_s32h_t h[2] = { __builtin_convertvector (lo, v_s32h_t),
+		    __builtin_convertvector (hi, v_s32h_t) };
+  v_s32_t r;
+
+  __builtin_memcpy (&r, h, sizeof r);
+  return r;
+}
+
+static ALWAYS_INLINE v_f64_t
+v_abs_f64 (v_f64_t x)
+{
+  return (v_f64_t) ((v_u64_t) x & 0x7fffffffffffffff);
+}
+
+/* The range checks on doubles compare them as doubles, which they can
+   all do, rather than their bits, which SSE2 cannot.  */
+
+/* x with its sign flipped in the lanes where m has the top bit set.  */
+static ALWAYS_INLINE v_f64_t
+v_negate_f64 (v_u64_t m, v_f64_t x)
+{
+  return (v_f64_t) ((v_u64_t) x ^ (m & 0x8000000000000000));
+}
+
+/* Lanes of an integer k with |k| < 2^51 as doubles, with the shift that
+   rounds to an integer run backwards.  */
+static ALWAYS_INLINE v_f64_t
+v_small_s64_to_f64 (v_s64_t k)
+{
+  return (v_f64_t) (k + (int64_t) 0x4338000000000000) - 0x1.8p52;
+}
+
+#if __FP_FAST_FMA
+/* x * y + z rounded once, which the targets that have it compile to
+   their vector fma.  */
+static ALWAYS_INLINE v_f64_t
+v_fma_f64 (v_f64_t x, v_f64_t y, v_f64_t z)
+{
+  v_f64_t r;
+  int i;
+
+  for (i = 0; i < V_N; i++)
+    r[i] = __builtin_fma (x[i], y[i], z[i]);
+  return r;
+}
+#endif
+
+/* Table lookups, with a gather where there is one and a lane at a time
+   where there is not.  */
+
+#if (defined (__AVX512F__) && V_N == 8) || (defined (__AVX2__) && V_N == 4)
+# include <immintrin.h>
+#endif
+
+static ALWAYS_INLINE v_u64_t
+v_lookup_u64 (const uint64_t *tab, v_u64_t i)
+{
+#if defined (__AVX512F__) && V_N == 8
+  return (v_u64_t) _mm512_i64gather_epi64 ((__m512i) i, tab, 8);
+#elif defined (__AVX2__) && V_N == 4
+  return (v_u64_t) _mm256_i64gather_epi64 ((const long long *) tab,
+					   (__m256i) i, 8);
+#else
+  v_u64_t r;
+  int j;
+
+  for (j = 0; j < V_N; j++)
+    r[j] = tab[i[j]];
+  return r;
+#endif
+}
+
+/* Field f of entry i of the array of structs of doubles tab.  */
+#define V_LOOKUP(tab, i, f)						\
+  ((v_f64_t) v_lookup_u64 ((const uint64_t *) &(tab)[0].f,		\
+			   (i) * (sizeof (tab)[0] / sizeof (double))))
+
+/* GCC takes a call that returns no vector to leave the upper halves of
+   the AVX registers clean for SSE code, but does not clean them itself
+   on the way out of a function that takes a vector; sincos and sincosf
+   do it with this.  */
+#ifdef __AVX__
+# define V_CLEAN_UPPER() __builtin_ia32_vzeroupper ()
+#else
+# define V_CLEAN_UPPER() ((void) 0)
+#endif
+
+/* y with its lanes in m replaced by f of those of x (and of x2).  Kept
+   out of line so that the common case stays small.  */
+
+static NOINLINE v_f64_t
+v_call_f64 (double (*f) (double), v_f64_t x, v_f64_t y, v_s64_t m)
+{
+  int i;
+
+  for (i = 0; i < V_N; i++)
+    if (m[i])
+      y[i] = f (x[i]);
+  return y;
+}
+
+static NOINLINE v_f64_t
+v_call2_f64 (double (*f) (double, double), v_f64_t x, v_f64_t x2,
+	     v_f64_t y, v_s64_t m)
+{
+  int i;
+
+  for (i = 0; i < V_N; i++)
+    if (m[i])
+      y[i] = f (x[i], x2[i]);
+  return y;
+}
+
+static NOINLINE v_f32_t
+v_call_f32 (float (*f) (float), v_f32_t x, v_f32_t y, v_s32_t m)
+{
+  int i;
+
+  for (i = 0; i < V_NF; i++)
+    if (m[i])
+      y[i] = f (x[i]);
+  return y;
+}
+
+static NOINLINE v_f32_t
+v_call2_f32 (float (*f) (float, float), v_f32_t x, v_f32_t x2,
+	     v_f32_t y, v_s32_t m)
+{
+  int i;
+
+  for (i = 0; i < V_NF; i++)
+    if (m[i])
+      y[i] = f (x[i], x2[i]);
+  return y;
+}
+
+#endif /* _V_MATH_H */
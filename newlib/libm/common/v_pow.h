@@ -0,0 +1,214 @@
+/* v_pow.h -- vector pow and powf.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* As pow.c and powf.c, a lane at a time.  Lanes where x is not positive
+   and normal, where y is 0, inf or nan (or, for pow, |y| < 2^-65 or
+   |y| >= 2^63), or where y log(x) puts the result near or past the ends
+   of the range of normal numbers are left to the scalar functions,
+   which also covers negative x with an integer y.  x and y are set to 1
+   in those lanes for the vector code so that it raises no exceptions for
+   them.  */
+
+#include "v_math.h"
+
+#define V_POW_OFF 0x3fe6955500000000
+#define V_POWF_OFF 0x3f330000
+
+/* log(x) = hi + *tail for the bits ix of a positive normal x, as
+   log_inline in pow.c.  */
+static ALWAYS_INLINE v_f64_t
+v_pow_log (v_u64_t ix, v_f64_t *tail)
+{
+  const double *A = __pow_log_data.poly;
+  v_f64_t z, r, r2, y, invc, logc, logctail, kd, hi, t1, t2, lo, lo1, lo2;
+  v_f64_t p, ar, lo3, lo4;
+  v_u64_t iz, tmp, i;
+
+  tmp = ix - V_POW_OFF;
+  i = (tmp >> (52 - POW_LOG_TABLE_BITS)) % (1 << POW_LOG_TABLE_BITS);
+  kd = v_small_s64_to_f64 ((v_s64_t) tmp >> 52);
+  iz = ix - (tmp & 0xfffULL << 52);
+  z = (v_f64_t) iz;
+  invc = V_LOOKUP (__pow_log_data.tab, i, invc);
+  logc = V_LOOKUP (__pow_log_data.tab, i, logc);
+  logctail = V_LOOKUP (__pow_log_data.tab, i, logctail);
+
+  /* r = z invc - 1, which is exact.  */
+#if __FP_FAST_FMA
+  r = v_fma_f64 (z, invc, (v_f64_t) {} - 1.0);
+#else
+  v_f64_t zhi, zlo, rhi, rlo;
+
+  zhi = (v_f64_t) ((iz + (1ULL << 31)) & (-1ULL << 32));
+  zlo = z - zhi;
+  rhi = zhi * invc - 1.0;
+  rlo = zlo * invc;
+  r = rhi + rlo;
+#endif
+
+  /* k ln2 + log(c) + r.  */
+  t1 = kd * __pow_log_data.ln2hi + logc;
+  t2 = t1 + r;
+  lo1 = kd * __pow_log_data.ln2lo + logctail;
+  lo2 = t1 - t2 + r;
+
+  /* k ln2 + log(c) + r - r^2/2, with the rounding error of each step in
+     lo3 and lo4.  */
+  ar = -0.5 * r;
+#if __FP_FAST_FMA
+  v_f64_t ar2 = r * ar;
+  hi = t2 + ar2;
+  lo3 = v_fma_f64 (ar, r, -ar2);
+  lo4 = t2 - hi + ar2;
+#else
+  v_f64_t arhi, arhi2;
+
+  arhi = -0.5 * rhi;
+  arhi2 = rhi * arhi;
+  hi = t2 + arhi2;
+  lo3 = rlo * (ar + arhi);
+  lo4 = t2 - hi + arhi2;
+#endif
+  r2 = r * r;
+  p = r2 * r * (A[0] + r * A[1] + r2 * (A[2] + r * A[3]
+					+ r2 * (A[4] + r * A[5])));
+  lo = lo1 + lo2 + lo3 + lo4 + p;
+  y = hi + lo;
+  *tail = hi - y + lo;
+  return y;
+}
+
+V_ABI v_f64_t
+V_NAME (vv, pow) (v_f64_t x, v_f64_t y)
+{
+  const double *C = __exp_data.poly;
+  v_f64_t xs, ys, ay, hi, lo, ehi, elo, z, kd, r, r2, scale, tail, tmp;
+  v_f64_t res;
+  v_u64_t ki, idx, sbits;
+  v_s64_t special;
+
+  ay = v_abs_f64 (y);
+  special = ~((x >= 0x1p-1022) & (x < __builtin_inf ())
+	      & (ay >= 0x1p-65) & (ay < 0x1p63));
+  xs = v_sel_f64 (special, (v_f64_t) {} + 1.0, x);
+  ys = v_sel_f64 (special, (v_f64_t) {} + 1.0, y);
+
+  hi = v_pow_log ((v_u64_t) xs, &lo);
+#if __FP_FAST_FMA
+  ehi = ys * hi;
+  elo = ys * lo + v_fma_f64 (ys, hi, -ehi);
+#else
+  v_f64_t yhi, ylo, lhi, llo;
+
+  yhi = (v_f64_t) ((v_u64_t) ys & -1ULL << 27);
+  ylo = ys - yhi;
+  lhi = (v_f64_t) ((v_u64_t) hi & -1ULL << 27);
+  llo = hi - lhi + lo;
+  ehi = yhi * lhi;
+  elo = ylo * lhi + ys * llo;
+#endif
+
+  /* exp(ehi + elo) as exp_inline in pow.c, the lanes of which that
+     would need its special case joining the others.  */
+  special |= ~(v_abs_f64 (ehi) < 512.0);
+  ehi = v_sel_f64 (special, (v_f64_t) {}, ehi);
+  elo = v_sel_f64 (special, (v_f64_t) {}, elo);
+  z = __exp_data.invln2N * ehi;
+  kd = z + __exp_data.shift;
+  ki = (v_u64_t) kd;
+  kd -= __exp_data.shift;
+  r = ehi + kd * __exp_data.negln2hiN + kd * __exp_data.negln2loN;
+  r += elo;
+  idx = 2 * (ki % (1 << EXP_TABLE_BITS));
+  tail = (v_f64_t) v_lookup_u64 (__exp_data.tab, idx);
+  sbits = v_lookup_u64 (__exp_data.tab + 1, idx)
+	  + (ki << (52 - EXP_TABLE_BITS));
+  r2 = r * r;
+  tmp = tail + r + r2 * (C[0] + r * C[1]) + r2 * r2 * (C[2] + r * C[3]);
+  scale = (v_f64_t) sbits;
+  res = scale + scale * tmp;
+  if (unlikely (v_any_s64 (special)))
+    return v_call2_f64 (__ieee754_pow, x, y, res, special);
+  return res;
+}
+
+/* powf of half the lanes, in double, from the halves of the reduction
+   of x as in v_logf_reduce and of y, as log2_inline and exp2_inline in
+   powf.c.  Lanes where |y log2(x)| >= 126 are flagged in *special.  */
+static ALWAYS_INLINE v_f64_t
+v_powf_half (v_f64_t z, v_f64_t kd, v_u64_t i, v_f64_t y, v_s64_t *special)
+{
+  const double *A = __log2f_data.powf_poly;
+  const double *C = __exp2f_data.poly;
+  v_f64_t r, r2, r4, p, q, l, y0, invc, logc, ylogx, s;
+  v_u64_t ki, t;
+
+  invc = V_LOOKUP (__log2f_data.tab, i, invc);
+  logc = V_LOOKUP (__log2f_data.tab, i, logc);
+
+  /* log2(x) = log1p(z/c - 1)/ln2 + log2(c) + k.  */
+  r = z * invc - 1;
+  y0 = logc + kd;
+  r2 = r * r;
+  l = A[0] * r + A[1];
+  p = A[2] * r + A[3];
+  r4 = r2 * r2;
+  q = A[4] * r + y0;
+  q = p * r2 + q;
+  l = l * r4 + q;
+  ylogx = y * l;
+
+  *special = ~(v_abs_f64 (ylogx) < 126.0);
+  ylogx = v_sel_f64 (*special, (v_f64_t) {}, ylogx);
+  kd = ylogx + __exp2f_data.shift_scaled;
+  ki = (v_u64_t) kd;
+  kd -= __exp2f_data.shift_scaled;
+  r = ylogx - kd;
+  t = v_lookup_u64 (__exp2f_data.tab, ki % (1 << EXP2F_TABLE_BITS));
+  t += ki << (52 - EXP2F_TABLE_BITS);
+  s = (v_f64_t) t;
+  q = C[0] * r + C[1];
+  r2 = r * r;
+  p = C[2] * r + 1;
+  p = q * r2 + p;
+  return p * s;
+}
+
+V_ABI v_f32_t
+V_NAMEF (vv, powf) (v_f32_t x, v_f32_t y)
+{
+  v_u32_t ix, iy, tmp, i;
+  v_s32_t special, k;
+  v_s64_t slo, shi;
+  v_f32_t xs, ys, z, res;
+
+  ix = (v_u32_t) x;
+  iy = (v_u32_t) y;
+  special = (ix - 0x00800000 >= 0x7f800000 - 0x00800000)
+	    | (2 * iy - 1 >= 2u * 0x7f800000 - 1);
+  xs = v_sel_f32 (special, (v_f32_t) {} + 1.0f, x);
+  ys = v_sel_f32 (special, (v_f32_t) {} + 1.0f, y);
+
+  /* x = 2^k z as in logf.c.  */
+  tmp = (v_u32_t) xs - V_POWF_OFF;
+  i = (tmp >> (23 - LOG2F_TABLE_BITS)) % (1 << LOG2F_TABLE_BITS);
+  k = (v_s32_t) tmp >> 23;
+  z = (v_f32_t) ((v_u32_t) xs - (tmp & 0xff800000));
+
+  res = v_narrow_f64 (v_powf_half (v_lo_f32 (z), v_lo_s32_f64 (k),
+				   v_lo_u32 (i), v_lo_f32 (ys), &slo),
+		      v_powf_half (v_hi_f32 (z), v_hi_s32_f64 (k),
+				   v_hi_u32 (i), v_hi_f32 (ys), &shi));
+  special |= v_narrow_s64 (slo, shi);
+  if (unlikely (v_any_s32 (special)))
+    return v_call2_f32 (__ieee754_powf, x, y, res, special);
+  return res;
+}
+
+#undef V_POW_OFF
+#undef V_POWF_OFF
@@ -0,0 +1,325 @@
+/* v_sincos.h -- vector sin, cos, sincos, sinf, cosf and sincosf.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* With the reduction and the polynomials of k_sincos.h.  Every lane is
+   reduced, so that both polynomials are needed for each of them, and
+   sin and cos pick theirs by n mod 4 as sincos does.  The double
+   functions only do the first round of the Cody-Waite reduction; lanes
+   that need a later one, lanes with |x| >= 2^20 pi/2 (|x| >= 2^20 for
+   the float functions), and inf and nan, are left to the scalar
+   functions.
+
+   sincos and sincosf come in two forms: vvv, as GCC calls them for
+   __attribute__ ((__simd__)), where the pointers come in vectors, each
+   in pieces of V_PTRREG bytes, and vl8l8 (vl4l4), as for
+   "#pragma omp declare simd linear (s, c)", where they point to arrays
+   of V_N (V_NF) elements.  */
+
+#include "v_math.h"
+#include "../math/k_sincos.h"
+
+/* Set *y0 + *y1 = x - n pi/2 with |*y0 + *y1| <= pi/4 and return n, as
+   rem_pio2 does, except that the lanes it would take further than the
+   first round are flagged in *special and reduced as 0.  */
+static ALWAYS_INLINE v_u64_t
+v_rem_pio2 (v_f64_t x, v_f64_t *y0, v_f64_t *y1, v_s64_t *special)
+{
+  v_f64_t fn, r, w, e;
+  v_u64_t n;
+
+  /* A power of two 16 binades below x.  */
+  e = (v_f64_t) ((v_u64_t) x & 0x7ff0000000000000) * 0x1p-16;
+  *special = ~(v_abs_f64 (x) < 0x1.921fbp20);
+  x = v_sel_f64 (*special, (v_f64_t) {}, x);
+  fn = x * InvPio2 + Shift;
+  n = (v_u64_t) fn;
+  fn -= Shift;
+  r = x - fn * Pio2_1;
+  w = fn * Pio2_1t;
+  *y0 = r - w;
+  /* Cancellation of more than 16 bits.  */
+  *special |= v_abs_f64 (*y0) < e;
+  *y1 = (r - *y0) - w;
+  return n;
+}
+
+/* sin(x + y) and cos(x + y) for |x + y| <= pi/4, as sincos_poly.  */
+static ALWAYS_INLINE void
+v_sincos_poly (v_f64_t x, v_f64_t y, v_f64_t *s, v_f64_t *c)
+{
+  v_f64_t z, w, r, v, hz;
+
+  z = x * x;
+  w = z * z;
+  r = S2 + z * (S3 + z * S4) + z * w * (S5 + z * S6);
+  v = z * x;
+  *s = x - ((z * (0.5 * y - v * r) - y) - v * S1);
+  r = z * (C1 + z * (C2 + z * C3)) + w * w * (C4 + z * (C5 + z * C6));
+  hz = 0.5 * z;
+  w = 1.0 - hz;
+  *c = w + (((1.0 - w) - hz) + (z * r - x * y));
+}
+
+V_ABI v_f64_t
+V_NAME (v, sin) (v_f64_t x)
+{
+  v_f64_t y0, y1, s, c, y;
+  v_u64_t n;
+  v_s64_t special;
+
+  n = v_rem_pio2 (x, &y0, &y1, &special);
+  v_sincos_poly (y0, y1, &s, &c);
+  y = v_sel_f64 ((v_s64_t) -(n & 1), c, s);
+  y = v_negate_f64 (n << 62, y);
+  if (unlikely (v_any_s64 (special)))
+    return v_call_f64 (sin, x, y, special);
+  return y;
+}
+
+V_ABI v_f64_t
+V_NAME (v, cos) (v_f64_t x)
+{
+  v_f64_t y0, y1, s, c, y;
+  v_u64_t n;
+  v_s64_t special;
+
+  n = v_rem_pio2 (x, &y0, &y1, &special);
+  v_sincos_poly (y0, y1, &s, &c);
+  y = v_sel_f64 ((v_s64_t) -(n & 1), s, c);
+  y = v_negate_f64 ((n + 1) << 62, y);
+  if (unlikely (v_any_s64 (special)))
+    return v_call_f64 (cos, x, y, special);
+  return y;
+}
+
+/* Store sin and cos of x to s[i] and c[i] for each lane i.  */
+static ALWAYS_INLINE void
+v_sincos_inline (v_f64_t x, double *s, double *c)
+{
+  v_f64_t y0, y1, sy, cy, t;
+  v_u64_t n;
+  v_s64_t special, odd;
+  int i;
+
+  n = v_rem_pio2 (x, &y0, &y1, &special);
+  v_sincos_poly (y0, y1, &sy, &cy);
+  odd = (v_s64_t) -(n & 1);
+  t = sy;
+  sy = v_negate_f64 (n << 62, v_sel_f64 (odd, cy, sy));
+  cy = v_negate_f64 ((n + 1) << 62, v_sel_f64 (odd, t, cy));
+  __builtin_memcpy (s, &sy, sizeof sy);
+  __builtin_memcpy (c, &cy, sizeof cy);
+  if (unlikely (v_any_s64 (special)))
+    for (i = 0; i < V_N; i++)
+      if (special[i])
+	{
+	  s[i] = sin (x[i]);
+	  c[i] = cos (x[i]);
+	}
+}
+
+/* Store the lanes of v through the pointers in the pieces p.  */
+static ALWAYS_INLINE void
+v_scatter_f64 (const v_ptr_t *p, const double *v)
+{
+  uint64_t a[V_N];
+  int i;
+
+  __builtin_memcpy (a, p, sizeof a);
+  for (i = 0; i < V_N; i++)
+    *(double *) (uintptr_t) a[i] = v[i];
+}
+
+V_ABI void
+V_NAME (vl8l8, sincos) (v_f64_t x, double *s, double *c)
+{
+  v_sincos_inline (x, s, c);
+  V_CLEAN_UPPER ();
+}
+
+/* Write the sin and cos of x to the pointers in the pieces sp and cp.  */
+static ALWAYS_INLINE void
+v_sincos_vvv (v_f64_t x, const v_ptr_t *sp, const v_ptr_t *cp)
+{
+  double s[V_N], c[V_N];
+
+  v_sincos_inline (x, s, c);
+  v_scatter_f64 (sp, s);
+  v_scatter_f64 (cp, c);
+}
+
+/* As above, for the float functions, in double on half the lanes at a
+   time.  The special lanes are found on the floats.  */
+
+static ALWAYS_INLINE v_u64_t
+v_rem_pio2f (v_f64_t x, v_f64_t *r)
+{
+  v_f64_t kd;
+  v_u64_t n;
+
+  kd = x * InvPio2 + Shift;
+  n = (v_u64_t) kd;
+  kd -= Shift;
+  *r = (x - kd * Pio2_1) - kd * Pio2_1t;
+  return n;
+}
+
+/* sin(x) and cos(x) of half the lanes.  */
+static ALWAYS_INLINE void
+v_sincosf_half (v_f64_t x, v_f64_t *s, v_f64_t *c)
+{
+  v_f64_t r, z, w, sy, cy;
+  v_u64_t n;
+  v_s64_t odd;
+
+  n = v_rem_pio2f (x, &r);
+  z = r * r;
+  w = z * z;
+  sy = r * (1.0 + z * (SF1 + z * SF2 + z * z * SF3));
+  cy = (1.0 + z * CF1) + w * (CF2 + z * CF3) + w * w * CF4;
+  odd = (v_s64_t) -(n & 1);
+  *s = v_negate_f64 (n << 62, v_sel_f64 (odd, cy, sy));
+  *c = v_negate_f64 ((n + 1) << 62, v_sel_f64 (odd, sy, cy));
+}
+
+static ALWAYS_INLINE v_s32_t
+v_sincosf_special (v_f32_t x)
+{
+  return ((v_u32_t) x & 0x7fffffff) >= 0x49800000;
+}
+
+V_ABI v_f32_t
+V_NAMEF (v, sinf) (v_f32_t x)
+{
+  v_f64_t slo, shi, clo, chi;
+  v_s32_t special;
+  v_f32_t xs, res;
+
+  special = v_sincosf_special (x);
+  xs = v_sel_f32 (special, (v_f32_t) {}, x);
+  v_sincosf_half (v_lo_f32 (xs), &slo, &clo);
+  v_sincosf_half (v_hi_f32 (xs), &shi, &chi);
+  res = v_narrow_f64 (slo, shi);
+  if (unlikely (v_any_s32 (special)))
+    return v_call_f32 (sinf, x, res, special);
+  return res;
+}
+
+V_ABI v_f32_t
+V_NAMEF (v, cosf) (v_f32_t x)
+{
+  v_f64_t slo, shi, clo, chi;
+  v_s32_t special;
+  v_f32_t xs, res;
+
+  special = v_sincosf_special (x);
+  xs = v_sel_f32 (special, (v_f32_t) {}, x);
+  v_sincosf_half (v_lo_f32 (xs), &slo, &clo);
+  v_sincosf_half (v_hi_f32 (xs), &shi, &chi);
+  res = v_narrow_f64 (clo, chi);
+  if (unlikely (v_any_s32 (special)))
+    return v_call_f32 (cosf, x, res, special);
+  return res;
+}
+
+static ALWAYS_INLINE void
+v_sincosf_inline (v_f32_t x, float *s, float *c)
+{
+  v_f64_t slo, shi, clo, chi;
+  v_s32_t special;
+  v_f32_t xs, sf, cf;
+  int i;
+
+  special = v_sincosf_special (x);
+  xs = v_sel_f32 (special, (v_f32_t) {}, x);
+  v_sincosf_half (v_lo_f32 (xs), &slo, &clo);
+  v_sincosf_half (v_hi_f32 (xs), &shi, &chi);
+  sf = v_narrow_f64 (slo, shi);
+  cf = v_narrow_f64 (clo, chi);
+  __builtin_memcpy (s, &sf, sizeof sf);
+  __builtin_memcpy (c, &cf, sizeof cf);
+  if (unlikely (v_any_s32 (special)))
+    for (i = 0; i < V_NF; i++)
+      if (special[i])
+	{
+	  s[i] = sinf (x[i]);
+	  c[i] = cosf (x[i]);
+	}
+}
+
+static ALWAYS_INLINE void
+v_scatter_f32 (const v_ptr_t *p, const float *v)
+{
+  uint64_t a[V_NF];
+  int i;
+
+  __builtin_memcpy (a, p, sizeof a);
+  for (i = 0; i < V_NF; i++)
+    *(float *) (uintptr_t) a[i] = v[i];
+}
+
+V_ABI void
+V_NAMEF (vl4l4, sincosf) (v_f32_t x, float *s, float *c)
+{
+  v_sincosf_inline (x, s, c);
+  V_CLEAN_UPPER ();
+}
+
+static ALWAYS_INLINE void
+v_sincosf_vvv (v_f32_t x, const v_ptr_t *sp, const v_ptr_t *cp)
+{
+  float s[V_NF], c[V_NF];
+
+  v_sincosf_inline (x, s, c);
+  v_scatter_f32 (sp, s);
+  v_scatter_f32 (cp, c);
+}
+
+#if V_BYTES == V_PTRREG
+V_ABI void
+V_NAME (vvv, sincos) (v_f64_t x, v_ptr_t s, v_ptr_t c)
+{
+  v_sincos_vvv (x, &s, &c);
+  V_CLEAN_UPPER ();
+}
+
+V_ABI void
+V_NAMEF (vvv, sincosf) (v_f32_t x, v_ptr_t s0, v_ptr_t s1,
+			v_ptr_t c0, v_ptr_t c1)
+{
+  v_ptr_t s[2] = { s0, s1 }, c[2] = { c0, c1 };
+
+  v_sincosf_vvv (x, s, c);
+  V_CLEAN_UPPER ();
+}
+#elif V_BYTES == 2 * V_PTRREG
+/* AVX, which has floating-point vectors twice as wide as its integer
+   ones.  */
+V_ABI void
+V_NAME (vvv, sincos) (v_f64_t x, v_ptr_t s0, v_ptr_t s1,
+		      v_ptr_t c0, v_ptr_t c1)
+{
+  v_ptr_t s[2] = { s0, s1 }, c[2] = { c0, c1 };
+
+  v_sincos_vvv (x, s, c);
+  V_CLEAN_UPPER ();
+}
+
+V_ABI void
+V_NAMEF (vvv, sincosf) (v_f32_t x, v_ptr_t s0, v_ptr_t s1, v_ptr_t s2,
+			v_ptr_t s3, v_ptr_t c0, v_ptr_t c1, v_ptr_t c2,
+			v_ptr_t c3)
+{
+  v_ptr_t s[4] = { s0, s1, s2, s3 }, c[4] = { c0, c1, c2, c3 };
+
+  v_sincosf_vvv (x, s, c);
+  V_CLEAN_UPPER ();
+}
+#else
+# error "V_PTRREG does not fit V_N"
+#endif
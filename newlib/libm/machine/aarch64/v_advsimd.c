@@ -0,0 +1,85 @@
+/* v_advsimd.c -- the AdvSIMD versions of the vector math functions,
+ * _ZGVn*.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* See v_math.h.  The ABI has these keep v8-v23 as well as the usual
+   callee-saved registers, as GCC assumes of anything it calls through a
+   simd declaration.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#define V_ISA n
+#define V_N 2
+#define V_NF 4
+#define V_PTRREG 16
+#define V_ABI __attribute__ ((__aarch64_vector_pcs__))
+
+#include "v_exp.h"
+#include "v_log.h"
+#include "v_pow.h"
+#include "v_sincos.h"
+
+/* GCC also calls the float functions with two lanes, in the lower half
+   of a register; those go through the four lane ones.  */
+
+typedef float v_f32x2_t __attribute__ ((__vector_size__ (8)));
+
+#define V_F32X2(f)					\
+V_ABI v_f32x2_t						\
+V_MANGLE (n, 2, v, f) (v_f32x2_t x)			\
+{							\
+  v_f32_t y = { x[0], x[1], x[0], x[1] };		\
+							\
+  y = V_NAMEF (v, f) (y);				\
+  return (v_f32x2_t) { y[0], y[1] };			\
+}
+
+V_F32X2 (expf)
+V_F32X2 (exp2f)
+V_F32X2 (logf)
+V_F32X2 (log2f)
+V_F32X2 (sinf)
+V_F32X2 (cosf)
+
+#undef V_F32X2
+
+V_ABI v_f32x2_t
+V_MANGLE (n, 2, vv, powf) (v_f32x2_t x, v_f32x2_t y)
+{
+  v_f32_t x4 = { x[0], x[1], x[0], x[1] }, y4 = { y[0], y[1], y[0], y[1] };
+
+  x4 = V_NAMEF (vv, powf) (x4, y4);
+  return (v_f32x2_t) { x4[0], x4[1] };
+}
+
+V_ABI void
+V_MANGLE (n, 2, vl4l4, sincosf) (v_f32x2_t x, float *s, float *c)
+{
+  float st[4], ct[4];
+
+  V_NAMEF (vl4l4, sincosf) ((v_f32_t) { x[0], x[1], x[0], x[1] }, st, ct);
+  s[0] = st[0];
+  s[1] = st[1];
+  c[0] = ct[0];
+  c[1] = ct[1];
+}
+
+V_ABI void
+V_MANGLE (n, 2, vvv, sincosf) (v_f32x2_t x, v_ptr_t s, v_ptr_t c)
+{
+  float st[4], ct[4];
+
+  V_NAMEF (vl4l4, sincosf) ((v_f32_t) { x[0], x[1], x[0], x[1] }, st, ct);
+  *(float *) (uintptr_t) s[0] = st[0];
+  *(float *) (uintptr_t) s[1] = st[1];
+  *(float *) (uintptr_t) c[0] = ct[0];
+  *(float *) (uintptr_t) c[1] = ct[1];
+}
+
+#endif /* !__OBSOLETE_MATH */
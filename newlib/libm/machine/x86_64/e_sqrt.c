@@ -0,0 +1,18 @@
+/* e_sqrt.c -- define __ieee754_sqrt with sqrtsd.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "fdlibm.h"
+#include "x86_64math.h"
+
+double
+__ieee754_sqrt (double x)
+{
+  double result;
+  asm (X86_64_OP1M ("sqrtsd") : "=x" (result) : "x" (x));
+  return result;
+}
@@ -0,0 +1,18 @@
+/* ef_sqrt.c -- define __ieee754_sqrtf with sqrtss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "fdlibm.h"
+#include "x86_64math.h"
+
+float
+__ieee754_sqrtf (float x)
+{
+  float result;
+  asm (X86_64_OP1M ("sqrtss") : "=x" (result) : "x" (x));
+  return result;
+}
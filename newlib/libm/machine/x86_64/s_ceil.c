@@ -0,0 +1,27 @@
+/* s_ceil.c -- define ceil with roundsd.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define ceil __ceil_generic
+# include "../../math/s_ceil.c"
+# undef ceil
+#endif
+
+/* Toward +inf, without raising inexact.  */
+static double
+ceil_sse4_1 (double x)
+{
+  double result;
+  asm (X86_64_OP1I ("roundsd", 10) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, double, ceil, (double x), (x), ceil_sse4_1,
+	       __ceil_generic)
@@ -0,0 +1,27 @@
+/* s_fma.c -- define fma with vfmadd213sd.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_FMA
+# define fma __fma_generic
+# include "../../common/s_fma.c"
+# undef fma
+#endif
+
+static double
+fma_fma (double x, double y, double z)
+{
+  double result;
+  asm ("vfmadd213sd\t%3, %2, %0"
+       : "=x" (result) : "0" (x), "x" (y), "x" (z));
+  return result;
+}
+
+X86_64_SELECT (FMA, double, fma, (double x, double y, double z), (x, y, z),
+	       fma_fma, __fma_generic)
@@ -0,0 +1,22 @@
+/* s_fmax.c -- define fmax with maxsd.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+double
+fmax (double x, double y)
+{
+  double result;
+
+  /* maxsd gives its second operand, x here, when either is a NaN,
+     which is right unless only x is one.  */
+  if (__builtin_isnan (x))
+    return y;
+  asm (X86_64_OP2 ("maxsd") : "=x" (result) : "0" (y), "x" (x));
+  return result;
+}
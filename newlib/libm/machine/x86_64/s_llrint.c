@@ -0,0 +1,17 @@
+/* s_llrint.c -- define llrint with cvtsd2si.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+long long int
+llrint (double x)
+{
+  long long int result;
+  asm (X86_64_OP1 ("cvtsd2si") : "=r" (result) : "x" (x));
+  return result;
+}
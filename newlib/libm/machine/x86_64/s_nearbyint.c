@@ -0,0 +1,27 @@
+/* s_nearbyint.c -- define nearbyint with roundsd.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define nearbyint __nearbyint_generic
+# include "../../common/s_nearbyint.c"
+# undef nearbyint
+#endif
+
+/* In the current rounding mode, without raising inexact.  */
+static double
+nearbyint_sse4_1 (double x)
+{
+  double result;
+  asm (X86_64_OP1I ("roundsd", 12) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, double, nearbyint, (double x), (x), nearbyint_sse4_1,
+	       __nearbyint_generic)
@@ -0,0 +1,27 @@
+/* s_rint.c -- define rint with roundsd.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define rint __rint_generic
+# include "../../common/s_rint.c"
+# undef rint
+#endif
+
+/* In the current rounding mode.  */
+static double
+rint_sse4_1 (double x)
+{
+  double result;
+  asm (X86_64_OP1I ("roundsd", 4) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, double, rint, (double x), (x), rint_sse4_1,
+	       __rint_generic)
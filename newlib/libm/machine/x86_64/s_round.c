@@ -0,0 +1,32 @@
+/* s_round.c -- define round with roundsd.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define round __round_generic
+# include "../../common/s_round.c"
+# undef round
+#endif
+
+/* x truncated, then moved away from zero if what was cut off, which
+   x - t gives exactly, was at least a half.  Infinities and NaNs, and
+   everything from 2^52 up, which is an integer already, go back as they
+   are, as inf - inf would raise invalid.  */
+static double
+round_sse4_1 (double x)
+{
+  double t;
+  if (!__builtin_isless (__builtin_fabs (x), 0x1p52))
+    return x;
+  asm (X86_64_OP1I ("roundsd", 11) : "=x" (t) : "x" (x));
+  return t + x86_64_round_step (x - t, x);
+}
+
+X86_64_SELECT (SSE4_1, double, round, (double x), (x), round_sse4_1,
+	       __round_generic)
@@ -0,0 +1,27 @@
+/* s_trunc.c -- define trunc with roundsd.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define trunc __trunc_generic
+# include "../../common/s_trunc.c"
+# undef trunc
+#endif
+
+/* Toward zero, without raising inexact.  */
+static double
+trunc_sse4_1 (double x)
+{
+  double result;
+  asm (X86_64_OP1I ("roundsd", 11) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, double, trunc, (double x), (x), trunc_sse4_1,
+	       __trunc_generic)
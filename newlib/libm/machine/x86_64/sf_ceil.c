@@ -0,0 +1,27 @@
+/* sf_ceil.c -- define ceilf with roundss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define ceilf __ceilf_generic
+# include "../../math/sf_ceil.c"
+# undef ceilf
+#endif
+
+/* Toward +inf, without raising inexact.  */
+static float
+ceilf_sse4_1 (float x)
+{
+  float result;
+  asm (X86_64_OP1I ("roundss", 10) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, float, ceilf, (float x), (x), ceilf_sse4_1,
+	       __ceilf_generic)
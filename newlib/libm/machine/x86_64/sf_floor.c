@@ -0,0 +1,27 @@
+/* sf_floor.c -- define floorf with roundss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define floorf __floorf_generic
+# include "../../math/sf_floor.c"
+# undef floorf
+#endif
+
+/* Toward -inf, without raising inexact.  */
+static float
+floorf_sse4_1 (float x)
+{
+  float result;
+  asm (X86_64_OP1I ("roundss", 9) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, float, floorf, (float x), (x), floorf_sse4_1,
+	       __floorf_generic)
@@ -0,0 +1,27 @@
+/* sf_fma.c -- define fmaf with vfmadd213ss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_FMA
+# define fmaf __fmaf_generic
+# include "../../common/sf_fma.c"
+# undef fmaf
+#endif
+
+static float
+fmaf_fma (float x, float y, float z)
+{
+  float result;
+  asm ("vfmadd213ss\t%3, %2, %0"
+       : "=x" (result) : "0" (x), "x" (y), "x" (z));
+  return result;
+}
+
+X86_64_SELECT (FMA, float, fmaf, (float x, float y, float z), (x, y, z),
+	       fmaf_fma, __fmaf_generic)
@@ -0,0 +1,22 @@
+/* sf_fmax.c -- define fmaxf with maxss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+float
+fmaxf (float x, float y)
+{
+  float result;
+
+  /* maxss gives its second operand, x here, when either is a NaN,
+     which is right unless only x is one.  */
+  if (__builtin_isnan (x))
+    return y;
+  asm (X86_64_OP2 ("maxss") : "=x" (result) : "0" (y), "x" (x));
+  return result;
+}
@@ -0,0 +1,17 @@
+/* sf_lrint.c -- define lrintf with cvtss2si.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+long int
+lrintf (float x)
+{
+  long int result;
+  asm (X86_64_OP1 ("cvtss2si") : "=r" (result) : "x" (x));
+  return result;
+}
@@ -0,0 +1,27 @@
+/* sf_nearbyint.c -- define nearbyintf with roundss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define nearbyintf __nearbyintf_generic
+# include "../../common/sf_nearbyint.c"
+# undef nearbyintf
+#endif
+
+/* In the current rounding mode, without raising inexact.  */
+static float
+nearbyintf_sse4_1 (float x)
+{
+  float result;
+  asm (X86_64_OP1I ("roundss", 12) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, float, nearbyintf, (float x), (x), nearbyintf_sse4_1,
+	       __nearbyintf_generic)
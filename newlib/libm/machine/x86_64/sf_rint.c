@@ -0,0 +1,27 @@
+/* sf_rint.c -- define rintf with roundss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define rintf __rintf_generic
+# include "../../common/sf_rint.c"
+# undef rintf
+#endif
+
+/* In the current rounding mode.  */
+static float
+rintf_sse4_1 (float x)
+{
+  float result;
+  asm (X86_64_OP1I ("roundss", 4) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, float, rintf, (float x), (x), rintf_sse4_1,
+	       __rintf_generic)
@@ -0,0 +1,32 @@
+/* sf_round.c -- define roundf with roundss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define roundf __roundf_generic
+# include "../../common/sf_round.c"
+# undef roundf
+#endif
+
+/* x truncated, then moved away from zero if what was cut off, which
+   x - t gives exactly, was at least a half.  Infinities and NaNs, and
+   everything from 2^23 up, which is an integer already, go back as they
+   are, as inf - inf would raise invalid.  */
+static float
+roundf_sse4_1 (float x)
+{
+  float t;
+  if (!__builtin_isless (__builtin_fabsf (x), 0x1p23f))
+    return x;
+  asm (X86_64_OP1I ("roundss", 11) : "=x" (t) : "x" (x));
+  return t + x86_64_round_stepf (x - t, x);
+}
+
+X86_64_SELECT (SSE4_1, float, roundf, (float x), (x), roundf_sse4_1,
+	       __roundf_generic)
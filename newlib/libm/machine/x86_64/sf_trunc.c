@@ -0,0 +1,27 @@
+/* sf_trunc.c -- define truncf with roundss.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+#include "x86_64math.h"
+
+#if !X86_64_HAVE_SSE4_1
+# define truncf __truncf_generic
+# include "../../common/sf_trunc.c"
+# undef truncf
+#endif
+
+/* Toward zero, without raising inexact.  */
+static float
+truncf_sse4_1 (float x)
+{
+  float result;
+  asm (X86_64_OP1I ("roundss", 11) : "=x" (result) : "x" (x));
+  return result;
+}
+
+X86_64_SELECT (SSE4_1, float, truncf, (float x), (x), truncf_sse4_1,
+	       __truncf_generic)
@@ -0,0 +1,26 @@
+/* v_avx.c -- the AVX versions of the vector math functions, _ZGVc*.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* See v_math.h.  AVX has no 256 bit integer vectors, so that the pointers to
+   sincos come in 128 bit pieces.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#pragma GCC target ("avx")
+
+#define V_ISA c
+#define V_N 4
+#define V_NF 8
+#define V_PTRREG 16
+
+#include "v_exp.h"
+#include "v_log.h"
+#include "v_pow.h"
+#include "v_sincos.h"
+
+#endif /* !__OBSOLETE_MATH */
@@ -0,0 +1,25 @@
+/* v_avx512.c -- the AVX-512 versions of the vector math functions, _ZGVe*.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* See v_math.h.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+#pragma GCC target ("avx512f")
+
+#define V_ISA e
+#define V_N 8
+#define V_NF 16
+#define V_PTRREG 64
+
+#include "v_exp.h"
+#include "v_log.h"
+#include "v_pow.h"
+#include "v_sincos.h"
+
+#endif /* !__OBSOLETE_MATH */
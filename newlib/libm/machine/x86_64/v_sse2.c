@@ -0,0 +1,25 @@
+/* v_sse2.c -- the SSE2 versions of the vector math functions, _ZGVb*.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* See v_math.h.  The ABI calls these the SSE4 versions but only
+   asks for SSE2, which every x86_64 has.  */
+
+#include "fdlibm.h"
+#if !__OBSOLETE_MATH
+
+#define V_ISA b
+#define V_N 2
+#define V_NF 4
+#define V_PTRREG 16
+
+#include "v_exp.h"
+#include "v_log.h"
+#include "v_pow.h"
+#include "v_sincos.h"
+
+#endif /* !__OBSOLETE_MATH */
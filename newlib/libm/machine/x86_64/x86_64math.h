@@ -0,0 +1,124 @@
+/* x86_64math.h -- run-time selection of the libm machine functions.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* The functions here that need more than SSE2 (roundsd and roundss
+   from SSE4.1, vfmadd from FMA) are called through a pointer that
+   starts out at a resolver, as the string functions in
+   libc/machine/x86_64 are: the first call looks at
+   __x86_64_cpu_features and points it at either the version using the
+   instructions or the generic C one, which the file builds under
+   another name.  When the compiler is already allowed the instructions
+   (-msse4.1, -mfma, or a -march that has them) the functions use them
+   directly and the generic versions are left out.  */
+
+#ifndef _X86_64MATH_H_
+#define _X86_64MATH_H_
+
+#include <math.h>
+#include "x86_64cpu.h"
+
+#ifdef __SSE4_1__
+# define X86_64_HAVE_SSE4_1 1
+#else
+# define X86_64_HAVE_SSE4_1 0
+#endif
+
+#ifdef __FMA__
+# define X86_64_HAVE_FMA 1
+#else
+# define X86_64_HAVE_FMA 0
+#endif
+
+/* The scalar SSE instructions as asm templates, in their VEX form when
+   the compiler is using AVX so as not to mix the two encodings: %0 is
+   the result, %1 the operand (tied to %0 for X86_64_OP2, which takes a
+   second operand %2) and imm an immediate.  */
+#ifdef __AVX__
+# define X86_64_OP1(insn) "v" insn "\t%1, %0"
+# define X86_64_OP1M(insn) "v" insn "\t%1, %1, %0"
+# define X86_64_OP1I(insn, imm) "v" insn "\t$" #imm ", %1, %1, %0"
+# define X86_64_OP2(insn) "v" insn "\t%2, %1, %0"
+#else
+# define X86_64_OP1(insn) insn "\t%1, %0"
+# define X86_64_OP1M(insn) insn "\t%1, %0"
+# define X86_64_OP1I(insn, imm) insn "\t$" #imm ", %1, %0"
+# define X86_64_OP2(insn) insn "\t%2, %0"
+#endif
+
+/* 1 if |d| >= 0.5 and 0 if not, with the sign of x, for round and
+   roundf.  The comparison is done on the bits, which the compiler turns
+   into a flag rather than a branch that random fractions would take
+   either way, and which unlike cmpsd's ordered predicates raises
+   nothing.  */
+
+static inline double
+x86_64_round_step (double d, double x)
+{
+  union { double f; unsigned long long i; } u = { d };
+
+  return __builtin_copysign ((double) ((u.i & 0x7fffffffffffffffULL)
+				       >= 0x3fe0000000000000ULL), x);
+}
+
+static inline float
+x86_64_round_stepf (float d, float x)
+{
+  union { float f; unsigned int i; } u = { d };
+
+  return __builtin_copysignf ((float) ((u.i & 0x7fffffff) >= 0x3f000000),
+			      x);
+}
+
+static inline int
+x86_64_have (unsigned int feature)
+{
+  if (!(__x86_64_cpu_features & X86_64_FEATURE_INIT))
+    __x86_64_init_cpu_features ();
+  return (__x86_64_cpu_features & feature) != 0;
+}
+
+/* Define the function name, returning type and taking params, which
+   passes args on to fast if the CPU has feature and to generic if not.
+   params and args are parenthesised lists, "(double x)" and "(x)".  */
+#define X86_64_SELECT(feature, type, name, params, args, fast, generic) \
+  X86_64_SELECT_ (X86_64_HAVE_##feature, feature, type, name, params,	\
+		  args, fast, generic)
+#define X86_64_SELECT_(have, feature, type, name, params, args, fast,	\
+		       generic)						\
+  X86_64_SELECT__ (have, feature, type, name, params, args, fast, generic)
+#define X86_64_SELECT__(have, feature, type, name, params, args, fast,	\
+			generic)					\
+  X86_64_SELECT_##have (feature, type, name, params, args, fast, generic)
+
+#define X86_64_SELECT_1(feature, type, name, params, args, fast,	\
+			generic)					\
+type									\
+name params								\
+{									\
+  return fast args;							\
+}
+
+#define X86_64_SELECT_0(feature, type, name, params, args, fast,	\
+			generic)					\
+static type name##_resolve params;					\
+static type (*name##_impl) params = name##_resolve;			\
+									\
+static type								\
+name##_resolve params							\
+{									\
+  name##_impl = x86_64_have (X86_64_FEATURE_##feature) ? fast : generic;	\
+  return name##_impl args;						\
+}									\
+									\
+type									\
+name params								\
+{									\
+  return name##_impl args;						\
+}
+
+#endif /* _X86_64MATH_H_ */
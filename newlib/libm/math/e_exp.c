@@ -76,6 +76,8 @@
 
 #include "fdlibm.h"
 
+#if __OBSOLETE_MATH
+
 #ifndef _DOUBLE_IS_32BITS
 
 #ifdef __STDC__
@@ -164,3 +166,5 @@ P5   =  4.13813679705723846039e-08; /* 0x3E663769, 0x72BEA4D0 */
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+
+#endif /* __OBSOLETE_MATH */
@@ -64,6 +64,8 @@
 
 #include "fdlibm.h"
 
+#if __OBSOLETE_MATH
+
 #ifndef _DOUBLE_IS_32BITS
 
 #ifdef __STDC__
@@ -144,3 +146,5 @@ static double zero   =  0.0;
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
+
+#endif /* __OBSOLETE_MATH */
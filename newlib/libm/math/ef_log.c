@@ -15,6 +15,8 @@
 
 #include "fdlibm.h"
 
+#if __OBSOLETE_MATH
+
 #ifdef __STDC__
 static const float
 #else
@@ -90,3 +92,5 @@ static float zero   =  0.0;
 		     return dk*ln2_hi-((s*(f-R)-dk*ln2_lo)-f);
 	}
 }
+
+#endif /* __OBSOLETE_MATH */
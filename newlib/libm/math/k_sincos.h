@@ -0,0 +1,199 @@
+/* k_sincos.h -- argument reduction and polynomials shared by sin, cos
+ * and sincos, and by their float versions.
+ *
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Each function reduces x once, to r = x - n*pi/2 with |r| <= pi/4,
+ * evaluates sin(r) or cos(r) or, for sincos, both in the same pass,
+ * and picks and negates them by n mod 4 as s_sin.c explains.
+ *
+ * Double:
+ *	The polynomials are those of k_sin.c and k_cos.c.  cos_poly()
+ *	adds 1 - z/2 in two pieces instead of with k_cos.c's qx, which is
+ *	as accurate and needs no branch.  For |x| < 2^20*pi/2, rem_pio2()
+ *	is the Cody-Waite reduction of e_rem_pio2.c, inline, finding n by
+ *	rounding x*2/pi with a shift instead of through the npio2_hw
+ *	table; larger x go to __ieee754_rem_pio2, which uses Payne-Hanek
+ *	with the two_over_pi table.  The error is below 0.8 ulp.
+ *
+ * Float:
+ *	Evaluated in double, with a polynomial of degree 7 for sin and of
+ *	degree 8 for cos, which leaves room for the result to be rounded
+ *	once at the end.  For |x| < 2^20, rem_pio2f() subtracts n*pi/2
+ *	in two pieces of which the first has 33 bits, so that n*Pio2_1 is
+ *	exact and so is x - n*Pio2_1; larger x go to __ieee754_rem_pio2.
+ *	The error is at most 0.564 ulp.
+ */
+
+#ifndef _K_SINCOS_H
+#define _K_SINCOS_H
+
+/* fdlibm.h, which has no include guard, must come first.  */
+#include "math_config.h"
+
+static const double
+InvPio2 = 0x1.45f306dc9c883p-1,		/* 2/pi */
+Shift = 0x1.8p52,			/* rounds to an integer */
+Pio2_1 = 0x1.921fb544p0,		/* first 33 bits of pi/2 */
+Pio2_1t = 0x1.0b4611a626331p-34,	/* pi/2 - Pio2_1 */
+Pio2_2 = 0x1.0b4611a6p-34,		/* second 33 bits of pi/2 */
+Pio2_2t = 0x1.3198a2e037073p-69,	/* pi/2 - (Pio2_1 + Pio2_2) */
+Pio2_3 = 0x1.3198a2ep-69,		/* third 33 bits of pi/2 */
+Pio2_3t = 0x1.b839a252049c1p-104;	/* pi/2 - (Pio2_1 + ... + Pio2_3) */
+
+#ifndef _DOUBLE_IS_32BITS
+
+static const double
+S1 = -0x1.5555555555549p-3,
+S2 = 0x1.111111110f8a6p-7,
+S3 = -0x1.a01a019c161d5p-13,
+S4 = 0x1.71de357b1fe7dp-19,
+S5 = -0x1.ae5e68a2b9cebp-26,
+S6 = 0x1.5d93a5acfd57cp-33,
+C1 = 0x1.555555555554cp-5,
+C2 = -0x1.6c16c16c15177p-10,
+C3 = 0x1.a01a019cb159p-16,
+C4 = -0x1.27e4f809c52adp-22,
+C5 = 0x1.1ee9ebdb4b1c4p-29,
+C6 = -0x1.8fae9be8838d4p-37;
+
+/* Set y[0] + y[1] = x - n*pi/2, |y[0] + y[1]| <= pi/4, and return n.
+   x must be finite.  */
+static ALWAYS_INLINE __int32_t
+rem_pio2 (double x, double *y)
+{
+	double fn, r, t, w;
+	__uint32_t ix, j, i;
+	__int32_t n;
+
+	GET_HIGH_WORD(ix,x);
+	ix &= 0x7fffffff;
+	if (unlikely (ix >= 0x413921fb))	/* |x| ~>= 2^20*(pi/2) */
+	    return __ieee754_rem_pio2(x,y);
+
+	fn = eval_as_double(x*InvPio2 + Shift);
+	n  = (__int32_t) asuint64(fn);
+	fn -= Shift;
+	r  = x - fn*Pio2_1;			/* exact */
+	w  = fn*Pio2_1t;			/* 1st round good to 85 bits */
+	y[0] = r - w;
+	j  = ix >> 20;
+	i  = j - ((asuint64(y[0]) >> 52) & 0x7ff);
+	if (unlikely (i > 16)) {		/* 2nd round, good to 118 bits */
+	    t  = r;
+	    w  = fn*Pio2_2;
+	    r  = t - w;
+	    w  = fn*Pio2_2t - ((t - r) - w);
+	    y[0] = r - w;
+	    i  = j - ((asuint64(y[0]) >> 52) & 0x7ff);
+	    if (i > 49) {			/* 3rd round, 151 bits */
+		t  = r;
+		w  = fn*Pio2_3;
+		r  = t - w;
+		w  = fn*Pio2_3t - ((t - r) - w);
+		y[0] = r - w;
+	    }
+	}
+	y[1] = (r - y[0]) - w;
+	return n;
+}
+
+/* sin(x + y) for |x + y| <= pi/4, y the tail of x if iy is nonzero,
+   as __kernel_sin().  */
+static ALWAYS_INLINE double
+sin_poly (double x, double y, int iy)
+{
+	double z, w, r, v;
+
+	z = x*x;
+	w = z*z;
+	r = S2 + z*(S3 + z*S4) + z*w*(S5 + z*S6);
+	v = z*x;
+	if (iy == 0)
+	    return x + v*(S1 + z*r);
+	return x - ((z*(0.5*y - v*r) - y) - v*S1);
+}
+
+/* cos(x + y) for |x + y| <= pi/4, as __kernel_cos().  */
+static ALWAYS_INLINE double
+cos_poly (double x, double y)
+{
+	double z, w, r, hz;
+
+	z  = x*x;
+	w  = z*z;
+	r  = z*(C1 + z*(C2 + z*C3)) + w*w*(C4 + z*(C5 + z*C6));
+	hz = 0.5*z;
+	w  = 1.0 - hz;
+	return w + (((1.0 - w) - hz) + (z*r - x*y));
+}
+
+/* Both of the above, sharing x*x and its powers.  */
+static ALWAYS_INLINE void
+sincos_poly (double x, double y, int iy, double *s, double *c)
+{
+	double z, w, r, v, hz;
+
+	z = x*x;
+	w = z*z;
+	r = S2 + z*(S3 + z*S4) + z*w*(S5 + z*S6);
+	v = z*x;
+	if (iy == 0)
+	    *s = x + v*(S1 + z*r);
+	else
+	    *s = x - ((z*(0.5*y - v*r) - y) - v*S1);
+	r  = z*(C1 + z*(C2 + z*C3)) + w*w*(C4 + z*(C5 + z*C6));
+	hz = 0.5*z;
+	w  = 1.0 - hz;
+	*c = w + (((1.0 - w) - hz) + (z*r - x*y));
+}
+
+#endif /* _DOUBLE_IS_32BITS */
+
+static const double
+SF1 = -0x1.555545264bab9p-3,
+SF2 = 0x1.11073ae3ce041p-7,
+SF3 = -0x1.9943d83288df7p-13,
+CF1 = -0x1.ffffffcb81ef9p-2,
+CF2 = 0x1.55553c7840d06p-5,
+CF3 = -0x1.6c07f14605e46p-10,
+CF4 = 0x1.99169768aeb0dp-16;
+
+/* Return r = x - n*pi/2 with |r| <= pi/4 and set *np to n.  ix is the
+   float word of |x|, which must be finite.  */
+static ALWAYS_INLINE double
+rem_pio2f (float x, __uint32_t ix, __int32_t *np)
+{
+	double y[2];
+	double_t kd;
+
+	if (likely (ix < 0x49800000)) {		/* |x| < 2^20 */
+	    kd = eval_as_double((double_t) x*InvPio2 + Shift);
+	    *np = (__int32_t) asuint64(kd);
+	    kd -= Shift;
+	    return ((double_t) x - kd*Pio2_1) - kd*Pio2_1t;
+	}
+	*np = __ieee754_rem_pio2((double) x, y);
+	return y[0];
+}
+
+/* sin(r) and cos(r) for |r| <= pi/4, z = r*r.  Multiplying r by the
+   rest of the polynomial keeps the sign of r = -0.  */
+static ALWAYS_INLINE double
+sinf_poly (double_t r, double_t z)
+{
+	return r*(1.0 + z*(SF1 + z*SF2 + z*z*SF3));
+}
+
+static ALWAYS_INLINE double
+cosf_poly (double_t z)
+{
+	double_t w = z*z;
+	return (1.0 + z*CF1) + w*(CF2 + z*CF3) + w*w*CF4;
+}
+
+#endif /* _K_SINCOS_H */
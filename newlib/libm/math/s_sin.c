@@ -68,6 +68,7 @@ QUICKREF
  *	__kernel_sin		... sine function on [-pi/4,pi/4]
  *	__kernel_cos		... cose function on [-pi/4,pi/4]
  *	__ieee754_rem_pio2	... argument reduction routine
+ *	Unless __OBSOLETE_MATH, the inline versions in k_sincos.h.
  *
  * Method.
  *      Let S,C and T denote the sin, cos and tan respectively on 
@@ -96,6 +97,8 @@ QUICKREF
 
 #ifndef _DOUBLE_IS_32BITS
 
+#if __OBSOLETE_MATH
+
 #ifdef __STDC__
 	double sin(double x)
 #else
@@ -129,4 +132,39 @@ QUICKREF
 	}
 }
 
+#else /* !__OBSOLETE_MATH */
+
+#include "k_sincos.h"
+
+double
+sin (double x)
+{
+	double y[2];
+	__int32_t n,ix;
+
+	GET_HIGH_WORD(ix,x);
+
+    /* |x| ~< pi/4 */
+	ix &= 0x7fffffff;
+	if(ix <= 0x3fe921fb) {
+	    if(ix < 0x3e400000)			/* |x| < 2**-27 */
+		if((int)x == 0) return x;	/* generate inexact */
+	    return sin_poly(x,0.0,0);
+	}
+
+    /* sin(Inf or NaN) is NaN */
+	if (ix>=0x7ff00000) return x-x;
+
+	n = rem_pio2(x,y);
+	switch(n&3) {
+	    case 0: return  sin_poly(y[0],y[1],1);
+	    case 1: return  cos_poly(y[0],y[1]);
+	    case 2: return -sin_poly(y[0],y[1],1);
+	    default:
+		    return -cos_poly(y[0],y[1]);
+	}
+}
+
+#endif /* __OBSOLETE_MATH */
+
 #endif /* _DOUBLE_IS_32BITS */
@@ -15,6 +15,8 @@
 
 #include "fdlibm.h"
 
+#if __OBSOLETE_MATH
+
 #ifdef __STDC__
 	float sinf(float x)
 #else
@@ -47,6 +49,42 @@
 	}
 }
 
+#else /* !__OBSOLETE_MATH */
+
+#include "k_sincos.h"
+
+float
+sinf (float x)
+{
+	double_t r,z;
+	__int32_t n;
+	__uint32_t ix;
+
+	GET_FLOAT_WORD(ix,x);
+
+    /* |x| ~< pi/4 */
+	ix &= 0x7fffffff;
+	if(ix <= 0x3f490fd8) {
+	    z = (double_t) x*x;
+	    return sinf_poly(x,z);
+	}
+
+    /* sin(Inf or NaN) is NaN */
+	if (!FLT_UWORD_IS_FINITE(ix)) return x-x;
+
+	r = rem_pio2f(x,ix,&n);
+	z = r*r;
+	switch(n&3) {
+	    case 0: return  sinf_poly(r,z);
+	    case 1: return  cosf_poly(z);
+	    case 2: return -sinf_poly(r,z);
+	    default:
+		    return -cosf_poly(z);
+	}
+}
+
+#endif /* __OBSOLETE_MATH */
+
 #ifdef _DOUBLE_IS_32BITS
 
 #ifdef __STDC__
@@ -82,19 +82,11 @@ MATHREF
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double acos(double x)		/* wrapper acos */
-#else
-	double acos(x)			/* wrapper acos */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+acos_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_acos(x);
-#else
-	double z;
        	struct exception exc;
-       	z = __ieee754_acos(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(fabs(x)>1.0) { 
 	    /* acos(|x|>1) */
@@ -113,6 +105,26 @@ MATHREF
 	    return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double acos(double x)		/* wrapper acos */
+#else
+	double acos(x)			/* wrapper acos */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_acos(x);
+#else
+	double z;
+	__int32_t hx;
+	z = __ieee754_acos(x);
+	GET_HIGH_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x3ff00000))
+	    return acos_error(x,z);
+	return z;
 #endif
 }
 
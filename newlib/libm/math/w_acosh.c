@@ -86,19 +86,11 @@ MATHREF
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double acosh(double x)		/* wrapper acosh */
-#else
-	double acosh(x)			/* wrapper acosh */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+acosh_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_acosh(x);
-#else
-	double z;
 	struct exception exc;
-	z = __ieee754_acosh(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(x<1.0) {
             /* acosh(x<1) */
@@ -117,6 +109,24 @@ MATHREF
 	    return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double acosh(double x)		/* wrapper acosh */
+#else
+	double acosh(x)			/* wrapper acosh */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_acosh(x);
+#else
+	double z;
+	z = __ieee754_acosh(x);
+	if(__predict_false(x<1.0))
+	    return acosh_error(x,z);
+	return z;
 #endif
 }
 
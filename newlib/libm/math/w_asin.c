@@ -85,19 +85,11 @@ MATHREF
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double asin(double x)		/* wrapper asin */
-#else
-	double asin(x)			/* wrapper asin */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+asin_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_asin(x);
-#else
-	double z;
 	struct exception exc;
-	z = __ieee754_asin(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(fabs(x)>1.0) {
 	    /* asin(|x|>1) */
@@ -116,6 +108,26 @@ MATHREF
 	    return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double asin(double x)		/* wrapper asin */
+#else
+	double asin(x)			/* wrapper asin */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_asin(x);
+#else
+	double z;
+	__int32_t hx;
+	z = __ieee754_asin(x);
+	GET_HIGH_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x3ff00000))
+	    return asin_error(x,z);
+	return z;
 #endif
 }
 
@@ -84,19 +84,12 @@ QUICKREF
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double atanh(double x)		/* wrapper atanh */
-#else
-	double atanh(x)			/* wrapper atanh */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+atanh_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_atanh(x);
-#else
-	double z,y;
+	double y;
 	struct exception exc;
-	z = __ieee754_atanh(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	y = fabs(x);
 	if(y>=1.0) {
@@ -130,6 +123,26 @@ QUICKREF
             return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double atanh(double x)		/* wrapper atanh */
+#else
+	double atanh(x)			/* wrapper atanh */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_atanh(x);
+#else
+	double z;
+	__int32_t hx;
+	z = __ieee754_atanh(x);
+	GET_HIGH_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x3ff00000))
+	    return atanh_error(x,z);
+	return z;
 #endif
 }
 
@@ -70,19 +70,11 @@ QUICKREF
 
 #ifndef _DOUBLE_IS_32BITS
  
-#ifdef __STDC__
-	double cosh(double x)		/* wrapper cosh */
-#else
-	double cosh(x)			/* wrapper cosh */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+cosh_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_cosh(x);
-#else
-	double z;
 	struct exception exc;
-	z = __ieee754_cosh(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(fabs(x)>7.10475860073943863426e+02) {	
 	    /* cosh(finite) overflow */
@@ -110,6 +102,26 @@ QUICKREF
 	    return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double cosh(double x)		/* wrapper cosh */
+#else
+	double cosh(x)			/* wrapper cosh */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_cosh(x);
+#else
+	double z;
+	__int32_t hx;
+	z = __ieee754_cosh(x);
+	GET_HIGH_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x408633ce))
+	    return cosh_error(x,z);
+	return z;
 #endif
 }
 
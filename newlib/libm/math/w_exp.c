@@ -65,6 +65,7 @@ PORTABILITY
 
 #ifndef _DOUBLE_IS_32BITS
 
+#if !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
 #ifdef __STDC__
 static const double
 #else
@@ -73,19 +74,10 @@ static double
 o_threshold=  7.09782712893383973096e+02,  /* 0x40862E42, 0xFEFA39EF */
 u_threshold= -7.45133219101941108420e+02;  /* 0xc0874910, 0xD52D3051 */
 
-#ifdef __STDC__
-	double exp(double x)		/* wrapper exp */
-#else
-	double exp(x)			/* wrapper exp */
-	double x;
-#endif
+static _NOINLINE double
+exp_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_exp(x);
-#else
-	double z;
 	struct exception exc;
-	z = __ieee754_exp(x);
 	if(_LIB_VERSION == _IEEE_) return z;
 	if(finite(x)) {
 	    if(x>o_threshold) {
@@ -130,6 +122,26 @@ u_threshold= -7.45133219101941108420e+02;  /* 0xc0874910, 0xD52D3051 */
 	    } 
 	} 
 	return z;
+}
+#endif
+
+#ifdef __STDC__
+	double exp(double x)		/* wrapper exp */
+#else
+	double exp(x)			/* wrapper exp */
+	double x;
+#endif
+{
+#if defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return __ieee754_exp(x);
+#else
+	double z;
+	__int32_t hx;
+	z = __ieee754_exp(x);
+	GET_HIGH_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x40862e42))
+	    return exp_error(x,z);
+	return z;
 #endif
 }
 
@@ -57,6 +57,56 @@ PORTABILITY
 
 #ifndef _DOUBLE_IS_32BITS
 
+#if !__OBSOLETE_MATH && !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
+static _NOINLINE double
+exp2_error(double x, double z)
+{
+	struct exception exc;
+	if(_LIB_VERSION == _IEEE_ || !finite(x)) return z;
+	if(!finite(z)) {
+	    /* exp2(finite) overflow */
+#ifndef HUGE_VAL
+#define HUGE_VAL inf
+	    double inf = 0.0;
+
+	    SET_HIGH_WORD(inf,0x7ff00000);	/* set inf to infinite */
+#endif
+	    exc.type = OVERFLOW;
+	    exc.name = "exp2";
+	    exc.err = 0;
+	    exc.arg1 = exc.arg2 = x;
+	    if (_LIB_VERSION == _SVID_)
+	      exc.retval = HUGE;
+	    else
+	      exc.retval = HUGE_VAL;
+	    if (_LIB_VERSION == _POSIX_)
+	      errno = ERANGE;
+	    else if (!matherr(&exc)) {
+		    errno = ERANGE;
+	    }
+	    if (exc.err != 0)
+	       errno = exc.err;
+	    return exc.retval;
+	} else if(z == 0.0) {
+	    /* exp2(finite) underflow */
+	    exc.type = UNDERFLOW;
+	    exc.name = "exp2";
+	    exc.err = 0;
+	    exc.arg1 = exc.arg2 = x;
+	    exc.retval = 0.0;
+	    if (_LIB_VERSION == _POSIX_)
+	      errno = ERANGE;
+	    else if (!matherr(&exc)) {
+		    errno = ERANGE;
+	    }
+	    if (exc.err != 0)
+	       errno = exc.err;
+	    return exc.retval;
+	}
+	return z;
+}
+#endif
+
 #ifdef __STDC__
 	double exp2(double x)		/* wrapper exp2 */
 #else
@@ -64,7 +114,17 @@ PORTABILITY
 	double x;
 #endif
 {
-  return pow(2.0, x);
+#if __OBSOLETE_MATH
+	return pow(2.0, x);
+#elif defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return __ieee754_exp2(x);
+#else
+	double z;
+	z = __ieee754_exp2(x);
+	if(__predict_false(!isfinite(z)||z==0.0))
+	    return exp2_error(x,z);
+	return z;
+#endif
 }
 
 #endif /* defined(_DOUBLE_IS_32BITS) */
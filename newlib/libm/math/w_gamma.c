@@ -170,19 +170,11 @@ is not standard, nor is the <[signgam]> global for <<lgamma>>.
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double gamma(double x)
-#else
-	double gamma(x)
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+gamma_error(double x, double y)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_gamma_r(x,&(_REENT_SIGNGAM(_REENT)));
-#else
-        double y;
 	struct exception exc;
-        y = __ieee754_gamma_r(x,&(_REENT_SIGNGAM(_REENT)));
         if(_LIB_VERSION == _IEEE_) return y;
         if(!finite(y)&&finite(x)) {
 #ifndef HUGE_VAL 
@@ -220,6 +212,24 @@ is not standard, nor is the <[signgam]> global for <<lgamma>>.
 	    return exc.retval; 
         } else
             return y;
+}
+#endif
+
+#ifdef __STDC__
+	double gamma(double x)
+#else
+	double gamma(x)
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_gamma_r(x,&(_REENT_SIGNGAM(_REENT)));
+#else
+	double y;
+	y = __ieee754_gamma_r(x,&(_REENT_SIGNGAM(_REENT)));
+	if(__predict_false(!isfinite(y)))
+	    return gamma_error(x,y);
+	return y;
 #endif
 }             
 
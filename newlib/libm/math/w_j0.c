@@ -127,18 +127,11 @@ None of the Bessel functions are in ANSI C.
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double j0(double x)		/* wrapper j0 */
-#else
-	double j0(x)			/* wrapper j0 */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+j0_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_j0(x);
-#else
 	struct exception exc;
-	double z = __ieee754_j0(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(fabs(x)>X_TLOSS) {
 	    /* j0(|x|>X_TLOSS) */
@@ -157,22 +150,34 @@ None of the Bessel functions are in ANSI C.
             return exc.retval; 
 	} else
 	    return z;
-#endif
 }
+#endif
 
 #ifdef __STDC__
-	double y0(double x)		/* wrapper y0 */
+	double j0(double x)		/* wrapper j0 */
 #else
-	double y0(x)			/* wrapper y0 */
+	double j0(x)			/* wrapper j0 */
 	double x;
 #endif
 {
 #ifdef _IEEE_LIBM
-	return __ieee754_y0(x);
+	return __ieee754_j0(x);
 #else
 	double z;
+	__int32_t hx;
+	z = __ieee754_j0(x);
+	GET_HIGH_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x434921fb))
+	    return j0_error(x,z);
+	return z;
+#endif
+}
+
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+y0_error(double x, double z)
+{
 	struct exception exc;
-	z = __ieee754_y0(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
         if(x <= 0.0){
 #ifndef HUGE_VAL 
@@ -216,6 +221,24 @@ None of the Bessel functions are in ANSI C.
 	    return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double y0(double x)		/* wrapper y0 */
+#else
+	double y0(x)			/* wrapper y0 */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_y0(x);
+#else
+	double z;
+	z = __ieee754_y0(x);
+	if(__predict_false(x<=0.0||x>X_TLOSS))
+	    return y0_error(x,z);
+	return z;
 #endif
 }
 
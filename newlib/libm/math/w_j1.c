@@ -20,19 +20,11 @@
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double j1(double x)		/* wrapper j1 */
-#else
-	double j1(x)			/* wrapper j1 */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+j1_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_j1(x);
-#else
-	double z;
 	struct exception exc;
-	z = __ieee754_j1(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
 	if(fabs(x)>X_TLOSS) {
 	    /* j1(|x|>X_TLOSS) */
@@ -51,22 +43,34 @@
             return exc.retval; 
 	} else
 	    return z;
-#endif
 }
+#endif
 
 #ifdef __STDC__
-	double y1(double x)		/* wrapper y1 */
+	double j1(double x)		/* wrapper j1 */
 #else
-	double y1(x)			/* wrapper y1 */
+	double j1(x)			/* wrapper j1 */
 	double x;
 #endif
 {
 #ifdef _IEEE_LIBM
-	return __ieee754_y1(x);
+	return __ieee754_j1(x);
 #else
 	double z;
+	__int32_t hx;
+	z = __ieee754_j1(x);
+	GET_HIGH_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x434921fb))
+	    return j1_error(x,z);
+	return z;
+#endif
+}
+
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+y1_error(double x, double z)
+{
 	struct exception exc;
-	z = __ieee754_y1(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
         if(x <= 0.0){
 #ifndef HUGE_VAL 
@@ -110,6 +114,24 @@
             return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double y1(double x)		/* wrapper y1 */
+#else
+	double y1(x)			/* wrapper y1 */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_y1(x);
+#else
+	double z;
+	z = __ieee754_y1(x);
+	if(__predict_false(x<=0.0||x>X_TLOSS))
+	    return y1_error(x,z);
+	return z;
 #endif
 }
 
@@ -42,19 +42,11 @@
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double jn(int n, double x)	/* wrapper jn */
-#else
-	double jn(n,x)			/* wrapper jn */
-	double x; int n;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+jn_error(int n, double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_jn(n,x);
-#else
-	double z;
 	struct exception exc;
-	z = __ieee754_jn(n,x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
 	if(fabs(x)>X_TLOSS) {
 	    /* jn(|x|>X_TLOSS) */
@@ -74,22 +66,34 @@
             return exc.retval; 
 	} else
 	    return z;
-#endif
 }
+#endif
 
 #ifdef __STDC__
-	double yn(int n, double x)	/* wrapper yn */
+	double jn(int n, double x)	/* wrapper jn */
 #else
-	double yn(n,x)			/* wrapper yn */
+	double jn(n,x)			/* wrapper jn */
 	double x; int n;
 #endif
 {
 #ifdef _IEEE_LIBM
-	return __ieee754_yn(n,x);
+	return __ieee754_jn(n,x);
 #else
 	double z;
+	__int32_t hx;
+	z = __ieee754_jn(n,x);
+	GET_HIGH_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x434921fb))
+	    return jn_error(n,x,z);
+	return z;
+#endif
+}
+
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+yn_error(int n, double x, double z)
+{
 	struct exception exc;
-	z = __ieee754_yn(n,x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
         if(x <= 0.0){
 	    /* yn(n,0) = -inf or yn(x<0) = NaN */
@@ -135,6 +139,24 @@
             return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double yn(int n, double x)	/* wrapper yn */
+#else
+	double yn(n,x)			/* wrapper yn */
+	double x; int n;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_yn(n,x);
+#else
+	double z;
+	z = __ieee754_yn(n,x);
+	if(__predict_false(x<=0.0||x>X_TLOSS))
+	    return yn_error(n,x,z);
+	return z;
 #endif
 }
 
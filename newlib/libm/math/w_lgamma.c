@@ -24,19 +24,11 @@
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double lgamma(double x)
-#else
-	double lgamma(x)
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+lgamma_error(double x, double y)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_lgamma_r(x,&(_REENT_SIGNGAM(_REENT)));
-#else
-        double y;
 	struct exception exc;
-        y = __ieee754_lgamma_r(x,&(_REENT_SIGNGAM(_REENT)));
         if(_LIB_VERSION == _IEEE_) return y;
         if(!finite(y)&&finite(x)) {
 #ifndef HUGE_VAL 
@@ -76,6 +68,24 @@
             return exc.retval; 
         } else
             return y;
+}
+#endif
+
+#ifdef __STDC__
+	double lgamma(double x)
+#else
+	double lgamma(x)
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_lgamma_r(x,&(_REENT_SIGNGAM(_REENT)));
+#else
+	double y;
+	y = __ieee754_lgamma_r(x,&(_REENT_SIGNGAM(_REENT)));
+	if(__predict_false(!isfinite(y)))
+	    return lgamma_error(x,y);
+	return y;
 #endif
 }             
 
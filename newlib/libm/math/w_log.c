@@ -61,19 +61,11 @@ PORTABILITY
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double log(double x)		/* wrapper log */
-#else
-	double log(x)			/* wrapper log */
-	double x;
-#endif
+#if !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
+static _NOINLINE double
+log_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_log(x);
-#else
-	double z;
 	struct exception exc;
-	z = __ieee754_log(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) || x > 0.0) return z;
 #ifndef HUGE_VAL 
 #define HUGE_VAL inf
@@ -110,6 +102,24 @@ PORTABILITY
 	if (exc.err != 0)
            errno = exc.err;
         return exc.retval; 
+}
+#endif
+
+#ifdef __STDC__
+	double log(double x)		/* wrapper log */
+#else
+	double log(x)			/* wrapper log */
+	double x;
+#endif
+{
+#if defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return __ieee754_log(x);
+#else
+	double z;
+	z = __ieee754_log(x);
+	if(__predict_false(x<=0.0))
+	    return log_error(x,z);
+	return z;
 #endif
 }
 
@@ -58,19 +58,11 @@ PORTABILITY
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double log10(double x)		/* wrapper log10 */
-#else
-	double log10(x)			/* wrapper log10 */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+log10_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_log10(x);
-#else
-	double z;
 	struct exception exc;
-	z = __ieee754_log10(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(x<=0.0) {
 #ifndef HUGE_VAL 
@@ -110,6 +102,24 @@ PORTABILITY
             return exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double log10(double x)		/* wrapper log10 */
+#else
+	double log10(x)			/* wrapper log10 */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_log10(x);
+#else
+	double z;
+	z = __ieee754_log10(x);
+	if(__predict_false(x<=0.0))
+	    return log10_error(x,z);
+	return z;
 #endif
 }
 
@@ -64,17 +64,10 @@ PORTABILITY
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double pow(double x, double y)	/* wrapper pow */
-#else
-	double pow(x,y)			/* wrapper pow */
-	double x,y;
-#endif
+#if !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
+static _NOINLINE double
+pow_error(double x, double y, double z)
 {
-#ifdef _IEEE_LIBM
-	return  __ieee754_pow(x,y);
-#else
-	double z;
 #ifndef HUGE_VAL 
 #define HUGE_VAL inf
 	double inf = 0.0;
@@ -82,7 +75,6 @@ PORTABILITY
 	SET_HIGH_WORD(inf,0x7ff00000);	/* set inf to infinite */
 #endif
 	struct exception exc;
-	z=__ieee754_pow(x,y);
 	if(_LIB_VERSION == _IEEE_|| isnan(y)) return z;
 	if(isnan(x)) {
 	    if(y==0.0) { 
@@ -211,6 +203,24 @@ PORTABILITY
             return exc.retval; 
         } 
 	return z;
+}
+#endif
+
+#ifdef __STDC__
+	double pow(double x, double y)	/* wrapper pow */
+#else
+	double pow(x,y)			/* wrapper pow */
+	double x,y;
+#endif
+{
+#if defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return  __ieee754_pow(x,y);
+#else
+	double z;
+	z = __ieee754_pow(x,y);
+	if(__predict_false(!isfinite(z)||z==0.0||y==0.0))
+	    return pow_error(x,y,z);
+	return z;
 #endif
 }
 
@@ -22,25 +22,15 @@
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-#ifdef _SCALB_INT
-	double scalb(double x, int fn)		/* wrapper scalb */
-#else
-	double scalb(double x, double fn)	/* wrapper scalb */
-#endif
-#else
-	double scalb(x,fn)			/* wrapper scalb */
+#ifndef _IEEE_LIBM
 #ifdef _SCALB_INT
-	double x; int fn;
+static _NOINLINE double
+scalb_error(double x, int fn, double z)
 #else
-	double x,fn;
-#endif
+static _NOINLINE double
+scalb_error(double x, double fn, double z)
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_scalb(x,fn);
-#else
-	double z;
 #ifndef HUGE_VAL 
 #define HUGE_VAL inf
 	double inf = 0.0;
@@ -48,7 +38,6 @@
 	SET_HIGH_WORD(inf,0x7ff00000);	/* set inf to infinite */
 #endif
 	struct exception exc;
-	z = __ieee754_scalb(x,fn);
 	if(_LIB_VERSION == _IEEE_) return z;
 	if(!(finite(z)||isnan(z))&&finite(x)) {
 	    /* scalb overflow; SVID also returns +-HUGE_VAL */
@@ -88,6 +77,32 @@
 	if(!finite(fn)) errno = ERANGE;
 #endif
 	return z;
+}
+#endif
+
+#ifdef __STDC__
+#ifdef _SCALB_INT
+	double scalb(double x, int fn)		/* wrapper scalb */
+#else
+	double scalb(double x, double fn)	/* wrapper scalb */
+#endif
+#else
+	double scalb(x,fn)			/* wrapper scalb */
+#ifdef _SCALB_INT
+	double x; int fn;
+#else
+	double x,fn;
+#endif
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_scalb(x,fn);
+#else
+	double z;
+	z = __ieee754_scalb(x,fn);
+	if(__predict_false(!isfinite(z)||z==0.0))
+	    return scalb_error(x,fn,z);
+	return z;
 #endif 
 }
 
@@ -1,11 +1,15 @@
-/* sincos -- currently no more efficient than two separate calls to
-   sin and cos. */
+/* sincos -- sin and cos of the same argument.  Unless __OBSOLETE_MATH
+   the argument is reduced once and both polynomials are evaluated in
+   the same pass, see k_sincos.h; otherwise this is no more efficient
+   than two separate calls to sin and cos. */
 
 #include "fdlibm.h"
 #include <errno.h>
 
 #ifndef _DOUBLE_IS_32BITS
 
+#if __OBSOLETE_MATH
+
 #ifdef __STDC__
 	void sincos(double x, double *sinx, double *cosx)
 #else
@@ -19,4 +23,48 @@
   *cosx = cos (x);
 }
 
+#else /* !__OBSOLETE_MATH */
+
+#include "k_sincos.h"
+
+void
+sincos (double x, double *sinx, double *cosx)
+{
+	double y[2],s,c;
+	__int32_t n,ix;
+
+	GET_HIGH_WORD(ix,x);
+
+    /* |x| ~< pi/4 */
+	ix &= 0x7fffffff;
+	if(ix <= 0x3fe921fb) {
+	    if(ix < 0x3e400000)			/* |x| < 2**-27 */
+		if((int)x == 0) {		/* generate inexact */
+		    *sinx = x;
+		    *cosx = 1.0;
+		    return;
+		}
+	    sincos_poly(x,0.0,0,sinx,cosx);
+	    return;
+	}
+
+    /* sincos(Inf or NaN) is NaN */
+	if (ix>=0x7ff00000) {
+	    *sinx = *cosx = x-x;
+	    return;
+	}
+
+	n = rem_pio2(x,y);
+	sincos_poly(y[0],y[1],1,&s,&c);
+	switch(n&3) {
+	    case 0: *sinx =  s; *cosx =  c; break;
+	    case 1: *sinx =  c; *cosx = -s; break;
+	    case 2: *sinx = -s; *cosx = -c; break;
+	    default:
+		    *sinx = -c; *cosx =  s; break;
+	}
+}
+
+#endif /* __OBSOLETE_MATH */
+
 #endif /* defined(_DOUBLE_IS_32BITS) */
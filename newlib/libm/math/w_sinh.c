@@ -74,19 +74,11 @@ QUICKREF
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double sinh(double x)		/* wrapper sinh */
-#else
-	double sinh(x)			/* wrapper sinh */
-	double x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+sinh_error(double x, double z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_sinh(x);
-#else
-	double z; 
 	struct exception exc;
-	z = __ieee754_sinh(x);
 	if(_LIB_VERSION == _IEEE_) return z;
 	if(!finite(z)&&finite(x)) {
 	    /* sinh(finite) overflow */
@@ -114,6 +106,24 @@ QUICKREF
             return exc.retval;
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	double sinh(double x)		/* wrapper sinh */
+#else
+	double sinh(x)			/* wrapper sinh */
+	double x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_sinh(x);
+#else
+	double z;
+	z = __ieee754_sinh(x);
+	if(__predict_false(!isfinite(z)))
+	    return sinh_error(x,z);
+	return z;
 #endif
 }
 
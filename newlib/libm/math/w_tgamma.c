@@ -19,6 +19,22 @@
 
 #ifndef _DOUBLE_IS_32BITS
 
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+tgamma_error(double x, double y)
+{
+	if(_LIB_VERSION == _IEEE_) return y;
+
+	if(!finite(y)&&finite(x)) {
+	  if(floor(x)==x&&x<=0.0)
+	    return __kernel_standard(x,x,41); /* tgamma pole */
+	  else
+	    return __kernel_standard(x,x,40); /* tgamma overflow */
+	}
+	return y;
+}
+#endif
+
 #ifdef __STDC__
 	double tgamma(double x)
 #else
@@ -33,14 +49,8 @@
 #ifdef _IEEE_LIBM
 	return y;
 #else
-	if(_LIB_VERSION == _IEEE_) return y;
-
-	if(!finite(y)&&finite(x)) {
-	  if(floor(x)==x&&x<=0.0)
-	    return __kernel_standard(x,x,41); /* tgamma pole */
-	  else
-	    return __kernel_standard(x,x,40); /* tgamma overflow */
-	}
+	if(__predict_false(!isfinite(y)))
+	    return tgamma_error(x,y);
 	return y;
 #endif
 }
@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef _HAVE_STDC
-	float acosf(float x)		/* wrapper acosf */
-#else
-	float acosf(x)			/* wrapper acosf */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+acosf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_acosf(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_acosf(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(fabsf(x)>(float)1.0) {
 	    /* acosf(|x|>1) */
@@ -51,6 +43,26 @@
 	    return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef _HAVE_STDC
+	float acosf(float x)		/* wrapper acosf */
+#else
+	float acosf(x)			/* wrapper acosf */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_acosf(x);
+#else
+	float z;
+	__int32_t hx;
+	z = __ieee754_acosf(x);
+	GET_FLOAT_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>0x3f800000))
+	    return acosf_error(x,z);
+	return z;
 #endif
 }
 
@@ -21,19 +21,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float acoshf(float x)		/* wrapper acoshf */
-#else
-	float acoshf(x)			/* wrapper acoshf */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+acoshf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_acoshf(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_acoshf(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(x<(float)1.0) {
             /* acoshf(x<1) */
@@ -52,6 +44,24 @@
 	    return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float acoshf(float x)		/* wrapper acoshf */
+#else
+	float acoshf(x)			/* wrapper acoshf */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_acoshf(x);
+#else
+	float z;
+	z = __ieee754_acoshf(x);
+	if(__predict_false(x<(float)1.0))
+	    return acoshf_error(x,z);
+	return z;
 #endif
 }
 
@@ -22,19 +22,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float asinf(float x)		/* wrapper asinf */
-#else
-	float asinf(x)			/* wrapper asinf */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+asinf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_asinf(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_asinf(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(fabsf(x)>(float)1.0) {
 	    /* asinf(|x|>1) */
@@ -53,6 +45,26 @@
 	    return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float asinf(float x)		/* wrapper asinf */
+#else
+	float asinf(x)			/* wrapper asinf */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_asinf(x);
+#else
+	float z;
+	__int32_t hx;
+	z = __ieee754_asinf(x);
+	GET_FLOAT_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>0x3f800000))
+	    return asinf_error(x,z);
+	return z;
 #endif
 }
 
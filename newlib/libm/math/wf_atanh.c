@@ -19,19 +19,12 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float atanhf(float x)		/* wrapper atanhf */
-#else
-	float atanhf(x)			/* wrapper atanhf */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+atanhf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_atanhf(x);
-#else
-	float z,y;
+	float y;
 	struct exception exc;
-	z = __ieee754_atanhf(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	y = fabsf(x);
 	if(y>=(float)1.0) {
@@ -65,6 +58,26 @@
             return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float atanhf(float x)		/* wrapper atanhf */
+#else
+	float atanhf(x)			/* wrapper atanhf */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_atanhf(x);
+#else
+	float z;
+	__int32_t hx;
+	z = __ieee754_atanhf(x);
+	GET_FLOAT_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>=0x3f800000))
+	    return atanhf_error(x,z);
+	return z;
 #endif
 }
 
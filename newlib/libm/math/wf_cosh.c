@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float coshf(float x)		/* wrapper coshf */
-#else
-	float coshf(x)			/* wrapper coshf */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+coshf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_coshf(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_coshf(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(fabsf(x)>(float)8.9415985107e+01) {	
 	    /* coshf(finite) overflow */
@@ -60,6 +52,26 @@
 	    return (float)exc.retval;
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float coshf(float x)		/* wrapper coshf */
+#else
+	float coshf(x)			/* wrapper coshf */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_coshf(x);
+#else
+	float z;
+	__int32_t hx;
+	z = __ieee754_coshf(x);
+	GET_FLOAT_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>0x42b2d4fc))
+	    return coshf_error(x,z);
+	return z;
 #endif
 }
 
@@ -20,27 +20,24 @@
 #include "fdlibm.h"
 #include <errno.h>
 
+#if !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
 #ifdef __STDC__
 static const float
 #else
 static float
 #endif
+#if __OBSOLETE_MATH
 o_threshold=  8.8721679688e+01,  /* 0x42b17180 */
 u_threshold= -1.0397208405e+02;  /* 0xc2cff1b5 */
-
-#ifdef __STDC__
-	float expf(float x)		/* wrapper expf */
 #else
-	float expf(x)			/* wrapper expf */
-	float x;
+o_threshold=  8.8722831726e+01,  /* 0x42b17217 */
+u_threshold= -1.0397207642e+02;  /* 0xc2cff1b4 */
 #endif
+
+static _NOINLINE float
+expf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_expf(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_expf(x);
 	if(_LIB_VERSION == _IEEE_) return z;
 	if(finitef(x)) {
 	    if(x>o_threshold) {
@@ -85,6 +82,26 @@ u_threshold= -1.0397208405e+02;  /* 0xc2cff1b5 */
 	    } 
 	} 
 	return z;
+}
+#endif
+
+#ifdef __STDC__
+	float expf(float x)		/* wrapper expf */
+#else
+	float expf(x)			/* wrapper expf */
+	float x;
+#endif
+{
+#if defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return __ieee754_expf(x);
+#else
+	float z;
+	__int32_t hx;
+	z = __ieee754_expf(x);
+	GET_FLOAT_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>0x42b17180))
+	    return expf_error(x,z);
+	return z;
 #endif
 }
 
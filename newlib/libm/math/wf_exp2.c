@@ -21,6 +21,56 @@
 #include <errno.h>
 #include <math.h>
 
+#if !__OBSOLETE_MATH && !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
+static _NOINLINE float
+exp2f_error(float x, float z)
+{
+	struct exception exc;
+	if(_LIB_VERSION == _IEEE_ || !finitef(x)) return z;
+	if(!finitef(z)) {
+	    /* exp2f(finite) overflow */
+#ifndef HUGE_VAL
+#define HUGE_VAL inf
+	    double inf = 0.0;
+
+	    SET_HIGH_WORD(inf,0x7ff00000);	/* set inf to infinite */
+#endif
+	    exc.type = OVERFLOW;
+	    exc.name = "exp2f";
+	    exc.err = 0;
+	    exc.arg1 = exc.arg2 = (double)x;
+	    if (_LIB_VERSION == _SVID_)
+	      exc.retval = HUGE;
+	    else
+	      exc.retval = HUGE_VAL;
+	    if (_LIB_VERSION == _POSIX_)
+	      errno = ERANGE;
+	    else if (!matherr(&exc)) {
+		    errno = ERANGE;
+	    }
+	    if (exc.err != 0)
+	       errno = exc.err;
+	    return exc.retval;
+	} else if(z == 0.0f) {
+	    /* exp2f(finite) underflow */
+	    exc.type = UNDERFLOW;
+	    exc.name = "exp2f";
+	    exc.err = 0;
+	    exc.arg1 = exc.arg2 = (double)x;
+	    exc.retval = 0.0;
+	    if (_LIB_VERSION == _POSIX_)
+	      errno = ERANGE;
+	    else if (!matherr(&exc)) {
+		    errno = ERANGE;
+	    }
+	    if (exc.err != 0)
+	       errno = exc.err;
+	    return exc.retval;
+	}
+	return z;
+}
+#endif
+
 #ifdef __STDC__
 	float exp2f(float x)		/* wrapper exp2f */
 #else
@@ -28,7 +78,17 @@
 	float x;
 #endif
 {
-  return powf(2.0, x);
+#if __OBSOLETE_MATH
+	return powf(2.0, x);
+#elif defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return __ieee754_exp2f(x);
+#else
+	float z;
+	z = __ieee754_exp2f(x);
+	if(__predict_false(!isfinite(z)||z==(float)0.0))
+	    return exp2f_error(x,z);
+	return z;
+#endif
 }
 
 #ifdef _DOUBLE_IS_32BITS
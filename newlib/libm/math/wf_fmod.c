@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float fmodf(float x, float y)	/* wrapper fmodf */
-#else
-	float fmodf(x,y)		/* wrapper fmodf */
-	float x,y;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+fmodf_error(float x, float y, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_fmodf(x,y);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_fmodf(x,y);
 	if(_LIB_VERSION == _IEEE_ ||isnan(y)||isnan(x)) return z;
 	if(y==(float)0.0) {
             /* fmodf(x,0) */
@@ -55,6 +47,24 @@
             return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float fmodf(float x, float y)	/* wrapper fmodf */
+#else
+	float fmodf(x,y)		/* wrapper fmodf */
+	float x,y;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_fmodf(x,y);
+#else
+	float z;
+	z = __ieee754_fmodf(x,y);
+	if(__predict_false(y==(float)0.0))
+	    return fmodf_error(x,y,z);
+	return z;
 #endif
 }
 
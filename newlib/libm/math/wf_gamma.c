@@ -18,19 +18,11 @@
 #include <reent.h>
 #include <errno.h>
 
-#ifdef __STDC__
-	float gammaf(float x)
-#else
-	float gammaf(x)
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+gammaf_error(float x, float y)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_gammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
-#else
-        float y;
 	struct exception exc;
-        y = __ieee754_gammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
         if(_LIB_VERSION == _IEEE_) return y;
         if(!finitef(y)&&finitef(x)) {
 #ifndef HUGE_VAL 
@@ -75,6 +67,24 @@
 	    return (float)exc.retval; 
         } else
             return y;
+}
+#endif
+
+#ifdef __STDC__
+	float gammaf(float x)
+#else
+	float gammaf(x)
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_gammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
+#else
+	float y;
+	y = __ieee754_gammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
+	if(__predict_false(!isfinite(y)))
+	    return gammaf_error(x,y);
+	return y;
 #endif
 }             
 
@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float hypotf(float x, float y)	/* wrapper hypotf */
-#else
-	float hypotf(x,y)		/* wrapper hypotf */
-	float x,y;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+hypotf_error(float x, float y, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_hypotf(x,y);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_hypotf(x,y);
 	if(_LIB_VERSION == _IEEE_) return z;
 	if((!finitef(z))&&finitef(x)&&finitef(y)) {
 	    /* hypotf(finite,finite) overflow */
@@ -61,6 +53,24 @@
             return (float)exc.retval;
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float hypotf(float x, float y)	/* wrapper hypotf */
+#else
+	float hypotf(x,y)		/* wrapper hypotf */
+	float x,y;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_hypotf(x,y);
+#else
+	float z;
+	z = __ieee754_hypotf(x,y);
+	if(__predict_false(!isfinite(z)))
+	    return hypotf_error(x,y,z);
+	return z;
 #endif
 }
 
@@ -20,18 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float j0f(float x)		/* wrapper j0f */
-#else
-	float j0f(x)			/* wrapper j0f */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+j0f_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_j0f(x);
-#else
 	struct exception exc;
-	float z = __ieee754_j0f(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(fabsf(x)>(float)X_TLOSS) {
 	    /* j0f(|x|>X_TLOSS) */
@@ -50,22 +43,34 @@
             return (float)exc.retval; 
 	} else
 	    return z;
-#endif
 }
+#endif
 
 #ifdef __STDC__
-	float y0f(float x)		/* wrapper y0f */
+	float j0f(float x)		/* wrapper j0f */
 #else
-	float y0f(x)			/* wrapper y0f */
+	float j0f(x)			/* wrapper j0f */
 	float x;
 #endif
 {
 #ifdef _IEEE_LIBM
-	return __ieee754_y0f(x);
+	return __ieee754_j0f(x);
 #else
 	float z;
+	__int32_t hx;
+	z = __ieee754_j0f(x);
+	GET_FLOAT_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>0x5a490fdb))
+	    return j0f_error(x,z);
+	return z;
+#endif
+}
+
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+y0f_error(float x, float z)
+{
 	struct exception exc;
-	z = __ieee754_y0f(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
         if(x <= (float)0.0){
 #ifndef HUGE_VAL 
@@ -109,6 +114,24 @@
             return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float y0f(float x)		/* wrapper y0f */
+#else
+	float y0f(x)			/* wrapper y0f */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_y0f(x);
+#else
+	float z;
+	z = __ieee754_y0f(x);
+	if(__predict_false(x<=(float)0.0||x>(float)X_TLOSS))
+	    return y0f_error(x,z);
+	return z;
 #endif
 }
 
@@ -21,19 +21,11 @@
 #include <errno.h>
 
 
-#ifdef __STDC__
-	float j1f(float x)		/* wrapper j1f */
-#else
-	float j1f(x)			/* wrapper j1f */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+j1f_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_j1f(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_j1f(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
 	if(fabsf(x)>(float)X_TLOSS) {
 	    /* j1f(|x|>X_TLOSS) */
@@ -52,22 +44,34 @@
             return exc.retval; 
 	} else
 	    return z;
-#endif
 }
+#endif
 
 #ifdef __STDC__
-	float y1f(float x)		/* wrapper y1f */
+	float j1f(float x)		/* wrapper j1f */
 #else
-	float y1f(x)			/* wrapper y1f */
+	float j1f(x)			/* wrapper j1f */
 	float x;
 #endif
 {
 #ifdef _IEEE_LIBM
-	return __ieee754_y1f(x);
+	return __ieee754_j1f(x);
 #else
 	float z;
+	__int32_t hx;
+	z = __ieee754_j1f(x);
+	GET_FLOAT_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>0x5a490fdb))
+	    return j1f_error(x,z);
+	return z;
+#endif
+}
+
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+y1f_error(float x, float z)
+{
 	struct exception exc;
-	z = __ieee754_y1f(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
         if(x <= (float)0.0){
 	    /* y1f(0) = -inf or y1f(x<0) = NaN */
@@ -111,6 +115,24 @@
             return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float y1f(float x)		/* wrapper y1f */
+#else
+	float y1f(x)			/* wrapper y1f */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_y1f(x);
+#else
+	float z;
+	z = __ieee754_y1f(x);
+	if(__predict_false(x<=(float)0.0||x>(float)X_TLOSS))
+	    return y1f_error(x,z);
+	return z;
 #endif
 }
 
@@ -17,19 +17,11 @@
 #include <errno.h>
 
 
-#ifdef __STDC__
-	float jnf(int n, float x)	/* wrapper jnf */
-#else
-	float jnf(n,x)			/* wrapper jnf */
-	float x; int n;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+jnf_error(int n, float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_jnf(n,x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_jnf(n,x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
 	if(fabsf(x)>(float)X_TLOSS) {
 	    /* jnf(|x|>X_TLOSS) */
@@ -49,22 +41,34 @@
             return exc.retval; 
 	} else
 	    return z;
-#endif
 }
+#endif
 
 #ifdef __STDC__
-	float ynf(int n, float x)	/* wrapper ynf */
+	float jnf(int n, float x)	/* wrapper jnf */
 #else
-	float ynf(n,x)			/* wrapper ynf */
+	float jnf(n,x)			/* wrapper jnf */
 	float x; int n;
 #endif
 {
 #ifdef _IEEE_LIBM
-	return __ieee754_ynf(n,x);
+	return __ieee754_jnf(n,x);
 #else
 	float z;
+	__int32_t hx;
+	z = __ieee754_jnf(n,x);
+	GET_FLOAT_WORD(hx,x);
+	if(__predict_false((hx&0x7fffffff)>0x5a490fdb))
+	    return jnf_error(n,x,z);
+	return z;
+#endif
+}
+
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+ynf_error(int n, float x, float z)
+{
 	struct exception exc;
-	z = __ieee754_ynf(n,x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) ) return z;
         if(x <= (float)0.0){
 	    /* ynf(n,0) = -inf or ynf(x<0) = NaN */
@@ -110,6 +114,24 @@
             return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float ynf(int n, float x)	/* wrapper ynf */
+#else
+	float ynf(n,x)			/* wrapper ynf */
+	float x; int n;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_ynf(n,x);
+#else
+	float z;
+	z = __ieee754_ynf(n,x);
+	if(__predict_false(x<=(float)0.0||x>(float)X_TLOSS))
+	    return ynf_error(n,x,z);
+	return z;
 #endif
 }
 
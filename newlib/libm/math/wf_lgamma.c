@@ -18,19 +18,11 @@
 #include <reent.h>
 #include <errno.h>
 
-#ifdef __STDC__
-	float lgammaf(float x)
-#else
-	float lgammaf(x)
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+lgammaf_error(float x, float y)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_lgammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
-#else
-        float y;
 	struct exception exc;
-        y = __ieee754_lgammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
         if(_LIB_VERSION == _IEEE_) return y;
         if(!finitef(y)&&finitef(x)) {
 #ifndef HUGE_VAL 
@@ -69,6 +61,24 @@
             return (float)exc.retval; 
         } else
             return y;
+}
+#endif
+
+#ifdef __STDC__
+	float lgammaf(float x)
+#else
+	float lgammaf(x)
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_lgammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
+#else
+	float y;
+	y = __ieee754_lgammaf_r(x,&(_REENT_SIGNGAM(_REENT)));
+	if(__predict_false(!isfinite(y)))
+	    return lgammaf_error(x,y);
+	return y;
 #endif
 }             
 
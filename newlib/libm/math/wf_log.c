@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float logf(float x)		/* wrapper logf */
-#else
-	float logf(x)			/* wrapper logf */
-	float x;
-#endif
+#if !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
+static _NOINLINE float
+logf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_logf(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_logf(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x) || x > (float)0.0) return z;
 #ifndef HUGE_VAL 
 #define HUGE_VAL inf
@@ -68,6 +60,24 @@
 	if (exc.err != 0)
            errno = exc.err;
         return (float)exc.retval; 
+}
+#endif
+
+#ifdef __STDC__
+	float logf(float x)		/* wrapper logf */
+#else
+	float logf(x)			/* wrapper logf */
+	float x;
+#endif
+{
+#if defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return __ieee754_logf(x);
+#else
+	float z;
+	z = __ieee754_logf(x);
+	if(__predict_false(x<=(float)0.0))
+	    return logf_error(x,z);
+	return z;
 #endif
 }
 
@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float log10f(float x)		/* wrapper log10f */
-#else
-	float log10f(x)			/* wrapper log10f */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+log10f_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_log10f(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_log10f(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(x<=(float)0.0) {
 #ifndef HUGE_VAL 
@@ -71,6 +63,24 @@
             return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float log10f(float x)		/* wrapper log10f */
+#else
+	float log10f(x)			/* wrapper log10f */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_log10f(x);
+#else
+	float z;
+	z = __ieee754_log10f(x);
+	if(__predict_false(x<=(float)0.0))
+	    return log10f_error(x,z);
+	return z;
 #endif
 }
 
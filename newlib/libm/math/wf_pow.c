@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float powf(float x, float y)	/* wrapper powf */
-#else
-	float powf(x,y)			/* wrapper powf */
-	float x,y;
-#endif
+#if !defined(_IEEE_LIBM) && !__MATH_ERRNO_IN_KERNEL
+static _NOINLINE float
+powf_error(float x, float y, float z)
 {
-#ifdef _IEEE_LIBM
-	return  __ieee754_powf(x,y);
-#else
-	float z;
 	struct exception exc;
-	z=__ieee754_powf(x,y);
 	if(_LIB_VERSION == _IEEE_|| isnan(y)) return z;
 	if(isnan(x)) {
 	    if(y==(float)0.0) { 
@@ -161,6 +153,24 @@
             return (float)exc.retval; 
         }
 	return z;
+}
+#endif
+
+#ifdef __STDC__
+	float powf(float x, float y)	/* wrapper powf */
+#else
+	float powf(x,y)			/* wrapper powf */
+	float x,y;
+#endif
+{
+#if defined(_IEEE_LIBM) || __MATH_ERRNO_IN_KERNEL
+	return  __ieee754_powf(x,y);
+#else
+	float z;
+	z = __ieee754_powf(x,y);
+	if(__predict_false(!isfinite(z)||z==(float)0.0||y==(float)0.0))
+	    return powf_error(x,y,z);
+	return z;
 #endif
 }
 
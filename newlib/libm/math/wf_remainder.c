@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float remainderf(float x, float y)	/* wrapper remainder */
-#else
-	float remainderf(x,y)			/* wrapper remainder */
-	float x,y;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+remainderf_error(float x, float y, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_remainderf(x,y);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_remainderf(x,y);
 	if(_LIB_VERSION == _IEEE_ || isnan(y)) return z;
 	if(y==(float)0.0) { 
             /* remainderf(x,0) */
@@ -52,6 +44,24 @@
             return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float remainderf(float x, float y)	/* wrapper remainder */
+#else
+	float remainderf(x,y)			/* wrapper remainder */
+	float x,y;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_remainderf(x,y);
+#else
+	float z;
+	z = __ieee754_remainderf(x,y);
+	if(__predict_false(y==(float)0.0))
+	    return remainderf_error(x,y,z);
+	return z;
 #endif
 }
 
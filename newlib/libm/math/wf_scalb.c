@@ -22,25 +22,15 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-#ifdef _SCALB_INT
-	float scalbf(float x, int fn)		/* wrapper scalbf */
-#else
-	float scalbf(float x, float fn)		/* wrapper scalbf */
-#endif
-#else
-	float scalbf(x,fn)			/* wrapper scalbf */
+#ifndef _IEEE_LIBM
 #ifdef _SCALB_INT
-	float x; int fn;
+static _NOINLINE float
+scalbf_error(float x, int fn, float z)
 #else
-	float x,fn;
-#endif
+static _NOINLINE float
+scalbf_error(float x, float fn, float z)
 #endif
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_scalbf(x,fn);
-#else
-	float z;
 #ifndef HUGE_VAL 
 #define HUGE_VAL inf
 	double inf = 0.0;
@@ -48,7 +38,6 @@
 	SET_HIGH_WORD(inf,0x7ff00000);	/* set inf to infinite */
 #endif
 	struct exception exc;
-	z = __ieee754_scalbf(x,fn);
 	if(_LIB_VERSION == _IEEE_) return z;
 	if(!(finitef(z)||isnan(z))&&finitef(x)) {
 	    /* scalbf overflow; SVID also returns +-HUGE_VAL */
@@ -88,6 +77,32 @@
 	if(!finitef(fn)) errno = ERANGE;
 #endif
 	return z;
+}
+#endif
+
+#ifdef __STDC__
+#ifdef _SCALB_INT
+	float scalbf(float x, int fn)		/* wrapper scalbf */
+#else
+	float scalbf(float x, float fn)		/* wrapper scalbf */
+#endif
+#else
+	float scalbf(x,fn)			/* wrapper scalbf */
+#ifdef _SCALB_INT
+	float x; int fn;
+#else
+	float x,fn;
+#endif
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_scalbf(x,fn);
+#else
+	float z;
+	z = __ieee754_scalbf(x,fn);
+	if(__predict_false(!isfinite(z)||z==(float)0.0))
+	    return scalbf_error(x,fn,z);
+	return z;
 #endif 
 }
 
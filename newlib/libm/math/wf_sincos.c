@@ -1,8 +1,12 @@
-/* sincos -- currently no more efficient than two separate calls to
-   sin and cos. */
+/* sincosf -- float version of w_sincos.c.  Unless __OBSOLETE_MATH the
+   argument is reduced once and both polynomials are evaluated in the
+   same pass, see k_sincos.h; otherwise this is no more efficient than
+   two separate calls to sinf and cosf. */
 #include "fdlibm.h"
 #include <errno.h>
 
+#if __OBSOLETE_MATH
+
 #ifdef __STDC__
 	void sincosf(float x, float *sinx, float *cosx)
 #else
@@ -16,6 +20,49 @@
   *cosx = cosf (x);
 }
 
+#else /* !__OBSOLETE_MATH */
+
+#include "k_sincos.h"
+
+void
+sincosf (float x, float *sinx, float *cosx)
+{
+	double_t r,z,s,c;
+	__int32_t n;
+	__uint32_t ix;
+
+	GET_FLOAT_WORD(ix,x);
+
+    /* |x| ~< pi/4 */
+	ix &= 0x7fffffff;
+	if(ix <= 0x3f490fd8) {
+	    z = (double_t) x*x;
+	    *sinx = sinf_poly(x,z);
+	    *cosx = cosf_poly(z);
+	    return;
+	}
+
+    /* sincos(Inf or NaN) is NaN */
+	if (!FLT_UWORD_IS_FINITE(ix)) {
+	    *sinx = *cosx = x-x;
+	    return;
+	}
+
+	r = rem_pio2f(x,ix,&n);
+	z = r*r;
+	s = sinf_poly(r,z);
+	c = cosf_poly(z);
+	switch(n&3) {
+	    case 0: *sinx =  s; *cosx =  c; break;
+	    case 1: *sinx =  c; *cosx = -s; break;
+	    case 2: *sinx = -s; *cosx = -c; break;
+	    default:
+		    *sinx = -c; *cosx =  s; break;
+	}
+}
+
+#endif /* __OBSOLETE_MATH */
+
 #ifdef _DOUBLE_IS_32BITS
 
 #ifdef __STDC__
@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float sinhf(float x)		/* wrapper sinhf */
-#else
-	float sinhf(x)			/* wrapper sinhf */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+sinhf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_sinhf(x);
-#else
-	float z; 
 	struct exception exc;
-	z = __ieee754_sinhf(x);
 	if(_LIB_VERSION == _IEEE_) return z;
 	if(!finitef(z)&&finitef(x)) {
 	    /* sinhf(finite) overflow */
@@ -60,6 +52,24 @@
             return (float)exc.retval;
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float sinhf(float x)		/* wrapper sinhf */
+#else
+	float sinhf(x)			/* wrapper sinhf */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_sinhf(x);
+#else
+	float z;
+	z = __ieee754_sinhf(x);
+	if(__predict_false(!isfinite(z)))
+	    return sinhf_error(x,z);
+	return z;
 #endif
 }
 
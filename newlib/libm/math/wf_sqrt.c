@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float sqrtf(float x)		/* wrapper sqrtf */
-#else
-	float sqrtf(x)			/* wrapper sqrtf */
-	float x;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+sqrtf_error(float x, float z)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_sqrtf(x);
-#else
-	float z;
 	struct exception exc;
-	z = __ieee754_sqrtf(x);
 	if(_LIB_VERSION == _IEEE_ || isnan(x)) return z;
 	if(x<(float)0.0) {
             /* sqrtf(negative) */
@@ -54,6 +46,24 @@
 	    return (float)exc.retval; 
 	} else
 	    return z;
+}
+#endif
+
+#ifdef __STDC__
+	float sqrtf(float x)		/* wrapper sqrtf */
+#else
+	float sqrtf(x)			/* wrapper sqrtf */
+	float x;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_sqrtf(x);
+#else
+	float z;
+	z = __ieee754_sqrtf(x);
+	if(__predict_false(x<(float)0.0))
+	    return sqrtf_error(x,z);
+	return z;
 #endif
 }
 
@@ -16,6 +16,24 @@
 #include "math.h"
 #include "fdlibm.h"
 
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+tgammaf_error(float x, float y)
+{
+	if(_LIB_VERSION == _IEEE_) return y;
+
+	if(!finitef(y)&&finitef(x)) {
+	  if(floorf(x)==x&&x<=(float)0.0)
+	    /* tgammaf pole */
+	    return (float)__kernel_standard((double)x,(double)x,141);
+	  else
+	    /* tgammaf overflow */
+	    return (float)__kernel_standard((double)x,(double)x,140);
+	}
+	return y;
+}
+#endif
+
 #ifdef __STDC__
 	float tgammaf(float x)
 #else
@@ -30,16 +48,8 @@
 #ifdef _IEEE_LIBM
 	return y;
 #else
-	if(_LIB_VERSION == _IEEE_) return y;
-
-	if(!finitef(y)&&finitef(x)) {
-	  if(floorf(x)==x&&x<=(float)0.0)
-	    /* tgammaf pole */
-	    return (float)__kernel_standard((double)x,(double)x,141);
-	  else
-	    /* tgammaf overflow */
-	    return (float)__kernel_standard((double)x,(double)x,140);
-	}
+	if(__predict_false(!isfinite(y)))
+	    return tgammaf_error(x,y);
 	return y;
 #endif
 }
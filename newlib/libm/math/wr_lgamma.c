@@ -20,19 +20,11 @@
 
 #ifndef _DOUBLE_IS_32BITS
 
-#ifdef __STDC__
-	double lgamma_r(double x, int *signgamp) /* wrapper lgamma_r */
-#else
-	double lgamma_r(x,signgamp)              /* wrapper lgamma_r */
-	double x; int *signgamp;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE double
+lgamma_r_error(double x, int *signgamp, double y)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_lgamma_r(x,signgamp);
-#else
-        double y;
 	struct exception exc;
-        y = __ieee754_lgamma_r(x,signgamp);
         if(_LIB_VERSION == _IEEE_) return y;
         if(!finite(y)&&finite(x)) {
 #ifndef HUGE_VAL 
@@ -71,6 +63,24 @@
             return exc.retval; 
         } else
             return y;
+}
+#endif
+
+#ifdef __STDC__
+	double lgamma_r(double x, int *signgamp) /* wrapper lgamma_r */
+#else
+	double lgamma_r(x,signgamp)              /* wrapper lgamma_r */
+	double x; int *signgamp;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_lgamma_r(x,signgamp);
+#else
+	double y;
+	y = __ieee754_lgamma_r(x,signgamp);
+	if(__predict_false(!isfinite(y)))
+	    return lgamma_r_error(x,signgamp,y);
+	return y;
 #endif
 }
 
@@ -20,19 +20,11 @@
 #include "fdlibm.h"
 #include <errno.h>
 
-#ifdef __STDC__
-	float lgammaf_r(float x, int *signgamp) /* wrapper lgammaf_r */
-#else
-	float lgammaf_r(x,signgamp)              /* wrapper lgammaf_r */
-	float x; int *signgamp;
-#endif
+#ifndef _IEEE_LIBM
+static _NOINLINE float
+lgammaf_r_error(float x, int *signgamp, float y)
 {
-#ifdef _IEEE_LIBM
-	return __ieee754_lgammaf_r(x,signgamp);
-#else
-        float y;
 	struct exception exc;
-        y = __ieee754_lgammaf_r(x,signgamp);
         if(_LIB_VERSION == _IEEE_) return y;
         if(!finitef(y)&&finitef(x)) {
 #ifndef HUGE_VAL 
@@ -71,5 +63,23 @@
             return (float)exc.retval; 
         } else
             return y;
+}
+#endif
+
+#ifdef __STDC__
+	float lgammaf_r(float x, int *signgamp) /* wrapper lgammaf_r */
+#else
+	float lgammaf_r(x,signgamp)              /* wrapper lgammaf_r */
+	float x; int *signgamp;
+#endif
+{
+#ifdef _IEEE_LIBM
+	return __ieee754_lgammaf_r(x,signgamp);
+#else
+	float y;
+	y = __ieee754_lgammaf_r(x,signgamp);
+	if(__predict_false(!isfinite(y)))
+	    return lgammaf_r_error(x,signgamp,y);
+	return y;
 #endif
 }             
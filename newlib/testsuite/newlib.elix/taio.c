@@ -0,0 +1,330 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for POSIX asynchronous I/O: reads and writes through
+ * aio_read(), aio_write() and lio_listio() must move the right bytes,
+ * writes on one descriptor must land in the order queued, aio_fsync()
+ * must come after them, completion must be signalled or reported on a
+ * new thread when asked, and requests not started must be cancellable.
+ * All of it is run once on the thread pool and once on io_uring, which
+ * is the thread pool again where the kernel lacks it.
+ *
+ * Built with -DBENCH it instead prints read throughput on a file for
+ * several numbers of requests kept in flight, on each engine.
+ */
+
+#include <sys/types.h>
+#include <aio.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+#include "check.h"
+
+#define NAME	"taio.tmp"
+#define BLOCK	4096
+#define NBLOCKS	64
+
+static char data[NBLOCKS * BLOCK];
+static char buf[NBLOCKS * BLOCK];
+static struct aiocb cb[NBLOCKS];
+
+/* Wait until every request in LIST has finished.  */
+static void
+wait_all (struct aiocb *const list[], int n)
+{
+  int i;
+
+  for (i = 0; i < n; i++)
+    while (aio_error (list[i]) == EINPROGRESS)
+      CHECK (aio_suspend ((const struct aiocb *const *) &list[i], 1, NULL)
+	     == 0);
+}
+
+static void
+setup (struct aiocb *p, int fd, void *b, size_t n, off_t off, int op)
+{
+  memset (p, 0, sizeof *p);
+  p->aio_fildes = fd;
+  p->aio_buf = b;
+  p->aio_nbytes = n;
+  p->aio_offset = off;
+  p->aio_lio_opcode = op;
+  p->aio_sigevent.sigev_notify = SIGEV_NONE;
+}
+
+static void
+use (int engine)
+{
+  struct aioinit init;
+
+  memset (&init, 0, sizeof init);
+  init.aio_engine = engine;
+  aio_init (&init);
+}
+
+#ifdef BENCH
+#define FILESIZE	(64 * 1024 * 1024)
+#define READSIZE	(64 * 1024)
+#define MAXDEPTH	32
+
+static char rbuf[MAXDEPTH][READSIZE];
+
+static double
+mb_per_sec (int fd, int depth)
+{
+  struct aiocb r[MAXDEPTH], *list[MAXDEPTH];
+  struct timespec t0, t1;
+  off_t next = 0;
+  long done = 0;
+  int i;
+
+  clock_gettime (CLOCK_MONOTONIC, &t0);
+  for (i = 0; i < depth; i++)
+    {
+      list[i] = &r[i];
+      setup (&r[i], fd, rbuf[i], READSIZE, next, LIO_READ);
+      next += READSIZE;
+      CHECK (aio_read (&r[i]) == 0);
+    }
+  while (done < FILESIZE)
+    {
+      CHECK (aio_suspend ((const struct aiocb *const *) list, depth, NULL)
+	     == 0);
+      for (i = 0; i < depth; i++)
+	if (r[i].aio_nbytes != 0 && aio_error (&r[i]) != EINPROGRESS)
+	  {
+	    CHECK (aio_return (&r[i]) == READSIZE);
+	    done += READSIZE;
+	    r[i].aio_nbytes = 0;
+	    if (next < FILESIZE)
+	      {
+		setup (&r[i], fd, rbuf[i], READSIZE, next, LIO_READ);
+		next += READSIZE;
+		CHECK (aio_read (&r[i]) == 0);
+	      }
+	  }
+    }
+  clock_gettime (CLOCK_MONOTONIC, &t1);
+  return (FILESIZE / 1e6 / ((t1.tv_sec - t0.tv_sec) +
+			    (t1.tv_nsec - t0.tv_nsec) * 1e-9));
+}
+
+int
+main (void)
+{
+  static char block[READSIZE];
+  int fd, depth;
+  long i;
+
+  fd = open (NAME, O_CREAT | O_TRUNC | O_RDWR, 0644);
+  CHECK (fd != -1);
+  for (i = 0; i < FILESIZE; i += READSIZE)
+    CHECK (write (fd, block, READSIZE) == READSIZE);
+  printf ("MB/s      threads  io_uring\n");
+  for (depth = 1; depth <= MAXDEPTH; depth *= 2)
+    {
+      printf ("%2d in flight", depth);
+      use (AIO_ENGINE_THREADS);
+      printf (" %8.0f", mb_per_sec (fd, depth));
+      use (AIO_ENGINE_URING);
+      printf (" %9.0f\n", mb_per_sec (fd, depth));
+    }
+  close (fd);
+  unlink (NAME);
+  exit (0);
+}
+#else
+static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t cond = PTHREAD_COND_INITIALIZER;
+static int notified;
+static volatile sig_atomic_t signalled;
+static struct aiocb *volatile sigcb;
+static volatile int sigerr;
+static volatile ssize_t sigret;
+
+static void
+count (union sigval v)
+{
+  pthread_mutex_lock (&mutex);
+  notified += v.sival_int;
+  pthread_cond_signal (&cond);
+  pthread_mutex_unlock (&mutex);
+}
+
+static void
+wait_notified (int n)
+{
+  pthread_mutex_lock (&mutex);
+  while (notified < n)
+    pthread_cond_wait (&cond, &mutex);
+  pthread_mutex_unlock (&mutex);
+}
+
+/* aio_error and aio_return are async-signal-safe, so the handler may
+   ask for the result itself.  */
+static void
+handler (int sig)
+{
+  if (sigcb != NULL)
+    {
+      sigerr = aio_error (sigcb);
+      sigret = aio_return (sigcb);
+    }
+  signalled++;
+}
+
+static void
+run (void)
+{
+  struct aiocb *list[NBLOCKS], w[3], r, f, r2;
+  struct sigevent ev;
+  struct timespec ts;
+  char c[3], got;
+  int fd, p[2], i;
+
+  notified = 0;
+  signalled = 0;
+  for (i = 0; i < (int) sizeof data; i++)
+    data[i] = 'a' + i % 23 + i / BLOCK;
+  fd = open (NAME, O_CREAT | O_TRUNC | O_RDWR, 0644);
+  CHECK (fd != -1);
+
+  setup (&r, fd, buf, 1, 0, LIO_READ);
+  if (aio_read (&r) == -1 && errno == ENOSYS)
+    {
+      printf ("no asynchronous I/O without the thread library\n");
+      exit (0);
+    }
+  wait_all ((struct aiocb *const []) { &r }, 1);
+  CHECK (aio_error (&r) == 0 && aio_return (&r) == 0);
+
+  /* Write all blocks at once, in reverse, and read them back.  */
+  for (i = 0; i < NBLOCKS; i++)
+    {
+      list[i] = &cb[i];
+      setup (&cb[i], fd, data + (NBLOCKS - 1 - i) * BLOCK, BLOCK,
+	     (NBLOCKS - 1 - i) * BLOCK, LIO_WRITE);
+    }
+  CHECK (lio_listio (LIO_WAIT, list, NBLOCKS, NULL) == 0);
+  for (i = 0; i < NBLOCKS; i++)
+    CHECK (aio_error (&cb[i]) == 0 && aio_return (&cb[i]) == BLOCK);
+  for (i = 0; i < NBLOCKS; i++)
+    {
+      setup (&cb[i], fd, buf + i * BLOCK, BLOCK, i * BLOCK, LIO_READ);
+      CHECK (aio_read (&cb[i]) == 0);
+    }
+  wait_all (list, NBLOCKS);
+  for (i = 0; i < NBLOCKS; i++)
+    CHECK (aio_return (&cb[i]) == BLOCK);
+  CHECK (memcmp (buf, data, sizeof data) == 0);
+
+  /* Writes to one place land in order, a read queued after them sees
+     the last, and a sync comes after all of them.  */
+  for (i = 0; i < 3; i++)
+    {
+      c[i] = 'x' + i;
+      setup (&w[i], fd, &c[i], 1, 5, LIO_WRITE);
+      CHECK (aio_write (&w[i]) == 0);
+    }
+  setup (&r, fd, &got, 1, 5, LIO_READ);
+  CHECK (aio_read (&r) == 0);
+  setup (&f, fd, NULL, 0, 0, LIO_NOP);
+  CHECK (aio_fsync (O_SYNC, &f) == 0);
+  wait_all ((struct aiocb *const []) { &f }, 1);
+  CHECK (aio_error (&f) == 0);
+  for (i = 0; i < 3; i++)
+    CHECK (aio_error (&w[i]) == 0);
+  CHECK (aio_error (&r) == 0 && aio_return (&r) == 1 && got == 'z');
+
+  /* Failures are reported per request.  */
+  setup (&r, -1, buf, 1, 0, LIO_READ);
+  CHECK (aio_read (&r) == 0);
+  wait_all ((struct aiocb *const []) { &r }, 1);
+  CHECK (aio_error (&r) == EBADF && aio_return (&r) == -1);
+  setup (&r, fd, buf, 1, 0, LIO_READ);
+  r.aio_reqprio = -1;
+  CHECK (aio_read (&r) == -1 && errno == EINVAL);
+
+  /* Notification on a new thread, for a request and a whole batch.  */
+  setup (&r, fd, buf, BLOCK, 0, LIO_READ);
+  r.aio_sigevent.sigev_notify = SIGEV_THREAD;
+  r.aio_sigevent.sigev_notify_function = count;
+  r.aio_sigevent.sigev_value.sival_int = 1;
+  CHECK (aio_read (&r) == 0);
+  wait_notified (1);
+  CHECK (aio_return (&r) == BLOCK);
+  for (i = 0; i < 8; i++)
+    setup (&cb[i], fd, buf + i * BLOCK, BLOCK, i * BLOCK, LIO_READ);
+  memset (&ev, 0, sizeof ev);
+  ev.sigev_notify = SIGEV_THREAD;
+  ev.sigev_notify_function = count;
+  ev.sigev_value.sival_int = 100;
+  CHECK (lio_listio (LIO_NOWAIT, list, 8, &ev) == 0);
+  wait_notified (101);
+  for (i = 0; i < 8; i++)
+    CHECK (aio_error (&cb[i]) == 0 && aio_return (&cb[i]) == BLOCK);
+
+  /* Notification by signal.  */
+  signal (SIGUSR1, handler);
+  setup (&r, fd, buf, BLOCK, 0, LIO_READ);
+  r.aio_sigevent.sigev_notify = SIGEV_SIGNAL;
+  r.aio_sigevent.sigev_signo = SIGUSR1;
+  sigcb = &r;
+  CHECK (aio_read (&r) == 0);
+  for (i = 0; i < 1000 && !signalled; i++)
+    usleep (1000);
+  CHECK (signalled == 1 && aio_return (&r) == BLOCK);
+  CHECK (sigerr == 0 && sigret == BLOCK);
+  sigcb = NULL;
+
+  /* A read from an empty pipe keeps a worker busy; a sync behind it
+     and a read behind that one have not started, and can be taken
+     back.  */
+  CHECK (pipe (p) == 0);
+  setup (&r, p[0], &got, 1, 0, LIO_READ);
+  CHECK (aio_read (&r) == 0);
+  setup (&f, p[0], NULL, 0, 0, LIO_NOP);
+  CHECK (aio_fsync (O_SYNC, &f) == 0);
+  setup (&r2, p[0], buf, 1, 0, LIO_READ);
+  CHECK (aio_read (&r2) == 0);
+  ts.tv_sec = 0;
+  ts.tv_nsec = 10000000;
+  CHECK (aio_suspend ((const struct aiocb *const []) { &r }, 1, &ts) == -1
+	 && errno == EAGAIN);
+  CHECK (aio_cancel (p[0], &r2) == AIO_CANCELED);
+  CHECK (aio_error (&r2) == ECANCELED && aio_return (&r2) == -1);
+  CHECK (aio_cancel (p[0], NULL) == AIO_NOTCANCELED);
+  CHECK (aio_error (&f) == ECANCELED);
+  CHECK (aio_error (&r) == EINPROGRESS);
+  CHECK (write (p[1], "!", 1) == 1);
+  wait_all ((struct aiocb *const []) { &r }, 1);
+  CHECK (aio_return (&r) == 1 && got == '!');
+  CHECK (aio_cancel (p[0], NULL) == AIO_ALLDONE);
+
+  close (p[0]);
+  close (p[1]);
+  close (fd);
+  unlink (NAME);
+}
+
+int
+main (void)
+{
+  use (AIO_ENGINE_THREADS);
+  run ();
+  use (AIO_ENGINE_URING);
+  run ();
+  exit (0);
+}
+#endif
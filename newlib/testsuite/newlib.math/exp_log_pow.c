@@ -0,0 +1,357 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for exp(), exp2(), log(), log2() and pow() and their
+ * float versions: values known to 1 ulp, exact cases, the results and
+ * errno of the special cases, and for a stride of floats the float
+ * functions against the double ones rounded to float.
+ *
+ * Built with -DBENCH it instead prints the throughput of each function,
+ * on independent arguments, and its latency, with each call waiting
+ * for the result of the one before.
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* A random double in [lo, hi).  */
+static double
+random_range(double lo, double hi)
+{
+
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (lo + (hi - lo) * (double)(seed >> 11) * 0x1p-53);
+}
+
+#ifdef BENCH
+#define NUMBERS	4096
+#define ROUNDS	200
+
+static double in[NUMBERS], in2[NUMBERS];
+static float inf_[NUMBERS], inf2[NUMBERS];
+static volatile double dsink;
+static volatile float fsink;
+
+static double
+elapsed(const struct timespec *t0, const struct timespec *t1)
+{
+
+	return ((t1->tv_sec - t0->tv_sec) * 1e9 +
+	    (t1->tv_nsec - t0->tv_nsec)) / ((double)NUMBERS * ROUNDS);
+}
+
+/*
+ * The latency loops feed each result back in multiplied by zero, which
+ * the compiler cannot drop since the result might be inf or nan.
+ */
+#define	BENCH1(name, f, type, a)					\
+	do {								\
+		struct timespec t0, t1, t2;				\
+		type s = 0, y = 0;					\
+		int i, j;						\
+									\
+		clock_gettime(CLOCK_MONOTONIC, &t0);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			for (i = 0; i < NUMBERS; i++)			\
+				s += f(a[i]);				\
+		clock_gettime(CLOCK_MONOTONIC, &t1);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			for (i = 0; i < NUMBERS; i++)			\
+				y = f(a[i] + y * 0);			\
+		clock_gettime(CLOCK_MONOTONIC, &t2);			\
+		printf("%-6s %8.2f ns/call throughput %8.2f ns/call "	\
+		    "latency\n", name, elapsed(&t0, &t1),		\
+		    elapsed(&t1, &t2));					\
+		sink(s + y);						\
+	} while (0)
+
+#define	BENCH2(name, f, type, a, b)					\
+	do {								\
+		struct timespec t0, t1, t2;				\
+		type s = 0, y = 0;					\
+		int i, j;						\
+									\
+		clock_gettime(CLOCK_MONOTONIC, &t0);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			for (i = 0; i < NUMBERS; i++)			\
+				s += f(a[i], b[i]);			\
+		clock_gettime(CLOCK_MONOTONIC, &t1);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			for (i = 0; i < NUMBERS; i++)			\
+				y = f(a[i] + y * 0, b[i]);		\
+		clock_gettime(CLOCK_MONOTONIC, &t2);			\
+		printf("%-6s %8.2f ns/call throughput %8.2f ns/call "	\
+		    "latency\n", name, elapsed(&t0, &t1),		\
+		    elapsed(&t1, &t2));					\
+		sink(s + y);						\
+	} while (0)
+
+#define	sink(v)	(sizeof(v) == sizeof(float) ? (void)(fsink = (v)) :	\
+	    (void)(dsink = (v)))
+
+int
+main(void)
+{
+	int i;
+
+	for (i = 0; i < NUMBERS; i++)
+		in[i] = random_range(-700, 700);
+	BENCH1("exp", exp, double, in);
+	BENCH1("exp2", exp2, double, in);
+	for (i = 0; i < NUMBERS; i++)
+		in[i] = random_range(0x1p-10, 0x1p10);
+	BENCH1("log", log, double, in);
+	BENCH1("log2", log2, double, in);
+	for (i = 0; i < NUMBERS; i++) {
+		in[i] = random_range(0.5, 2);
+		in2[i] = random_range(-100, 100);
+	}
+	BENCH2("pow", pow, double, in, in2);
+
+	for (i = 0; i < NUMBERS; i++)
+		inf_[i] = random_range(-87, 88);
+	BENCH1("expf", expf, float, inf_);
+	BENCH1("exp2f", exp2f, float, inf_);
+	for (i = 0; i < NUMBERS; i++)
+		inf_[i] = random_range(0x1p-10, 0x1p10);
+	BENCH1("logf", logf, float, inf_);
+	BENCH1("log2f", log2f, float, inf_);
+	for (i = 0; i < NUMBERS; i++) {
+		inf_[i] = random_range(0.5, 2);
+		inf2[i] = random_range(-100, 100);
+	}
+	BENCH2("powf", powf, float, inf_, inf2);
+	return 0;
+}
+#else
+/* Whether y is want or one of its neighbours.  */
+static int
+near(double y, double want)
+{
+
+	return (y == want || y == nextafter(want, INFINITY) ||
+	    y == nextafter(want, -INFINITY));
+}
+
+static int
+nearf(float y, float want)
+{
+
+	return (y == want || y == nextafterf(want, INFINITY) ||
+	    y == nextafterf(want, -INFINITY));
+}
+
+/* exp(x) and exp2(x), correctly rounded.  */
+static const struct {
+	double x, exp, exp2;
+} exps[] = {
+	{ 0x1p+0, 0x1.5bf0a8b145769p+1, 0x1p+1 },
+	{ -0x1p+0, 0x1.78b56362cef38p-2, 0x1p-1 },
+	{ 0x1p-1, 0x1.a61298e1e069cp+0, 0x1.6a09e667f3bcdp+0 },
+	{ 0x1.62e42fefa39efp-1, 0x1p+1, 0x1.9de70ac53b8aap+0 },
+	{ 0x1.4p+3, 0x1.5829dcf95056p+14, 0x1p+10 },
+	{ -0x1.4p+3, 0x1.7cd79b5647c9bp-15, 0x1p-10 },
+	{ 0x1.9p+6, 0x1.3494a9b171bf5p+144, 0x1p+100 },
+	{ -0x1.9p+6, 0x1.a8c1f14e2af5dp-145, 0x1p-100 },
+	{ 0x1.5ep+9, 0x1.d945df4f8ec8ep+1009, 0x1p+700 },
+	{ -0x1.5ep+9, 0x1.14f2b0fb9307fp-1010, 0x1p-700 },
+	{ 0x1p-30, 0x1.00000004p+0, 0x1.00000002c5c86p+0 },
+	{ -0x1p-30, 0x1.fffffff8p-1, 0x1.fffffffa746f4p-1 },
+	{ 0x1.62cp+9, 0x1.81e9b4b52d0c9p+1023, 0x1.6a09e667f3bcdp+709 },
+	{ -0x1.72p+9, 0x0.0000000000055p-1022, 0x1p-740 },
+};
+
+/* log(x) and log2(x), correctly rounded.  */
+static const struct {
+	double x, log, log2;
+} logs[] = {
+	{ 0x1p+1, 0x1.62e42fefa39efp-1, 0x1p+0 },
+	{ 0x1p-1, -0x1.62e42fefa39efp-1, -0x1p+0 },
+	{ 0x1.4p+3, 0x1.26bb1bbb55516p+1, 0x1.a934f0979a371p+1 },
+	{ 0x1.0000000000001p+0, 0x1.fffffffffffffp-53, 0x1.71547652b82fdp-52 },
+	{ 0x1.fffffffffffffp-1, -0x1p-53, -0x1.71547652b82fep-53 },
+	{ 0x1.199999999999ap+0, 0x1.8663f793c46ccp-4, 0x1.199b728cb9d0cp-3 },
+	{ 0x1.ccccccccccccdp-1, -0x1.af8e8210a415cp-4, -0x1.374d65d9e608dp-3 },
+	{ 0x1.56e1fc2f8f359p-997, -0x1.5963447f87fb5p+9,
+	    -0x1.f24a09f1a8b89p+9 },
+	{ 0x1.7e43c8800759cp+996, 0x1.5963447f87fb5p+9, 0x1.f24a09f1a8b89p+9 },
+	{ 0x0.0000000000001p-1022, -0x1.74385446d71c3p+9, -0x1.0c8p+10 },
+	{ 0x1.fffffffffffffp+1023, 0x1.62e42fefa39efp+9, 0x1p+10 },
+	{ 0x1.8p+1, 0x1.193ea7aad030bp+0, 0x1.95c01a39fbd68p+0 },
+	{ 0x1.8p-1000, -0x1.5a5ef0882c4a1p+9, -0x1.f3b51ff2e3021p+9 },
+};
+
+/* pow(x, y), correctly rounded.  */
+static const struct {
+	double x, y, pow;
+} pows[] = {
+	{ 0x1p+1, 0x1p-1, 0x1.6a09e667f3bcdp+0 },
+	{ 0x1.4p+3, -0x1.8p+1, 0x1.0624dd2f1a9fcp-10 },
+	{ 0x1.000001ad7f29bp+0, 0x1.dcd65p+29, 0x1.349445c228792p+144 },
+	{ 0x1p-1, 0x1.0cap+10, 0x0.0000000000001p-1022 },
+	{ 0x1.8p+1, 0x1.9p+7, 0x1.fd5863c3eb047p+316 },
+	{ -0x1.8p+1, 0x1.92p+7, -0x1.7e024ad2f0435p+318 },
+	{ 0x1.8p+0, -0x1.f4p+9, 0x1.06bdc6f923b3bp-585 },
+	{ 0x1.fffffffffffffp-1, 0x1p+60, 0x1.42eb9f39afae3p-185 },
+	{ 0x1.cp+2, 0x1.5555555555555p-2, 0x1.e9b5dba58189dp+0 },
+	{ -0x1p-1, -0x1.6p+3, -0x1p+11 },
+};
+
+int
+main(void)
+{
+	union {
+		float f;
+		unsigned int u;
+	} x;
+	double d;
+	float f;
+	int i;
+
+	for (i = 0; i < sizeof exps / sizeof exps[0]; i++) {
+		TEST(near(exp(exps[i].x), exps[i].exp));
+		TEST(near(exp2(exps[i].x), exps[i].exp2));
+	}
+	for (i = 0; i < sizeof logs / sizeof logs[0]; i++) {
+		TEST(near(log(logs[i].x), logs[i].log));
+		TEST(near(log2(logs[i].x), logs[i].log2));
+	}
+	for (i = 0; i < sizeof pows / sizeof pows[0]; i++)
+		TEST(near(pow(pows[i].x, pows[i].y), pows[i].pow));
+
+	/*
+	 * Exact cases.  With __OBSOLETE_MATH log2() is log()/ln2, which
+	 * need not be exact.
+	 */
+	for (i = -1074; i < 1024; i++) {
+		d = ldexp(1, i);
+		TEST(exp2(i) == d);
+		TEST(pow(2, i) == d);
+#if !__OBSOLETE_MATH
+		TEST(log2(d) == i);
+#endif
+		if (i >= -149 && i < 128) {
+			f = ldexpf(1, i);
+			TEST(exp2f(i) == f);
+			TEST(powf(2, i) == f);
+#if !__OBSOLETE_MATH
+			TEST(log2f(f) == i);
+#endif
+		}
+	}
+	TEST(exp(0) == 1 && exp(-0.0) == 1 && log(1) == 0);
+	TEST(expf(0) == 1 && logf(1) == 0 && log2f(1) == 0);
+	TEST(pow(-3, 3) == -27 && pow(4, 0.5) == 2 && pow(-8, -1) == -0.125);
+	TEST(powf(-3, 3) == -27 && powf(4, 0.5) == 2);
+	for (i = 1; i < 1000; i++)
+		TEST(pow(i, 2) == (double)i * i && pow(i, 3) == (double)i * i * i);
+
+	/* Special cases and errno.  */
+	TEST(exp(INFINITY) == INFINITY && exp(-INFINITY) == 0);
+	TEST(isnan(exp(NAN)) && isnan(exp2(NAN)) && isnan(expf(NAN)));
+	TEST(exp2(INFINITY) == INFINITY && exp2(-INFINITY) == 0);
+	TEST(log(INFINITY) == INFINITY && log2(INFINITY) == INFINITY);
+	TEST(isnan(log(NAN)) && isnan(log2(NAN)) && isnan(logf(NAN)));
+	TEST(pow(NAN, 0) == 1 && pow(1, NAN) == 1 && isnan(pow(NAN, 1)));
+	TEST(pow(-1, INFINITY) == 1 && pow(0.5, INFINITY) == 0);
+	TEST(pow(2, -INFINITY) == 0 && pow(-INFINITY, 3) == -INFINITY);
+	TEST(signbit(pow(-0.0, 3)) && !signbit(pow(-0.0, 2)));
+	TEST(pow(0x1p-600, 0x1p-70) == 1 && powf(2, 0x1p-30f) == 1);
+
+	errno = 0;
+	TEST(exp(1000) == HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(exp(-1000) == 0 && errno == ERANGE);
+	errno = 0;
+	TEST(exp2(1024) == HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(exp2(-1080) == 0 && errno == ERANGE);
+	errno = 0;
+	TEST(log(0) == -HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(isnan(log(-1)) && errno == EDOM);
+	errno = 0;
+	TEST(log2(-0.0) == -HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(isnan(log2(-0x1p-1074)) && errno == EDOM);
+	errno = 0;
+	TEST(pow(10, 400) == HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(pow(-10, 401) == -HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(pow(10, -400) == 0 && errno == ERANGE);
+	errno = 0;
+	TEST(isnan(pow(-2, 0.5)) && errno == EDOM);
+	errno = 0;
+	TEST(expf(89) == HUGE_VALF && errno == ERANGE);
+	errno = 0;
+	TEST(expf(-104) == 0 && errno == ERANGE);
+	errno = 0;
+	TEST(exp2f(128) == HUGE_VALF && errno == ERANGE);
+	errno = 0;
+	TEST(logf(0) == -HUGE_VALF && errno == ERANGE);
+	errno = 0;
+	TEST(isnan(log2f(-1)) && errno == EDOM);
+	errno = 0;
+	TEST(powf(10, 39) == HUGE_VALF && errno == ERANGE);
+	errno = 0;
+	TEST(isnan(powf(-2, 0.5f)) && errno == EDOM);
+	errno = 0;
+	TEST(exp(709.5) < HUGE_VAL && exp(-740) > 0 && expf(88.7f) < HUGE_VALF);
+	TEST(log(DBL_MIN) < 0 && pow(2, 0.5) > 1 && errno == 0);
+
+	/* Float against double, which is as good as correctly rounded.  */
+	for (x.u = 0; x.u < 0x7f800000; x.u += 0x3fff) {
+		f = x.f;
+		if (f < 88.7f)
+			TEST(nearf(expf(f), (float)exp(f)));
+		if (f < 128)
+			TEST(nearf(exp2f(f), (float)exp2(f)));
+		if (f < 103.9f)
+			TEST(nearf(expf(-f), (float)exp(-f)));
+		if (f < 149)
+			TEST(nearf(exp2f(-f), (float)exp2(-f)));
+		if (f != 0) {
+			TEST(nearf(logf(f), (float)log(f)));
+			TEST(nearf(log2f(f), (float)log2(f)));
+		}
+	}
+#if !__OBSOLETE_MATH
+	/* The older powf() can be several ulp out for larger y.  */
+	for (i = 0; i < 100000; i++) {
+		f = random_range(0, 4);
+		x.f = random_range(-40, 40);
+		TEST(nearf(powf(f, x.f), (float)pow(f, x.f)));
+		f = -(float)(int)random_range(1, 30);
+		x.f = (int)random_range(-20, 20);
+		TEST(nearf(powf(f, x.f), (float)pow(f, x.f)));
+	}
+#endif
+	return 0;
+}
+#endif
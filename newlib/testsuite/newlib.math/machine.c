@@ -0,0 +1,443 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for the functions that libm/machine directories provide
+ * with single instructions: floor(), ceil(), trunc(), round(), rint(),
+ * nearbyint(), lrint(), llrint(), fmin(), fmax(), sqrt() and fma(), and
+ * their float versions.  The rounding functions are checked against
+ * plain C versions here on special values and random ones, fma() on
+ * products whose low half it must not lose, and sqrt() on squares.
+ *
+ * Built with -DBENCH it instead prints the throughput of each function
+ * next to that of the plain C version.
+ */
+
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* A random double in [lo, hi).  */
+static double
+random_range(double lo, double hi)
+{
+
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (lo + (hi - lo) * (double)(seed >> 11) * 0x1p-53);
+}
+
+/*
+ * The plain C versions, for the default rounding mode.  Every double
+ * of magnitude 2^52 or more is an integer already.
+ */
+static double
+ref_trunc(double x)
+{
+
+	if (!(fabs(x) < 0x1p52))
+		return (x);
+	return (copysign((double)(long long)x, x));
+}
+
+static double
+ref_floor(double x)
+{
+	double t = ref_trunc(x);
+
+	return (t > x ? t - 1 : t);
+}
+
+static double
+ref_ceil(double x)
+{
+	double t = ref_trunc(x);
+
+	return (t < x ? t + 1 : t);
+}
+
+static double
+ref_round(double x)
+{
+	double t = ref_trunc(x);
+
+	return (fabs(x - t) >= 0.5 ? t + copysign(1, x) : t);
+}
+
+static double
+ref_rint(double x)
+{
+	double t = ref_trunc(x), d = fabs(x - t);
+
+	if (d > 0.5 || (d == 0.5 && ((long long)t & 1) != 0))
+		t += copysign(1, x);
+	return (t);
+}
+
+static double
+ref_fmin(double x, double y)
+{
+
+	if (isnan(x))
+		return (y);
+	if (isnan(y))
+		return (x);
+	return (x < y ? x : y);
+}
+
+static double
+ref_fmax(double x, double y)
+{
+
+	if (isnan(x))
+		return (y);
+	if (isnan(y))
+		return (x);
+	return (x > y ? x : y);
+}
+
+/* Floats are doubles here, and their results come back exactly.  */
+static float ref_truncf(float x) { return (ref_trunc(x)); }
+static float ref_floorf(float x) { return (ref_floor(x)); }
+static float ref_ceilf(float x) { return (ref_ceil(x)); }
+static float ref_roundf(float x) { return (ref_round(x)); }
+static float ref_rintf(float x) { return (ref_rint(x)); }
+static float ref_fminf(float x, float y) { return (ref_fmin(x, y)); }
+static float ref_fmaxf(float x, float y) { return (ref_fmax(x, y)); }
+
+/*
+ * Called through these, so that the compiler cannot put its own
+ * version of a function in place of the library's.
+ */
+static struct {
+	const char *name;
+	double (*f)(double);
+	double (*ref)(double);
+} d1[] = {
+	{ "floor", floor, ref_floor },
+	{ "ceil", ceil, ref_ceil },
+	{ "trunc", trunc, ref_trunc },
+	{ "round", round, ref_round },
+	{ "rint", rint, ref_rint },
+	{ "nearbyint", nearbyint, ref_rint },
+};
+
+static struct {
+	const char *name;
+	float (*f)(float);
+	float (*ref)(float);
+} f1[] = {
+	{ "floorf", floorf, ref_floorf },
+	{ "ceilf", ceilf, ref_ceilf },
+	{ "truncf", truncf, ref_truncf },
+	{ "roundf", roundf, ref_roundf },
+	{ "rintf", rintf, ref_rintf },
+	{ "nearbyintf", nearbyintf, ref_rintf },
+};
+
+static struct {
+	const char *name;
+	double (*f)(double, double);
+	double (*ref)(double, double);
+} d2[] = {
+	{ "fmin", fmin, ref_fmin },
+	{ "fmax", fmax, ref_fmax },
+};
+
+static struct {
+	const char *name;
+	float (*f)(float, float);
+	float (*ref)(float, float);
+} f2[] = {
+	{ "fminf", fminf, ref_fminf },
+	{ "fmaxf", fmaxf, ref_fmaxf },
+};
+
+#define	N(a)	(sizeof(a) / sizeof((a)[0]))
+
+#ifdef BENCH
+#define NUMBERS	4096
+#define ROUNDS	500
+
+static double in[NUMBERS], in2[NUMBERS], in3[NUMBERS];
+static float inf_[NUMBERS], inf2[NUMBERS], inf3[NUMBERS];
+static volatile double dsink;
+
+static double
+elapsed(const struct timespec *t0, const struct timespec *t1)
+{
+
+	return ((t1->tv_sec - t0->tv_sec) * 1e9 +
+	    (t1->tv_nsec - t0->tv_nsec)) / ((double)NUMBERS * ROUNDS);
+}
+
+/* The time per call of the expression e, in which i is the index.  */
+#define	TIME(e, t)							\
+	do {								\
+		struct timespec t0, t1;					\
+		double s = 0;						\
+		int i, j;						\
+									\
+		clock_gettime(CLOCK_MONOTONIC, &t0);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			for (i = 0; i < NUMBERS; i++)			\
+				s += (e);				\
+		clock_gettime(CLOCK_MONOTONIC, &t1);			\
+		dsink = s;						\
+		(t) = elapsed(&t0, &t1);				\
+	} while (0)
+
+#define	REPORT(name, t, tref)						\
+	printf("%-11s %6.2f ns/call, plain C %6.2f ns/call\n", (name),	\
+	    (t), (tref))
+
+static double
+ref_fma(double x, double y, double z)
+{
+
+	return (x * y + z);
+}
+
+static float
+ref_fmaf(float x, float y, float z)
+{
+
+	return ((double)x * y + z);
+}
+
+int
+main(void)
+{
+	double (*volatile vd1)(double), (*volatile vd2)(double, double);
+	double (*volatile vd3)(double, double, double);
+	float (*volatile vf1)(float), (*volatile vf2)(float, float);
+	float (*volatile vf3)(float, float, float);
+	long (*volatile vl)(double);
+	double t, tref;
+	unsigned int k;
+	int i;
+
+	for (i = 0; i < NUMBERS; i++) {
+		in[i] = random_range(-1000, 1000);
+		in2[i] = random_range(-1000, 1000);
+		in3[i] = random_range(-1000, 1000);
+		inf_[i] = in[i];
+		inf2[i] = in2[i];
+		inf3[i] = in3[i];
+	}
+	for (k = 0; k < N(d1); k++) {
+		vd1 = d1[k].f;
+		TIME(vd1(in[i]), t);
+		vd1 = d1[k].ref;
+		TIME(vd1(in[i]), tref);
+		REPORT(d1[k].name, t, tref);
+	}
+	for (k = 0; k < N(f1); k++) {
+		vf1 = f1[k].f;
+		TIME(vf1(inf_[i]), t);
+		vf1 = f1[k].ref;
+		TIME(vf1(inf_[i]), tref);
+		REPORT(f1[k].name, t, tref);
+	}
+	vl = lrint;
+	TIME(vl(in[i]), t);
+	vd1 = ref_rint;
+	TIME((long)vd1(in[i]), tref);
+	REPORT("lrint", t, tref);
+	for (k = 0; k < N(d2); k++) {
+		vd2 = d2[k].f;
+		TIME(vd2(in[i], in2[i]), t);
+		vd2 = d2[k].ref;
+		TIME(vd2(in[i], in2[i]), tref);
+		REPORT(d2[k].name, t, tref);
+	}
+	for (k = 0; k < N(f2); k++) {
+		vf2 = f2[k].f;
+		TIME(vf2(inf_[i], inf2[i]), t);
+		vf2 = f2[k].ref;
+		TIME(vf2(inf_[i], inf2[i]), tref);
+		REPORT(f2[k].name, t, tref);
+	}
+	/* The generic fma() is x * y + z, rounded twice.  */
+	vd3 = fma;
+	TIME(vd3(in[i], in2[i], in3[i]), t);
+	vd3 = ref_fma;
+	TIME(vd3(in[i], in2[i], in3[i]), tref);
+	REPORT("fma", t, tref);
+	vf3 = fmaf;
+	TIME(vf3(inf_[i], inf2[i], inf3[i]), t);
+	vf3 = ref_fmaf;
+	TIME(vf3(inf_[i], inf2[i], inf3[i]), tref);
+	REPORT("fmaf", t, tref);
+	for (i = 0; i < NUMBERS; i++)
+		in[i] = fabs(in[i]);
+	vd1 = sqrt;
+	TIME(vd1(in[i]), t);
+	printf("%-11s %6.2f ns/call\n", "sqrt", t);
+	return 0;
+}
+#else
+/* Whether x and y are the same, zeros by sign and NaNs all alike.  */
+static int
+same(double x, double y)
+{
+
+	if (isnan(x) || isnan(y))
+		return (isnan(x) && isnan(y));
+	return (x == y && signbit(x) == signbit(y));
+}
+
+static const double specials[] = {
+	0.0, 0.5, 1.0, 1.5, 2.5, 0x1.fffffffffffffp-2, 0x1.0000000000001p-1,
+	0x1p-1074, 0x1p-1022, 0x1.fffffffffffffp51, 0x1p52 - 0.5, 0x1p52,
+	0x1p52 + 1, 0x1p53, 0x1.fffffffffffffp1023, 8388607.5, 8388608.5,
+	16777215.0, INFINITY, NAN,
+};
+
+static void
+check1(double x)
+{
+	unsigned int k;
+
+	for (k = 0; k < N(d1); k++)
+		TEST(same(d1[k].f(x), d1[k].ref(x)));
+	for (k = 0; k < N(f1); k++)
+		TEST(same(f1[k].f(x), f1[k].ref(x)));
+	if (fabs(x) < 0x1p62)
+		TEST(lrint(x) == (long long)ref_rint(x) &&
+		    llrint(x) == (long long)ref_rint(x));
+	if (fabs(x) < 0x1p30)
+		TEST(lrintf(x) == (long long)ref_rint((float)x) &&
+		    llrintf(x) == (long long)ref_rint((float)x));
+}
+
+#ifdef __x86_64__
+/*
+ * Whether a function raised invalid.  newlib has no fenv.h for x86_64,
+ * so the flag is read from the MXCSR, where the SSE code raises it.
+ */
+static int
+raises_invalid(double (*f)(double), float (*ff)(float), double x)
+{
+	double (*volatile vf)(double) = f;
+	float (*volatile vff)(float) = ff;
+	unsigned int csr;
+
+	__builtin_ia32_ldmxcsr(__builtin_ia32_stmxcsr() & ~0x3fU);
+	(void)vf(x);
+	(void)vff(x);
+	csr = __builtin_ia32_stmxcsr();
+	return ((csr & 1) != 0);
+}
+#endif
+
+/* Which of 0 and -0 fmin() and fmax() give for the two is unspecified. */
+static int
+same_or_zero(double x, double y)
+{
+
+	return (same(x, y) || (x == 0 && y == 0));
+}
+
+static void
+check2(double x, double y)
+{
+	unsigned int k;
+
+	for (k = 0; k < N(d2); k++)
+		TEST(same_or_zero(d2[k].f(x, y), d2[k].ref(x, y)));
+	for (k = 0; k < N(f2); k++)
+		TEST(same_or_zero(f2[k].f(x, y), f2[k].ref(x, y)));
+}
+
+int
+main(void)
+{
+	double (*volatile vsqrt)(double) = sqrt;
+	float (*volatile vsqrtf)(float) = sqrtf;
+	double (*volatile vfma)(double, double, double) = fma;
+	float (*volatile vfmaf)(float, float, float) = fmaf;
+	double x, y, a, b;
+	unsigned int i, j;
+
+	for (i = 0; i < N(specials); i++) {
+		check1(specials[i]);
+		check1(-specials[i]);
+		for (j = 0; j < N(specials); j++) {
+			check2(specials[i], specials[j]);
+			check2(-specials[i], specials[j]);
+			check2(specials[i], -specials[j]);
+		}
+	}
+	for (i = 0; i < 100000; i++) {
+		check1(random_range(-4, 4));
+		check1(random_range(-0x1p54, 0x1p54));
+		/* Halfway cases.  */
+		check1(floor(random_range(-1e6, 1e6)) + 0.5);
+		check2(random_range(-4, 4), random_range(-4, 4));
+	}
+
+	/* sqrt() of squares is exact, and of everything correctly rounded. */
+	for (i = 0; i < 100000; i++) {
+		x = floor(random_range(0, 0x1p26));
+		TEST(vsqrt(x * x) == x);
+		x = floor(random_range(0, 0x1p12));
+		TEST(vsqrtf(x * x) == x);
+		x = random_range(0, 1e6);
+		TEST(vsqrtf(x) == (float)vsqrt((float)x));
+	}
+	TEST(vsqrt(2) == 0x1.6a09e667f3bcdp+0);
+	TEST(vsqrtf(2) == 0x1.6a09e6p+0f);
+	TEST(same(vsqrt(-0.0), -0.0) && vsqrt(INFINITY) == INFINITY);
+	TEST(isnan(vsqrt(-1)) && isnan(vsqrtf(-1)) && isnan(vsqrt(NAN)));
+
+	/*
+	 * (1 + a 2^-27)(1 + b 2^-27) - (1 + (a + b) 2^-27) is a b 2^-54,
+	 * which x * y + z rounds away.  Likewise for floats with 2^-12.
+	 */
+	for (i = 0; i < 100000; i++) {
+		a = floor(random_range(1, 0x1p26));
+		b = floor(random_range(1, 0x1p26));
+		x = 1 + a * 0x1p-27;
+		y = 1 + b * 0x1p-27;
+		TEST(vfma(x, y, -(1 + (a + b) * 0x1p-27)) == a * b * 0x1p-54);
+		TEST(vfma(-x, y, 1 + (a + b) * 0x1p-27) == -a * b * 0x1p-54);
+		a = floor(random_range(1, 0x1p11));
+		b = floor(random_range(1, 0x1p11));
+		TEST(vfmaf(1 + a * 0x1p-12, 1 + b * 0x1p-12,
+		    -(1 + (a + b) * 0x1p-12)) == (float)(a * b * 0x1p-24));
+	}
+	TEST(vfma(2, 3, 4) == 10 && vfmaf(2, 3, 4) == 10);
+	TEST(vfma(0x1p1023, 2, -INFINITY) == -INFINITY);
+	TEST(isnan(vfma(INFINITY, 0, 1)) && isnan(vfmaf(NAN, 1, 1)));
+
+#ifdef __x86_64__
+	/* round() is exact and never invalid, on infinities and NaNs too. */
+	TEST(!raises_invalid(round, roundf, INFINITY));
+	TEST(!raises_invalid(round, roundf, -INFINITY));
+	TEST(!raises_invalid(round, roundf, NAN));
+	TEST(!raises_invalid(round, roundf, 0x1p60));
+	TEST(!raises_invalid(round, roundf, -2.5));
+#endif
+	return 0;
+}
+#endif
@@ -0,0 +1,298 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for sin(), cos() and sincos() and their float versions:
+ * values known to 1 ulp, sincos() against sin() and cos() over every
+ * range of the argument reduction, the special cases, and for a stride
+ * of floats the float functions against the double ones rounded to
+ * float.
+ *
+ * Built with -DBENCH it instead prints the throughput and latency of
+ * each function, and of sincos() against a call of sin() and one of
+ * cos().
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* A random double in [lo, hi).  */
+static double
+random_range(double lo, double hi)
+{
+
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (lo + (hi - lo) * (double)(seed >> 11) * 0x1p-53);
+}
+
+#ifdef BENCH
+#define NUMBERS	4096
+#define ROUNDS	200
+
+static double in[NUMBERS];
+static float inf_[NUMBERS];
+static volatile double dsink;
+static volatile float fsink;
+
+static double
+elapsed(const struct timespec *t0, const struct timespec *t1)
+{
+
+	return ((t1->tv_sec - t0->tv_sec) * 1e9 +
+	    (t1->tv_nsec - t0->tv_nsec)) / ((double)NUMBERS * ROUNDS);
+}
+
+/*
+ * The latency loops feed each result back in multiplied by zero, which
+ * the compiler cannot drop since the result might be inf or nan.
+ */
+#define	BENCH1(name, f, type, a)					\
+	do {								\
+		struct timespec t0, t1, t2;				\
+		type s = 0, y = 0;					\
+		int i, j;						\
+									\
+		clock_gettime(CLOCK_MONOTONIC, &t0);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			for (i = 0; i < NUMBERS; i++)			\
+				s += f(a[i]);				\
+		clock_gettime(CLOCK_MONOTONIC, &t1);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			for (i = 0; i < NUMBERS; i++)			\
+				y = f(a[i] + y * 0);			\
+		clock_gettime(CLOCK_MONOTONIC, &t2);			\
+		printf("%-8s %8.2f ns/call throughput %8.2f ns/call "	\
+		    "latency\n", name, elapsed(&t0, &t1),		\
+		    elapsed(&t1, &t2));					\
+		sink(s + y);						\
+	} while (0)
+
+#define	sink(v)	(sizeof(v) == sizeof(float) ? (void)(fsink = (v)) :	\
+	    (void)(dsink = (v)))
+
+static double
+sincos_sum(double x)
+{
+	double s, c;
+
+	sincos(x, &s, &c);
+	return (s + c);
+}
+
+static double
+sin_cos_sum(double x)
+{
+
+	return (sin(x) + cos(x));
+}
+
+static float
+sincosf_sum(float x)
+{
+	float s, c;
+
+	sincosf(x, &s, &c);
+	return (s + c);
+}
+
+static float
+sinf_cosf_sum(float x)
+{
+
+	return (sinf(x) + cosf(x));
+}
+
+static void
+bench(double lo, double hi)
+{
+	int i;
+
+	printf("|x| < %g\n", hi);
+	for (i = 0; i < NUMBERS; i++) {
+		in[i] = random_range(lo, hi);
+		inf_[i] = in[i];
+	}
+	BENCH1("sin", sin, double, in);
+	BENCH1("cos", cos, double, in);
+	BENCH1("sincos", sincos_sum, double, in);
+	BENCH1("sin+cos", sin_cos_sum, double, in);
+	BENCH1("sinf", sinf, float, inf_);
+	BENCH1("cosf", cosf, float, inf_);
+	BENCH1("sincosf", sincosf_sum, float, inf_);
+	BENCH1("sinf+cosf", sinf_cosf_sum, float, inf_);
+}
+
+int
+main(void)
+{
+
+	bench(-0.78, 0.78);
+	bench(-100, 100);
+	bench(-1e6, 1e6);
+	bench(-1e30, 1e30);
+	return 0;
+}
+#else
+/* Whether y is want or one of its neighbours.  */
+static int
+near(double y, double want)
+{
+
+	return (y == want || y == nextafter(want, INFINITY) ||
+	    y == nextafter(want, -INFINITY));
+}
+
+static int
+nearf(float y, float want)
+{
+
+	return (y == want || y == nextafterf(want, INFINITY) ||
+	    y == nextafterf(want, -INFINITY));
+}
+
+/* sin(x) and cos(x), correctly rounded.  */
+static const struct {
+	double x, sin, cos;
+} trigs[] = {
+	{ 0x1p+0, 0x1.aed548f090ceep-1, 0x1.14a280fb5068cp-1 },
+	{ -0x1p-1, -0x1.eaee8744b05fp-2, 0x1.c1528065b7d5p-1 },
+	{ 0x1.921fb54442d18p-1, 0x1.6a09e667f3bccp-1, 0x1.6a09e667f3bcdp-1 },
+	{ 0x1.921fb54442d18p+0, 0x1p+0, 0x1.1a62633145c07p-54 },
+	{ 0x1.921fb54442d18p+1, 0x1.1a62633145c07p-53, -0x1p+0 },
+	{ 0x1.2d97c7f3321d2p+1, 0x1.6a09e667f3bcdp-1, -0x1.6a09e667f3bccp-1 },
+	{ 0x1.4p+3, -0x1.1689ef5f34f52p-1, -0x1.ad9ac890c6b1fp-1 },
+	{ -0x1.5p+6, -0x1.7764b8bceac8bp-1, -0x1.5c2c0a241e522p-1 },
+	{ 0x1.86ap+19, -0x1.20f02e8178612p-2, 0x1.eb31f58234b5ep-1 },
+	{ 0x1.921fb54442d18p+20, -0x1.1a62633145c07p-34, 0x1p+0 },
+	{ 0x1.5bd3bf2ep+29, 0x1.341c6bc04615dp-1, 0x1.98ea4744c704bp-1 },
+	{ 0x1.0f0cf064dd592p+73, -0x1.b453ab76bf397p-1, 0x1.0be2cef01c8f4p-1 },
+	{ 0x1.2d5p+999, -0x1.94850b10003dp-1, 0x1.39dc0af63ff8fp-1 },
+	{ 0x1.fffffffffffffp+1023, 0x1.452fc98b34e97p-8, -0x1.fffe62ecfab75p-1 },
+	{ 0x1p-30, 0x1p-30, 0x1p+0 },
+	{ 0x1.fffffffffffffp-1, 0x1.aed548f090cedp-1, 0x1.14a280fb5068cp-1 },
+};
+
+/* sinf(x) and cosf(x), correctly rounded.  */
+static const struct {
+	float x, sin, cos;
+} trigfs[] = {
+	{ 0x1p+0f, 0x1.aed548p-1f, 0x1.14a28p-1f },
+	{ -0x1p-1f, -0x1.eaee88p-2f, 0x1.c1528p-1f },
+	{ 0x1.921fb6p+0f, 0x1p+0f, -0x1.777a5cp-25f },
+	{ 0x1.921fb6p+1f, -0x1.777a5cp-24f, -0x1p+0f },
+	{ 0x1.2d97c8p+1f, 0x1.6a09e6p-1f, -0x1.6a09e6p-1f },
+	{ 0x1.4p+3f, -0x1.1689fp-1f, -0x1.ad9ac8p-1f },
+	{ 0x1.5fdbbep+23f, -0x1.32ad3cp-2f, 0x1.e87fc4p-1f },
+	{ 0x1.0f0cfp+73f, -0x1.77d988p-1f, 0x1.5badeep-1f },
+	{ 0x1p+100f, -0x1.be8edap-1f, 0x1.f4eb4p-2f },
+	{ 0x1.fffffep+127f, -0x1.0b3366p-1f, 0x1.b4bf2cp-1f },
+	{ 0x1p-20f, 0x1p-20f, 0x1p+0f },
+};
+
+/* The ends of the ranges of the argument reduction.  */
+static const double ranges[] = {
+	0x1p-27, 0x1.921fb54442d18p-1, 0x1.2d97c7f3321d2p+1,
+	0x1.921fb54442d18p+20, 0x1p+30, 0x1p+60, 0x1p+200, 0x1p+960,
+};
+
+int
+main(void)
+{
+#if !__OBSOLETE_MATH
+	union {
+		float f;
+		unsigned int u;
+	} x;
+#endif
+	double d, s, c;
+	float f, sf, cf;
+	int i, j;
+
+	for (i = 0; i < sizeof trigs / sizeof trigs[0]; i++) {
+		d = trigs[i].x;
+		TEST(near(sin(d), trigs[i].sin));
+		TEST(near(cos(d), trigs[i].cos));
+		TEST(near(sin(-d), -trigs[i].sin));
+		TEST(near(cos(-d), trigs[i].cos));
+	}
+	for (i = 0; i < sizeof trigfs / sizeof trigfs[0]; i++) {
+		f = trigfs[i].x;
+		TEST(nearf(sinf(f), trigfs[i].sin));
+		TEST(nearf(cosf(f), trigfs[i].cos));
+		TEST(nearf(sinf(-f), -trigfs[i].sin));
+		TEST(nearf(cosf(-f), trigfs[i].cos));
+	}
+
+	/* sincos() is sin() and cos(), in every range.  */
+	for (i = 0; i < sizeof ranges / sizeof ranges[0] - 1; i++)
+		for (j = 0; j < 20000; j++) {
+			d = random_range(ranges[i], ranges[i + 1]);
+			if (j & 1)
+				d = -d;
+			sincos(d, &s, &c);
+			TEST(s == sin(d) && c == cos(d));
+			if (fabs(d) > FLT_MAX)
+				continue;
+			f = d;
+			sincosf(f, &sf, &cf);
+			TEST(sf == sinf(f) && cf == cosf(f));
+		}
+
+	/* Special cases.  */
+	TEST(sin(0) == 0 && !signbit(sin(0)) && signbit(sin(-0.0)));
+	TEST(cos(0) == 1 && cos(-0.0) == 1);
+	TEST(sinf(0) == 0 && !signbit(sinf(0)) && signbit(sinf(-0.0f)));
+	TEST(cosf(0) == 1 && cosf(-0.0f) == 1);
+	TEST(sin(0x1p-600) == 0x1p-600 && cos(0x1p-600) == 1);
+	TEST(sin(DBL_MIN / 4) == DBL_MIN / 4 && sinf(FLT_MIN / 4) == FLT_MIN / 4);
+	TEST(isnan(sin(INFINITY)) && isnan(cos(-INFINITY)));
+	TEST(isnan(sinf(INFINITY)) && isnan(cosf(-INFINITY)));
+	TEST(isnan(sin(NAN)) && isnan(cos(NAN)));
+	TEST(isnan(sinf(NAN)) && isnan(cosf(NAN)));
+	sincos(INFINITY, &s, &c);
+	TEST(isnan(s) && isnan(c));
+	sincos(-0.0, &s, &c);
+	TEST(s == 0 && signbit(s) && c == 1);
+	sincosf(NAN, &sf, &cf);
+	TEST(isnan(sf) && isnan(cf));
+	sincosf(-0.0f, &sf, &cf);
+	TEST(sf == 0 && signbit(sf) && cf == 1);
+
+	/*
+	 * Float against double, which is as good as correctly rounded.
+	 * The older sinf() and cosf() can be far out near the zeros of
+	 * the result.
+	 */
+#if !__OBSOLETE_MATH
+	for (x.u = 0; x.u < 0x7f800000; x.u += 0x3fff) {
+		f = x.f;
+		TEST(nearf(sinf(f), (float)sin(f)));
+		TEST(nearf(cosf(f), (float)cos(f)));
+	}
+#endif
+	return 0;
+}
+#endif
@@ -0,0 +1,415 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for the vector versions of exp(), exp2(), log(), log2(),
+ * pow(), sin(), cos() and sincos() and of their float versions, the
+ * _ZGV* functions GCC calls from vectorized loops: each of them against
+ * the scalar function, to 1 ulp, over the ranges that take the vector
+ * code and the special cases that go back to the scalar one, for every
+ * instruction set the processor has.
+ *
+ * Built with -DBENCH it instead prints the throughput of each of them
+ * against that of the scalar function.
+ */
+
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#if (defined(__x86_64__) && !defined(__ILP32__) || defined(__aarch64__)) && \
+    !__OBSOLETE_MATH && defined(__GNUC__) && !defined(__clang__)
+
+#define	NUMBERS	4096
+
+/*
+ * A vector function applied to the first n numbers of x (and y), for a
+ * multiple n of its lanes, into r.
+ */
+typedef void vfunc(const double *, const double *, double *, int);
+typedef void vfuncf(const float *, const float *, float *, int);
+
+struct isa {
+	const char *name;
+	int (*present)(void);
+	vfunc *exp, *exp2, *log, *log2, *pow, *sin, *cos, *sincos;
+	vfuncf *expf, *exp2f, *logf, *log2f, *powf, *sinf, *cosf, *sincosf;
+};
+
+/*
+ * The functions of an instruction set with n doubles to a vector of
+ * size bytes.  sincos is tested in the form with linear pointers, with
+ * y taking the cosines.
+ */
+#define	V1(p, n, t, vt, f, attr)					\
+	extern vt p##N##n##v_##f(vt) attr;				\
+	static void ISA_TARGET						\
+	p##_##f(const t *x, const t *y, t *r, int len)			\
+	{								\
+		vt v;							\
+		int i;							\
+									\
+		(void)y;						\
+		for (i = 0; i < len; i += n) {				\
+			memcpy(&v, x + i, sizeof v);			\
+			v = p##N##n##v_##f(v);				\
+			memcpy(r + i, &v, sizeof v);			\
+		}							\
+	}
+
+#define	V2(p, n, t, vt, f, attr)					\
+	extern vt p##N##n##vv_##f(vt, vt) attr;				\
+	static void ISA_TARGET						\
+	p##_##f(const t *x, const t *y, t *r, int len)			\
+	{								\
+		vt v, w;						\
+		int i;							\
+									\
+		for (i = 0; i < len; i += n) {				\
+			memcpy(&v, x + i, sizeof v);			\
+			memcpy(&w, y + i, sizeof w);			\
+			v = p##N##n##vv_##f(v, w);			\
+			memcpy(r + i, &v, sizeof v);			\
+		}							\
+	}
+
+#define	VSC(p, n, step, t, vt, f, attr)					\
+	extern void p##N##n##vl##step##l##step##_##f(vt, t *, t *) attr; \
+	static void ISA_TARGET						\
+	p##_##f(const t *x, const t *y, t *r, int len)			\
+	{								\
+		vt v;							\
+		int i;							\
+									\
+		for (i = 0; i < len; i += n) {				\
+			memcpy(&v, x + i, sizeof v);			\
+			p##N##n##vl##step##l##step##_##f(v, r + i,	\
+			    (t *)y + i);				\
+		}							\
+	}
+
+#define	DEFINE_ISA(p, n, nf, bytes, attr)				\
+	typedef double p##_vd __attribute__((__vector_size__(bytes)));	\
+	typedef float p##_vf __attribute__((__vector_size__(bytes)));	\
+	V1(p, n, double, p##_vd, exp, attr)				\
+	V1(p, n, double, p##_vd, exp2, attr)				\
+	V1(p, n, double, p##_vd, log, attr)				\
+	V1(p, n, double, p##_vd, log2, attr)				\
+	V2(p, n, double, p##_vd, pow, attr)				\
+	V1(p, n, double, p##_vd, sin, attr)				\
+	V1(p, n, double, p##_vd, cos, attr)				\
+	VSC(p, n, 8, double, p##_vd, sincos, attr)			\
+	V1(p, nf, float, p##_vf, expf, attr)				\
+	V1(p, nf, float, p##_vf, exp2f, attr)				\
+	V1(p, nf, float, p##_vf, logf, attr)				\
+	V1(p, nf, float, p##_vf, log2f, attr)				\
+	V2(p, nf, float, p##_vf, powf, attr)				\
+	V1(p, nf, float, p##_vf, sinf, attr)				\
+	V1(p, nf, float, p##_vf, cosf, attr)				\
+	VSC(p, nf, 4, float, p##_vf, sincosf, attr)
+
+#define	ISA(name, p, present) { name, present,				\
+	p##_exp, p##_exp2, p##_log, p##_log2, p##_pow, p##_sin, p##_cos, \
+	p##_sincos, p##_expf, p##_exp2f, p##_logf, p##_log2f, p##_powf,	\
+	p##_sinf, p##_cosf, p##_sincosf }
+
+static int
+always(void)
+{
+
+	return (1);
+}
+
+#ifdef __x86_64__
+#define	ISA_TARGET
+DEFINE_ISA(_ZGVb, 2, 4, 16, )
+#undef ISA_TARGET
+#define	ISA_TARGET	__attribute__((__target__("avx")))
+DEFINE_ISA(_ZGVc, 4, 8, 32, )
+#undef ISA_TARGET
+#define	ISA_TARGET	__attribute__((__target__("avx2")))
+DEFINE_ISA(_ZGVd, 4, 8, 32, )
+#undef ISA_TARGET
+#define	ISA_TARGET	__attribute__((__target__("avx512f")))
+DEFINE_ISA(_ZGVe, 8, 16, 64, )
+#undef ISA_TARGET
+
+static int
+have_avx(void)
+{
+
+	return (__builtin_cpu_supports("avx"));
+}
+
+static int
+have_avx2(void)
+{
+
+	return (__builtin_cpu_supports("avx2"));
+}
+
+static int
+have_avx512(void)
+{
+
+	return (__builtin_cpu_supports("avx512f"));
+}
+
+static const struct isa isas[] = {
+	ISA("sse2", _ZGVb, always),
+	ISA("avx", _ZGVc, have_avx),
+	ISA("avx2", _ZGVd, have_avx2),
+	ISA("avx512", _ZGVe, have_avx512),
+};
+#else
+#define	ISA_TARGET
+DEFINE_ISA(_ZGVn, 2, 4, 16, __attribute__((__aarch64_vector_pcs__)))
+#undef ISA_TARGET
+
+static const struct isa isas[] = {
+	ISA("advsimd", _ZGVn, always),
+};
+#endif
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* A random double in [lo, hi).  */
+static double
+random_range(double lo, double hi)
+{
+
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (lo + (hi - lo) * (double)(seed >> 11) * 0x1p-53);
+}
+
+static double x[NUMBERS], y[NUMBERS], r[NUMBERS];
+static float xf[NUMBERS], yf[NUMBERS], rf[NUMBERS];
+
+/* x and y from [lo, hi) and [ylo, yhi), and their floats.  */
+static void
+fill(double lo, double hi, double ylo, double yhi)
+{
+	int i;
+
+	for (i = 0; i < NUMBERS; i++) {
+		x[i] = random_range(lo, hi);
+		y[i] = random_range(ylo, yhi);
+		xf[i] = x[i];
+		yf[i] = y[i];
+	}
+}
+
+#ifdef BENCH
+#define ROUNDS	200
+
+static volatile double dsink;
+
+static double
+elapsed(const struct timespec *t0, const struct timespec *t1)
+{
+
+	return ((t1->tv_sec - t0->tv_sec) * 1e9 +
+	    (t1->tv_nsec - t0->tv_nsec)) / ((double)NUMBERS * ROUNDS);
+}
+
+#define	BENCH1(isa, label, v, s, a, b, o)				\
+	do {								\
+		struct timespec t0, t1, t2;				\
+		int i, j;						\
+									\
+		clock_gettime(CLOCK_MONOTONIC, &t0);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			for (i = 0; i < NUMBERS; i++)			\
+				o[i] = s;				\
+		clock_gettime(CLOCK_MONOTONIC, &t1);			\
+		for (j = 0; j < ROUNDS; j++)				\
+			isa->v(a, b, o, NUMBERS);			\
+		clock_gettime(CLOCK_MONOTONIC, &t2);			\
+		printf("%-8s %-8s %8.2f ns/call scalar %8.2f ns/call "	\
+		    "vector %5.2fx\n", isa->name, label,			\
+		    elapsed(&t0, &t1), elapsed(&t1, &t2),		\
+		    elapsed(&t0, &t1) / elapsed(&t1, &t2));		\
+		dsink = o[0];						\
+	} while (0)
+
+static void
+bench(const struct isa *isa)
+{
+
+	fill(-100, 100, 0.5, 10);
+	BENCH1(isa, "exp", exp, exp(x[i]), x, y, r);
+	BENCH1(isa, "exp2", exp2, exp2(x[i]), x, y, r);
+	BENCH1(isa, "log", log, log(y[i]), y, x, r);
+	BENCH1(isa, "log2", log2, log2(y[i]), y, x, r);
+	BENCH1(isa, "pow", pow, pow(y[i], x[i]), y, x, r);
+	BENCH1(isa, "sin", sin, sin(x[i]), x, y, r);
+	BENCH1(isa, "cos", cos, cos(x[i]), x, y, r);
+	BENCH1(isa, "sincos", sincos, (sincos(x[i], &r[i], &y[i]), r[i]),
+	    x, y, r);
+	fill(-80, 80, 0.5, 10);
+	BENCH1(isa, "expf", expf, expf(xf[i]), xf, yf, rf);
+	BENCH1(isa, "exp2f", exp2f, exp2f(xf[i]), xf, yf, rf);
+	BENCH1(isa, "logf", logf, logf(yf[i]), yf, xf, rf);
+	BENCH1(isa, "log2f", log2f, log2f(yf[i]), yf, xf, rf);
+	BENCH1(isa, "sinf", sinf, sinf(xf[i]), xf, yf, rf);
+	BENCH1(isa, "cosf", cosf, cosf(xf[i]), xf, yf, rf);
+	BENCH1(isa, "sincosf", sincosf,
+	    (sincosf(xf[i], &rf[i], &yf[i]), rf[i]), xf, yf, rf);
+	/* Mostly without the overflow and underflow left to powf().  */
+	fill(0.5, 10, -8, 8);
+	BENCH1(isa, "powf", powf, powf(xf[i], yf[i]), xf, yf, rf);
+}
+
+int
+main(void)
+{
+	int i;
+
+	for (i = 0; i < sizeof isas / sizeof isas[0]; i++)
+		if (isas[i].present())
+			bench(&isas[i]);
+	return 0;
+}
+#else
+/* Whether y is want or one of its neighbours, or both are nan.  */
+static int
+near(double y, double want)
+{
+
+	return (y == want || y == nextafter(want, INFINITY) ||
+	    y == nextafter(want, -INFINITY) || (isnan(y) && isnan(want)));
+}
+
+static int
+nearf(float y, float want)
+{
+
+	return (y == want || y == nextafterf(want, INFINITY) ||
+	    y == nextafterf(want, -INFINITY) || (isnan(y) && isnan(want)));
+}
+
+/* Check f against its scalar version s over x (and y).  */
+#define	CHECK1(isa, f, s)						\
+	do {								\
+		isa->f(x, y, r, NUMBERS);				\
+		for (i = 0; i < NUMBERS; i++)				\
+			TEST(near(r[i], s(x[i])));			\
+	} while (0)
+
+#define	CHECK1F(isa, f, s)						\
+	do {								\
+		isa->f(xf, yf, rf, NUMBERS);				\
+		for (i = 0; i < NUMBERS; i++)				\
+			TEST(nearf(rf[i], s(xf[i])));			\
+	} while (0)
+
+/* Check every function on x and y as they are.  */
+static void
+check(const struct isa *isa)
+{
+	double s, c, cs[NUMBERS];
+	float sf, cf, csf[NUMBERS];
+	int i;
+
+	CHECK1(isa, exp, exp);
+	CHECK1(isa, exp2, exp2);
+	CHECK1(isa, log, log);
+	CHECK1(isa, log2, log2);
+	CHECK1(isa, sin, sin);
+	CHECK1(isa, cos, cos);
+	isa->pow(x, y, r, NUMBERS);
+	for (i = 0; i < NUMBERS; i++)
+		TEST(near(r[i], pow(x[i], y[i])));
+	isa->sincos(x, cs, r, NUMBERS);
+	for (i = 0; i < NUMBERS; i++) {
+		sincos(x[i], &s, &c);
+		TEST(near(r[i], s) && near(cs[i], c));
+	}
+	CHECK1F(isa, expf, expf);
+	CHECK1F(isa, exp2f, exp2f);
+	CHECK1F(isa, logf, logf);
+	CHECK1F(isa, log2f, log2f);
+	CHECK1F(isa, sinf, sinf);
+	CHECK1F(isa, cosf, cosf);
+	isa->powf(xf, yf, rf, NUMBERS);
+	for (i = 0; i < NUMBERS; i++)
+		TEST(nearf(rf[i], powf(xf[i], yf[i])));
+	isa->sincosf(xf, csf, rf, NUMBERS);
+	for (i = 0; i < NUMBERS; i++) {
+		sincosf(xf[i], &sf, &cf);
+		TEST(nearf(rf[i], sf) && nearf(csf[i], cf));
+	}
+}
+
+/* Values for the scalar functions, and ones next to them.  */
+static const double specials[] = {
+	0, -0.0, INFINITY, -INFINITY, NAN, -NAN, 1, -1, 2, 0.5, -2,
+	DBL_MIN, DBL_MIN / 4, -DBL_MIN, DBL_MAX, -DBL_MAX, 0x1p-1074,
+	88, 89, -104, 128, -150, 512, -512, 709.7, -745.1, 1024, -1075,
+	0x1.921fb54442d18p+20, 0x1p+30, 0x1.2d5p+999, 0x1p-30, 1e-300,
+	FLT_MIN, FLT_MIN / 4, FLT_MAX, 0x1p+20, 0x1p-65, 0x1p+63, 3, 0.25,
+};
+
+int
+main(void)
+{
+	const int n = sizeof specials / sizeof specials[0];
+	const struct isa *isa;
+	int i;
+
+	for (isa = isas; isa < isas + sizeof isas / sizeof isas[0]; isa++) {
+		if (!isa->present())
+			continue;
+		fill(-1, 1, -1, 1);
+		check(isa);
+		fill(0.9, 1.1, -1e4, 1e4);
+		check(isa);
+		fill(0, 10, -100, 100);
+		check(isa);
+		fill(-800, 800, -3, 3);
+		check(isa);
+		fill(-1e7, 1e7, 0, 1e-300);
+		check(isa);
+		fill(-1e30, 1e30, -1e30, 1e30);
+		check(isa);
+
+		/* Every special case with every other, in every lane.  */
+		for (i = 0; i < NUMBERS; i++) {
+			x[i] = specials[i % n];
+			y[i] = specials[(i / n + i) % n];
+			xf[i] = x[i];
+			yf[i] = y[i];
+		}
+		check(isa);
+	}
+	return 0;
+}
+#endif
+#else
+int
+main(void)
+{
+
+	return 0;
+}
+#endif
@@ -0,0 +1,237 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for the error handling of the libm wrappers (the
+ * w_*.c and wf_*.c files): the results and errno of the arguments that
+ * take the out of line error path, and for arguments either side of
+ * each wrapper's screen that errno is left alone.  This holds both
+ * for the default build and for --disable-newlib-matherr.
+ *
+ * Built with -DBENCH it instead prints, for each wrapper, the time per
+ * call through the wrapper and straight to the __ieee754_ function it
+ * wraps, and the difference, which is what the wrapper costs.
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* A random double in [lo, hi).  */
+static double
+random_range(double lo, double hi)
+{
+
+	seed ^= seed << 13;
+	seed ^= seed >> 7;
+	seed ^= seed << 17;
+	return (lo + (hi - lo) * (double)(seed >> 11) * 0x1p-53);
+}
+
+#ifdef BENCH
+#define NUMBERS	4096
+#define ROUNDS	100
+#define RUNS	5
+
+/* The functions the wrappers call, which libm has but math.h hides.  */
+extern double __ieee754_acos(double), __ieee754_acosh(double);
+extern double __ieee754_atanh(double), __ieee754_cosh(double);
+extern double __ieee754_sinh(double), __ieee754_log10(double);
+extern double __ieee754_sqrt(double), __ieee754_j0(double);
+extern double __ieee754_fmod(double, double);
+extern double __ieee754_hypot(double, double);
+extern double __ieee754_remainder(double, double);
+extern float __ieee754_acosf(float), __ieee754_coshf(float);
+extern float __ieee754_log10f(float), __ieee754_sqrtf(float);
+extern float __ieee754_fmodf(float, float);
+extern float __ieee754_hypotf(float, float);
+
+static double in[NUMBERS], in2[NUMBERS];
+static float inf_[NUMBERS], inf2[NUMBERS];
+static volatile double dsink;
+static volatile float fsink;
+
+static double
+elapsed(const struct timespec *t0, const struct timespec *t1)
+{
+
+	return ((t1->tv_sec - t0->tv_sec) * 1e9 +
+	    (t1->tv_nsec - t0->tv_nsec)) / ((double)NUMBERS * ROUNDS);
+}
+
+/*
+ * The calls are independent, so this is the throughput.  The best of
+ * a few runs is kept, as the difference can be smaller than the noise.
+ */
+#define	BENCH1(name, f, k, type, args)					\
+	do {								\
+		struct timespec t0, t1, t2;				\
+		double tf = 1e9, tk = 1e9;				\
+		type s = 0;						\
+		int i, j, r;						\
+									\
+		for (r = 0; r < RUNS; r++) {				\
+			clock_gettime(CLOCK_MONOTONIC, &t0);		\
+			for (j = 0; j < ROUNDS; j++)			\
+				for (i = 0; i < NUMBERS; i++)		\
+					s += f args;			\
+			clock_gettime(CLOCK_MONOTONIC, &t1);		\
+			for (j = 0; j < ROUNDS; j++)			\
+				for (i = 0; i < NUMBERS; i++)		\
+					s += k args;			\
+			clock_gettime(CLOCK_MONOTONIC, &t2);		\
+			if (elapsed(&t0, &t1) < tf)			\
+				tf = elapsed(&t0, &t1);			\
+			if (elapsed(&t1, &t2) < tk)			\
+				tk = elapsed(&t1, &t2);			\
+		}							\
+		printf("%-10s %8.2f ns/call, kernel %8.2f ns/call, "	\
+		    "wrapper %+6.2f ns\n", name, tf, tk, tf - tk);	\
+		sink(s);						\
+	} while (0)
+
+#define	sink(v)	(sizeof(v) == sizeof(float) ? (void)(fsink = (v)) :	\
+	    (void)(dsink = (v)))
+
+int
+main(void)
+{
+	int i;
+
+	for (i = 0; i < NUMBERS; i++) {
+		in[i] = random_range(-1, 1);
+		inf_[i] = in[i];
+	}
+	BENCH1("acos", acos, __ieee754_acos, double, (in[i]));
+	BENCH1("atanh", atanh, __ieee754_atanh, double, (in[i]));
+	BENCH1("acosf", acosf, __ieee754_acosf, float, (inf_[i]));
+	for (i = 0; i < NUMBERS; i++) {
+		in[i] = random_range(1, 700);
+		in2[i] = random_range(0.5, 100);
+		inf_[i] = random_range(1, 88);
+		inf2[i] = random_range(0.5, 100);
+	}
+	BENCH1("acosh", acosh, __ieee754_acosh, double, (in[i]));
+	BENCH1("cosh", cosh, __ieee754_cosh, double, (in[i]));
+	BENCH1("sinh", sinh, __ieee754_sinh, double, (in[i]));
+	BENCH1("log10", log10, __ieee754_log10, double, (in[i]));
+	BENCH1("sqrt", sqrt, __ieee754_sqrt, double, (in[i]));
+	BENCH1("j0", j0, __ieee754_j0, double, (in[i]));
+	BENCH1("fmod", fmod, __ieee754_fmod, double, (in[i], in2[i]));
+	BENCH1("hypot", hypot, __ieee754_hypot, double, (in[i], in2[i]));
+	BENCH1("remainder", remainder, __ieee754_remainder, double,
+	    (in[i], in2[i]));
+	BENCH1("coshf", coshf, __ieee754_coshf, float, (inf_[i]));
+	BENCH1("log10f", log10f, __ieee754_log10f, float, (inf_[i]));
+	BENCH1("sqrtf", sqrtf, __ieee754_sqrtf, float, (inf_[i]));
+	BENCH1("fmodf", fmodf, __ieee754_fmodf, float, (inf_[i], inf2[i]));
+	BENCH1("hypotf", hypotf, __ieee754_hypotf, float, (inf_[i], inf2[i]));
+	return 0;
+}
+#else
+int
+main(void)
+{
+	double d;
+	float f;
+	int i;
+
+	/* Domain errors.  */
+	errno = 0;
+	TEST(isnan(acos(2)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(asin(-2)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(acosh(0.5)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(atanh(-2)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(fmod(1, 0)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(remainder(1, 0)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(log10(-1)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(sqrt(-1)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(acosf(2)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(atanhf(2)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(fmodf(1, 0)) && errno == EDOM);
+	errno = 0;
+	TEST(isnan(sqrtf(-1)) && errno == EDOM);
+
+	/* Poles and overflow.  */
+	errno = 0;
+	TEST(log10(0) == -HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(cosh(1000) == HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(sinh(-1000) == -HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(hypot(DBL_MAX, DBL_MAX) == HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(tgamma(200) == HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(log10f(0) == -HUGE_VALF && errno == ERANGE);
+	errno = 0;
+	TEST(coshf(100) == HUGE_VALF && errno == ERANGE);
+	errno = 0;
+	TEST(hypotf(FLT_MAX, FLT_MAX) == HUGE_VALF && errno == ERANGE);
+
+	/* NaNs go through quietly.  */
+	errno = 0;
+	TEST(isnan(acos(NAN)) && isnan(sqrt(NAN)) && isnan(log10(NAN)));
+	TEST(isnan(fmod(NAN, 0)) && isnan(hypot(NAN, 1)));
+	TEST(isnan(acosf(NAN)) && isnan(sqrtf(NAN)) && isnan(fmodf(NAN, 0)));
+	TEST(errno == 0);
+
+	/* Either side of the screens, where errno must stay 0.  */
+	TEST(acos(1) == 0 && acos(-1) > 3 && asin(1) > 1.5);
+	TEST(acosh(1) == 0 && atanh(0) == 0 && atanh(-0.5) < 0);
+	TEST(cosh(710.4) < HUGE_VAL && sinh(-710.4) > -HUGE_VAL);
+	TEST(fmod(7, 3) == 1 && remainder(7, 3) == 1 && hypot(3, 4) == 5);
+	TEST(log10(1000) == 3 && sqrt(0) == 0 && sqrt(-0.0) == 0);
+	TEST(log10(DBL_MIN) < -307 && fabs(tgamma(5) - 24) < 1e-12);
+	TEST(acosf(1) == 0 && asinf(-1) < -1.5f && atanhf(0.5f) > 0);
+	TEST(coshf(89) < HUGE_VALF && fmodf(7, 3) == 1 && hypotf(3, 4) == 5);
+	TEST(log10f(100) == 2 && sqrtf(4) == 2 && sqrtf(-0.0f) == 0);
+	TEST(errno == 0);
+
+	/* And for the arguments a program would pass.  */
+	for (i = 0; i < 10000; i++) {
+		d = random_range(-1, 1);
+		f = d;
+		TEST(!isnan(acos(d)) && !isnan(asin(d)) && !isnan(acosf(f)));
+		d = random_range(1, 700);
+		f = random_range(1, 88);
+		TEST(isfinite(cosh(d)) && isfinite(sinh(-d)) &&
+		    isfinite(acosh(d)) && isfinite(coshf(f)));
+		TEST(sqrt(d) * sqrt(d) > d * 0.999 && sqrtf(f) > 0);
+		TEST(fmod(d, f) < f && isfinite(hypot(d, f)));
+	}
+	TEST(errno == 0);
+	return 0;
+}
+#endif
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for regexec() looking for the literals of a regex before
+ * it starts matching: the longest one every match contains, and one from
+ * each branch of an alternation that every match goes through.  Each
+ * regex is tried on random strings against itself made an alternative
+ * to a character that is never in them, which leaves nothing to look
+ * for; whether there is a match, and where it and each subexpression
+ * are, must come out the same.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <regex.h>
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+static const char *const patterns[] = {
+	"abc",
+	"xy+z",
+	"ab.d",
+	"ab(cd|dc)a",
+	"(ab|ba|aab)",
+	"[ab]+(abc|bca)x?",
+	"(ab|cd)(da|ad)",
+	"a.b.(cd|dc)",
+	"^(ab|bc)",
+	"(ab|bc)$",
+	".*(abb|bba)",
+	"(aa|bb)[ab]{0,3}(ab|ba)",
+	"(xa|ya)+b",
+	"(ab|cd)?(bc|da)",
+	"[[:<:]](ab|cd)[[:>:]]",
+};
+
+#define	NSUB	4
+
+static void
+compare(const char *pattern, const char *set, int n)
+{
+	char alt[64];
+	char s[64];
+	regmatch_t pm[NSUB], am[NSUB + 1];
+	regex_t re, ra;
+	int i, j, len, k = strlen(set), e, r, ar;
+	static const int eflags[] = { 0, REG_NOTBOL, REG_NOTEOL };
+
+	snprintf(alt, sizeof alt, "(%s)|\001", pattern);
+	TEST(regcomp(&re, pattern, REG_EXTENDED) == 0);
+	TEST(regcomp(&ra, alt, REG_EXTENDED) == 0);
+	TEST(re.re_nsub < NSUB);
+	for (i = 0; i < n; i++) {
+		len = rand() % (sizeof s);
+		for (j = 0; j < len; j++)
+			s[j] = set[rand() % k];
+		s[len] = '\0';
+		for (e = 0; e < 3; e++) {
+			r = regexec(&re, s, NSUB, pm, eflags[e]);
+			ar = regexec(&ra, s, NSUB + 1, am, eflags[e]);
+			TEST(r == ar);
+			TEST(regexec(&re, s, 0, NULL, eflags[e]) == r);
+			if (r != 0)
+				continue;
+			TEST(pm[0].rm_so == am[0].rm_so);
+			TEST(pm[0].rm_eo == am[0].rm_eo);
+			for (j = 1; j <= (int)re.re_nsub; j++) {
+				TEST(pm[j].rm_so == am[j + 1].rm_so);
+				TEST(pm[j].rm_eo == am[j + 1].rm_eo);
+			}
+		}
+	}
+	regfree(&re);
+	regfree(&ra);
+}
+
+int
+main(void)
+{
+	regmatch_t pm;
+	regex_t re;
+	int i;
+
+	srand(1);
+	for (i = 0; i < (int)(sizeof patterns / sizeof patterns[0]); i++)
+		compare(patterns[i], "abcdxyz ", 3000);
+
+	/* What is outside of REG_STARTEND's part doesn't count.  */
+	TEST(regcomp(&re, "abc", REG_NOSUB) == 0);
+	pm.rm_so = 1;
+	pm.rm_eo = 5;
+	TEST(regexec(&re, "abcxx", 1, &pm, REG_STARTEND) == REG_NOMATCH);
+	pm.rm_so = 0;
+	pm.rm_eo = 4;
+	TEST(regexec(&re, "xxabc", 1, &pm, REG_STARTEND) == REG_NOMATCH);
+	regfree(&re);
+	TEST(regcomp(&re, "(abc|cab)d", REG_EXTENDED) == 0);
+	pm.rm_so = 1;
+	pm.rm_eo = 5;
+	TEST(regexec(&re, "abcdx", 1, &pm, REG_STARTEND) == REG_NOMATCH);
+	pm.rm_so = 2;
+	pm.rm_eo = 7;
+	TEST(regexec(&re, "xxcabdx", 1, &pm, REG_STARTEND) == 0);
+	TEST(pm.rm_so == 2 && pm.rm_eo == 6);
+	regfree(&re);
+
+	exit(0);
+}
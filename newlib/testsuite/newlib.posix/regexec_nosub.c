@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for regexec() without subexpressions, which runs through
+ * a cache of state sets kept with the regex.  Whether there is a match
+ * must come out the same as when the match is asked for, which does not
+ * use the cache: for anchors, word boundaries and REG_NEWLINE, for the
+ * same regex used again and again, for regexes with too many states for
+ * a long, and for one whose cache fills up and has to be thrown away.
+ *
+ * Built with -DBENCH it instead prints how long matching lines of a log
+ * takes for a few patterns of the kind used to filter logs.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <regex.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#ifdef BENCH
+#define	LINES	20000
+#define	ROUNDS	20
+
+static const char *const patterns[] = {
+	"Failed password for .* from [0-9]+\\.[0-9]+\\.[0-9]+\\.[0-9]+",
+	"(ERROR|FATAL|panic)",
+	"sshd\\[[0-9]+\\]: .*(root|admin)",
+	"^[0-9-]+ [0-9:]+ host[0-9]+ kernel\\[[0-9]+\\]: ",
+	"timed out|refused|unreachable",
+};
+
+static char lines[LINES][128];
+
+int
+main(void)
+{
+	static const char *const what[] = {
+		"Accepted publickey for deploy", "Failed password for root",
+		"connection refused by peer", "ERROR disk quota exceeded",
+		"session opened for user admin", "request timed out after 30s",
+	};
+	struct timespec t0, t1;
+	regex_t re;
+	int i, j, r, hits;
+	double ns;
+
+	srand(1);
+	for (i = 0; i < LINES; i++)
+		snprintf(lines[i], sizeof lines[i],
+		    "2026-10-%02d %02d:%02d:%02d host%d %s[%d]: %s from "
+		    "10.%d.%d.%d port %d", 1 + rand() % 28, rand() % 24,
+		    rand() % 60, rand() % 60, rand() % 50,
+		    rand() % 4 ? "sshd" : "kernel", rand() % 32768,
+		    what[rand() % 6], rand() % 256, rand() % 256,
+		    rand() % 256, 1024 + rand() % 60000);
+
+	for (i = 0; i < (int)(sizeof patterns / sizeof patterns[0]); i++) {
+		TEST(regcomp(&re, patterns[i], REG_EXTENDED|REG_NOSUB) == 0);
+		hits = 0;
+		clock_gettime(CLOCK_MONOTONIC, &t0);
+		for (r = 0; r < ROUNDS; r++)
+			for (j = 0; j < LINES; j++)
+				hits += regexec(&re, lines[j], 0, NULL, 0) == 0;
+		clock_gettime(CLOCK_MONOTONIC, &t1);
+		ns = ((t1.tv_sec - t0.tv_sec) * 1e9 +
+		    (t1.tv_nsec - t0.tv_nsec)) / ((double)ROUNDS * LINES);
+		printf("%7.0f ns/line %6d hits  %s\n", ns, hits / ROUNDS,
+		    patterns[i]);
+		regfree(&re);
+	}
+	exit(0);
+}
+#else
+struct test {
+	const char *pattern;
+	int cflags;
+	const char *string;
+	int eflags;
+	int match;
+};
+
+static const struct test tests[] = {
+	{ "abc", 0, "xxabcxx", 0, 1 },
+	{ "abc", 0, "xxabxcx", 0, 0 },
+	{ "^abc", 0, "abcd", 0, 1 },
+	{ "^abc", 0, "abcd", REG_NOTBOL, 0 },
+	{ "abc$", 0, "xabc", 0, 1 },
+	{ "abc$", 0, "xabc", REG_NOTEOL, 0 },
+	{ "^$", 0, "", 0, 1 },
+	{ "^$", 0, "", REG_NOTBOL, 0 },
+	{ "^b", REG_NEWLINE, "a\nb", 0, 1 },
+	{ "^b", 0, "a\nb", 0, 0 },
+	{ "a$", REG_NEWLINE, "a\nb", 0, 1 },
+	{ "a$", 0, "a\nb", 0, 0 },
+	{ "[[:<:]]is[[:>:]]", REG_EXTENDED, "this is it", 0, 1 },
+	{ "[[:<:]]is[[:>:]]", REG_EXTENDED, "this isn't", 0, 0 },
+	{ "[[:<:]]x", REG_EXTENDED, "_x x", 0, 1 },
+	{ "[[:<:]]x", REG_EXTENDED, "_x", 0, 0 },
+	{ "a(b|cd)*e", REG_EXTENDED, "xxabcdbbcde", 0, 1 },
+	{ "a(b|cd)*e", REG_EXTENDED, "xxabcdbbcdf", 0, 0 },
+	{ "(foo|bar)+baz", REG_EXTENDED|REG_ICASE, "..FooBARbaz", 0, 1 },
+	{ "x[0-9]{3,5}y", REG_EXTENDED, "x12y x1234y", 0, 1 },
+	{ "x[0-9]{3,5}y", REG_EXTENDED, "x12y x123456y", 0, 0 },
+	{ "\xe9t\xe9", 0, "caf\xe9 \xe9t\xe9", 0, 1 },
+};
+
+/* Whether re matches s: once through the cache and once without.  */
+static int
+both(regex_t *re, const char *s, int eflags)
+{
+	regmatch_t pm;
+	int nosub = regexec(re, s, 0, NULL, eflags);
+	int sub = regexec(re, s, 1, &pm, eflags);
+
+	TEST(nosub == 0 || nosub == REG_NOMATCH);
+	TEST(nosub == sub);
+	return nosub == 0;
+}
+
+/* Compare the two ways on random strings made of the bytes in set.  */
+static void
+random_strings(const char *pattern, int cflags, const char *set, int n)
+{
+	char s[64];
+	regex_t re;
+	int i, j, len, k = strlen(set);
+
+	TEST(regcomp(&re, pattern, cflags) == 0);
+	for (i = 0; i < n; i++) {
+		len = rand() % (sizeof s);
+		for (j = 0; j < len; j++)
+			s[j] = set[rand() % k];
+		s[len] = '\0';
+		both(&re, s, 0);
+		both(&re, s, REG_NOTBOL);
+		both(&re, s, REG_NOTEOL);
+	}
+	regfree(&re);
+}
+
+int
+main(void)
+{
+	const struct test *t;
+	char big[1000];
+	regmatch_t pm;
+	regex_t re;
+	int i, round;
+
+	/* Each one twice over, so that the second time is all cache.  */
+	for (t = tests; t < tests + sizeof tests / sizeof tests[0]; t++) {
+		TEST(regcomp(&re, t->pattern, t->cflags) == 0);
+		for (round = 0; round < 2; round++)
+			TEST(both(&re, t->string, t->eflags) == t->match);
+		regfree(&re);
+	}
+
+	/* REG_STARTEND: the part given is all the string there is.  */
+	TEST(regcomp(&re, "^b.d$", REG_EXTENDED|REG_NOSUB) == 0);
+	pm.rm_so = 1;
+	pm.rm_eo = 4;
+	TEST(regexec(&re, "abcde", 1, &pm, REG_STARTEND) == 0);
+	TEST(regexec(&re, "abcde", 1, &pm, REG_STARTEND|REG_NOTBOL) ==
+	    REG_NOMATCH);
+	pm.rm_eo = 5;
+	TEST(regexec(&re, "abcde", 1, &pm, REG_STARTEND) == REG_NOMATCH);
+	regfree(&re);
+
+	srand(1);
+	random_strings("^a|b$|[[:<:]]ab[[:>:]]", REG_EXTENDED|REG_NEWLINE,
+	    "ab _\n", 2000);
+	random_strings("(a|b)*a(a|b)(a|b)b", REG_EXTENDED, "ab", 2000);
+	random_strings("x(ab|ba)+y|^y+$", REG_EXTENDED, "abxy\n", 2000);
+
+	/* More states than there are bits in a long.  */
+	random_strings("alpha|beta|gamma|delta|epsilon|zeta|eta|theta|iota|"
+	    "kappa|lambda", REG_EXTENDED, "abdeghiklmnopstz", 2000);
+
+	/* Enough different sets of states to fill the cache many times.  */
+	TEST(regcomp(&re, "(a|b)*a(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)(a|b)"
+	    "(a|b)(a|b)(a|b)c", REG_EXTENDED) == 0);
+	for (round = 0; round < 20; round++) {
+		for (i = 0; i < (int)sizeof big - 1; i++)
+			big[i] = "ab"[rand() % 2];
+		big[i] = '\0';
+		TEST(!both(&re, big, 0));
+		big[sizeof big - 2 - round] = 'c';
+		TEST(both(&re, big, 0) == (big[sizeof big - 14 - round] == 'a'));
+	}
+	regfree(&re);
+
+	exit(0);
+}
+#endif
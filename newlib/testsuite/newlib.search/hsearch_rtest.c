@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for hcreate_r(), hcreate_hash_r() and hsearch_r(): the
+ * table must grow far past its nel hint, keep previously returned
+ * ENTRY pointers valid across growth, and behave the same with either
+ * hash function.
+ */
+
+#include <errno.h>
+#include <search.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#define NKEYS	20000
+
+static char keys[NKEYS][12];
+static ENTRY *first[NKEYS];
+
+static void
+run(struct hsearch_data *htab)
+{
+	ENTRY e, *ep;
+	char buf[12];
+	int i;
+
+	for (i = 0; i < NKEYS; i++) {
+		e.key = keys[i];
+		e.data = (void *)(long)i;
+		TEST(hsearch_r(e, ENTER, &ep, htab));
+		TEST(ep != NULL && ep->key == keys[i]);
+		first[i] = ep;
+	}
+	TEST(htab->htablesize >= NKEYS);
+
+	for (i = 0; i < NKEYS; i++) {
+		/* Look up through a copy so that only strcmp can match.  */
+		strcpy(buf, keys[i]);
+		e.key = buf;
+		TEST(hsearch_r(e, FIND, &ep, htab));
+		TEST(ep == first[i] && (long)ep->data == i);
+
+		/* ENTER of an existing key finds it.  */
+		e.data = NULL;
+		TEST(hsearch_r(e, ENTER, &ep, htab) && ep == first[i]);
+		TEST((long)ep->data == i);
+	}
+
+	for (i = 0; i < 1000; i++) {
+		sprintf(buf, "absent%d", i);
+		e.key = buf;
+		TEST(!hsearch_r(e, FIND, &ep, htab) && ep == NULL);
+	}
+	e.key = "";
+	TEST(!hsearch_r(e, FIND, &ep, htab));
+
+	hdestroy_r(htab);
+	TEST(htab->htable == NULL);
+}
+
+int
+main(void)
+{
+	struct hsearch_data htab;
+	int i;
+
+	for (i = 0; i < NKEYS; i++)
+		sprintf(keys[i], "k%07d", i * 7919);
+
+	memset(&htab, 0, sizeof htab);
+	TEST(hcreate_r(1, &htab));
+	TEST(!hcreate_r(1, &htab) && errno == EINVAL);
+	run(&htab);
+
+	memset(&htab, 0, sizeof htab);
+	TEST(hcreate_hash_r(10, HSEARCH_HASH_FAST, &htab));
+	run(&htab);
+
+	memset(&htab, 0, sizeof htab);
+	TEST(!hcreate_hash_r(10, 42, &htab) && errno == EINVAL);
+	TEST(htab.htable == NULL);
+	return 0;
+}
@@ -0,0 +1,151 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for qsort_mt() and qsort_mt_stable().  Arrays are big
+ * enough to be split on targets with threads; stability is checked by
+ * sorting on a key with many duplicates and looking at the original
+ * positions.
+ *
+ * Built with -DBENCH it instead times both sorts on a few million
+ * random ints for 1, 2, 4 and 8 threads.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+struct rec {
+	int key;
+	int pos;
+};
+
+static int
+cmp_rec(const void *a, const void *b)
+{
+	int x = ((const struct rec *)a)->key, y = ((const struct rec *)b)->key;
+
+	return (x < y ? -1 : x > y);
+}
+
+static int
+cmp_int(const void *a, const void *b)
+{
+	int x = *(const int *)a, y = *(const int *)b;
+
+	return (x < y ? -1 : x > y);
+}
+
+#ifdef BENCH
+#define BENCHN	4000000
+
+static double
+seconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+
+int
+main(void)
+{
+	int *a = malloc(BENCHN * sizeof *a), *b = malloc(BENCHN * sizeof *b);
+	double t, unstable;
+	int i, th;
+
+	TEST(a != NULL && b != NULL);
+	srand(1);
+	for (i = 0; i < BENCHN; i++)
+		b[i] = rand();
+	for (th = 1; th <= 8; th *= 2) {
+		memcpy(a, b, BENCHN * sizeof *a);
+		t = seconds();
+		qsort_mt(a, BENCHN, sizeof *a, cmp_int, th);
+		unstable = seconds() - t;
+		memcpy(a, b, BENCHN * sizeof *a);
+		t = seconds();
+		TEST(qsort_mt_stable(a, BENCHN, sizeof *a, cmp_int, th) == 0);
+		printf("%d threads: qsort_mt %.3fs, qsort_mt_stable %.3fs\n",
+		    th, unstable, seconds() - t);
+	}
+	free(a);
+	free(b);
+	return 0;
+}
+#else
+#define MAXN	200003
+
+static struct rec recs[MAXN];
+static int ints[MAXN];
+
+static void
+check(int n, int stable)
+{
+	long sum = 0;
+	int i;
+
+	for (i = 1; i < n; i++) {
+		TEST(recs[i - 1].key <= recs[i].key);
+		if (stable && recs[i - 1].key == recs[i].key)
+			TEST(recs[i - 1].pos < recs[i].pos);
+	}
+	for (i = 0; i < n; i++)
+		sum += recs[i].pos;
+	TEST(sum == (long)n * (n - 1) / 2);
+}
+
+int
+main(void)
+{
+	static const int sizes[] = { 0, 1, 2, 17, 1000, 70001, MAXN };
+	unsigned int s;
+	int th, mod, i, n;
+
+	srand(1);
+	for (s = 0; s < sizeof sizes / sizeof sizes[0]; s++)
+		for (th = 0; th <= 5; th++)
+			for (mod = 1; mod <= 100000; mod *= 100) {
+				n = sizes[s];
+
+				for (i = 0; i < n; i++) {
+					recs[i].key = rand() % mod;
+					recs[i].pos = i;
+				}
+				TEST(qsort_mt_stable(recs, n, sizeof recs[0],
+				    cmp_rec, th) == 0);
+				check(n, 1);
+
+				for (i = 0; i < n; i++) {
+					recs[i].key = n - i;
+					recs[i].pos = i;
+				}
+				qsort_mt(recs, n, sizeof recs[0], cmp_rec, th);
+				check(n, 0);
+
+				for (i = 0; i < n; i++)
+					ints[i] = rand() % mod;
+				qsort_mt(ints, n, sizeof ints[0], cmp_int, th);
+				for (i = 1; i < n; i++)
+					TEST(ints[i - 1] <= ints[i]);
+			}
+	return 0;
+}
+#endif
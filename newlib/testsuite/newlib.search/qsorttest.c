@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for qsort() and qsort_r(): sorted, reversed, organ-pipe,
+ * random and few-distinct-key inputs, for element sizes that take each
+ * of the specialized swap paths.
+ */
+
+#define _GNU_SOURCE
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#define NKINDS	5
+#define MAXN	5000
+
+struct rec {
+	long key;
+	long payload;
+};
+
+struct odd {
+	char b[7];
+};
+
+static long ncalls;
+
+static long
+keyof(int kind, int i, int n)
+{
+	switch (kind) {
+	case 0:
+		return i;			/* sorted */
+	case 1:
+		return n - i;			/* reversed */
+	case 2:
+		return i < n / 2 ? i : n - i;	/* organ pipe */
+	case 3:
+		return rand();			/* random */
+	default:
+		return rand() % 4;		/* few distinct keys */
+	}
+}
+
+static int
+cmp_int(const void *a, const void *b)
+{
+	int x = *(const int *)a, y = *(const int *)b;
+
+	return (x > y) - (x < y);
+}
+
+static int
+cmp_rec(const void *a, const void *b)
+{
+	const struct rec *x = a, *y = b;
+
+	return (x->key > y->key) - (x->key < y->key);
+}
+
+static int
+cmp_odd(const void *a, const void *b)
+{
+	return memcmp(a, b, sizeof(struct odd));
+}
+
+static int
+cmp_long_r(const void *a, const void *b, void *arg)
+{
+	long x = *(const long *)a, y = *(const long *)b;
+
+	++*(long *)arg;
+	return (x > y) - (x < y);
+}
+
+static int ints[MAXN];
+static long longs[MAXN];
+static struct rec recs[MAXN];
+static struct odd odds[MAXN];
+
+int
+main(void)
+{
+	int kind, n, i;
+
+	for (kind = 0; kind < NKINDS; kind++)
+		for (n = 0; n <= MAXN; n = n < 40 ? n + 1 : n * 2) {
+			for (i = 0; i < n; i++) {
+				recs[i].key = longs[i] = ints[i] =
+				    keyof(kind, i, n);
+				recs[i].payload = i;
+				memset(odds[i].b, ints[i] & 3, sizeof odds[i].b);
+				odds[i].b[6] = ints[i];
+			}
+
+			qsort(ints, n, sizeof ints[0], cmp_int);
+			for (i = 1; i < n; i++)
+				TEST(ints[i - 1] <= ints[i]);
+
+			qsort(recs, n, sizeof recs[0], cmp_rec);
+			for (i = 1; i < n; i++)
+				TEST(recs[i - 1].key <= recs[i].key);
+
+			qsort(odds, n, sizeof odds[0], cmp_odd);
+			for (i = 1; i < n; i++)
+				TEST(cmp_odd(&odds[i - 1], &odds[i]) <= 0);
+
+			ncalls = 0;
+			qsort_r(longs, n, sizeof longs[0], cmp_long_r, &ncalls);
+			for (i = 1; i < n; i++)
+				TEST(longs[i - 1] <= longs[i]);
+			TEST(n < 2 || ncalls > 0);
+		}
+
+	exit(0);
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for tsearch(), tfind(), tdelete(), twalk() and
+ * tdestroy().  Keys inserted in ascending order must still give a tree
+ * of logarithmic depth; random inserts and deletes are checked against
+ * a presence table and an in-order walk.
+ *
+ * Built with -DBENCH it instead times a million sorted inserts followed
+ * by a million lookups.
+ */
+
+#include <search.h>
+#include <stdlib.h>
+#include <stdio.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+static int
+cmp_long(const void *a, const void *b)
+{
+	long x = (long)a, y = (long)b;
+
+	return (x < y ? -1 : x > y);
+}
+
+static void
+nofree(void *key)
+{
+}
+
+#ifdef BENCH
+#define BENCHN	1000000L
+
+int
+main(void)
+{
+	void *root = NULL;
+	clock_t t;
+	long i;
+
+	t = clock();
+	for (i = 1; i <= BENCHN; i++)
+		TEST(tsearch((void *)i, &root, cmp_long) != NULL);
+	for (i = 1; i <= BENCHN; i++)
+		TEST(tfind((void *)i, &root, cmp_long) != NULL);
+	printf("%ld sorted inserts and lookups: %.3fs\n", BENCHN,
+	    (double)(clock() - t) / CLOCKS_PER_SEC);
+	tdestroy(root, nofree);
+	return 0;
+}
+#else
+#define NKEYS	4096
+
+static char present[NKEYS];
+static int maxlevel, nvisited;
+static long lastkey;
+
+static void
+walk(const void *node, VISIT v, int level)
+{
+	long key = *(long *)node;
+
+	if (level > maxlevel)
+		maxlevel = level;
+	if (v == postorder || v == leaf) {
+		TEST(key > lastkey);
+		TEST(present[key]);
+		lastkey = key;
+		nvisited++;
+	}
+}
+
+static void
+check(void *root, int n)
+{
+	maxlevel = nvisited = 0;
+	lastkey = -1;
+	twalk(root, walk);
+	TEST(nvisited == n);
+}
+
+int
+main(void)
+{
+	void *root = NULL, *r;
+	long i, k;
+	int n, it;
+
+	/* Ascending inserts: an unbalanced tree would be NKEYS deep.  */
+	for (i = 0; i < NKEYS; i++) {
+		r = tsearch((void *)i, &root, cmp_long);
+		TEST(r != NULL && *(long *)r == i);
+		present[i] = 1;
+	}
+	TEST(tsearch((void *)0L, &root, cmp_long) == tfind((void *)0L,
+	    &root, cmp_long));
+	check(root, NKEYS);
+	TEST(maxlevel < 18);		/* 1.44 * log2(4096) */
+
+	/* Delete every other key, then the rest in descending order.  */
+	for (i = 0; i < NKEYS; i += 2) {
+		TEST(tdelete((void *)i, &root, cmp_long) != NULL);
+		present[i] = 0;
+	}
+	TEST(tdelete((void *)0L, &root, cmp_long) == NULL);
+	check(root, NKEYS / 2);
+	for (i = NKEYS - 1; i > 0; i -= 2) {
+		TEST(tdelete((void *)i, &root, cmp_long) != NULL);
+		present[i] = 0;
+	}
+	TEST(root == NULL);
+
+	/* Random mix of inserts and deletes.  */
+	srand(1);
+	for (n = 0, it = 0; it < 100000; it++) {
+		k = rand() % NKEYS;
+		if (rand() % 3) {
+			TEST(*(long *)tsearch((void *)k, &root, cmp_long) == k);
+			n += !present[k];
+			present[k] = 1;
+		} else {
+			r = tdelete((void *)k, &root, cmp_long);
+			TEST((r != NULL) == present[k]);
+			n -= present[k];
+			present[k] = 0;
+		}
+		TEST((tfind((void *)k, &root, cmp_long) != NULL) == present[k]);
+		if (it % 1000 == 0)
+			check(root, n);
+	}
+	check(root, n);
+	TEST(maxlevel < 18);
+	tdestroy(root, nofree);
+	return 0;
+}
+#endif
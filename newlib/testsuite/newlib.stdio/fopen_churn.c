@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for reusing FILEs.  Many streams are opened, most of
+ * them closed again in a scattered order, and more opened and closed
+ * over and over: fflush(NULL) must still reach each stream left open,
+ * and a FILE just freed must be the one handed out next.
+ *
+ * Built with -DBENCH it instead prints how long an fmemopen()/fclose()
+ * pair takes with many streams open, and fflush(NULL) with few open
+ * after many were.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#ifdef BENCH
+#define PAIRS	100000
+#define MANY	10000
+
+static char buf[64];
+static FILE *fp[MANY];
+
+static double
+seconds(struct timespec *t0)
+{
+	struct timespec t1;
+
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return ((t1.tv_sec - t0->tv_sec) + (t1.tv_nsec - t0->tv_nsec) * 1e-9);
+}
+
+int
+main(void)
+{
+	struct timespec t0;
+	FILE *f;
+	long i;
+	int k;
+
+	for (k = 0; k < MANY; k++) {
+		fp[k] = fmemopen(buf, sizeof buf, "r");
+		TEST(fp[k] != NULL);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < PAIRS; i++) {
+		f = fmemopen(buf, sizeof buf, "r");
+		TEST(f != NULL);
+		TEST(fclose(f) == 0);
+	}
+	printf("fmemopen/fclose with %d streams open: %6.0f ns\n",
+	    MANY, seconds(&t0) * 1e9 / PAIRS);
+
+	for (k = 10; k < MANY; k++)
+		TEST(fclose(fp[k]) == 0);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < PAIRS / 100; i++)
+		TEST(fflush(NULL) == 0);
+	printf("fflush(NULL) with 10 of %d streams left open: %6.0f ns\n",
+	    MANY, seconds(&t0) * 1e9 / (PAIRS / 100));
+	return 0;
+}
+#else
+#define NAME		"fopen_churn.tmp"
+#define NSTREAMS	200
+#define KEEP(k)		((k) % 7 == 3)
+
+static FILE *fp[NSTREAMS];
+
+/* Check that NAME holds one line "stream K" for each K that WANT
+   returns nonzero for, and nothing else.  */
+static void
+check(int (*want)(int))
+{
+	char seen[NSTREAMS], line[64];
+	FILE *f;
+	int k;
+
+	memset(seen, 0, sizeof seen);
+	f = fopen(NAME, "r");
+	TEST(f != NULL);
+	while (fgets(line, sizeof line, f) != NULL) {
+		TEST(sscanf(line, "stream %d\n", &k) == 1);
+		TEST(k >= 0 && k < NSTREAMS && want(k) && !seen[k]);
+		seen[k] = 1;
+	}
+	TEST(feof(f));
+	TEST(fclose(f) == 0);
+	for (k = 0; k < NSTREAMS; k++)
+		TEST(seen[k] == (want(k) != 0));
+}
+
+static int
+closed(int k)
+{
+	return (!KEEP(k));
+}
+
+static int
+all(int k)
+{
+	return (1);
+}
+
+int
+main(void)
+{
+	FILE *f, *g;
+	int k, i;
+
+	remove(NAME);
+	for (k = 0; k < NSTREAMS; k++) {
+		fp[k] = fopen(NAME, "a");
+		TEST(fp[k] != NULL);
+		TEST(fprintf(fp[k], "stream %d\n", k) > 0);
+	}
+	/* Close most of them, from both ends towards the middle.  */
+	for (k = 0; k < NSTREAMS / 2; k++) {
+		if (!KEEP(k))
+			TEST(fclose(fp[k]) == 0);
+		if (!KEEP(NSTREAMS - 1 - k))
+			TEST(fclose(fp[NSTREAMS - 1 - k]) == 0);
+	}
+	check(closed);
+
+	/* Churn, with streams closed both in and out of order.  */
+	f = fmemopen(NULL, 64, "w+");
+	TEST(f != NULL);
+	for (i = 0; i < 10000; i++) {
+		g = fmemopen(NULL, 64, "w+");
+		TEST(g != NULL);
+		TEST(fputs("x", g) >= 0);
+		if (i & 1) {
+			TEST(fclose(f) == 0);
+			f = g;
+		} else
+			TEST(fclose(g) == 0);
+		/* The FILE just freed is the first free one.  */
+		g = fmemopen(NULL, 64, "w+");
+		TEST(g != NULL);
+		TEST(fclose(g) == 0);
+		TEST(fmemopen(NULL, 64, "w+") == g);
+		TEST(fclose(g) == 0);
+	}
+	TEST(fclose(f) == 0);
+
+	TEST(fflush(NULL) == 0);
+	check(all);
+	for (k = 0; k < NSTREAMS; k++)
+		if (KEEP(k))
+			TEST(fclose(fp[k]) == 0);
+	remove(NAME);
+	return 0;
+}
+#endif
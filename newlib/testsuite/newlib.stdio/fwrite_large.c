@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for writes that are larger than the stream buffer:
+ * fwrite(), fputs() and fprintf() with a long %s, mixed with small
+ * writes still sitting in the buffer, must put every byte in the file
+ * in order, with the stream fully buffered, line buffered or
+ * unbuffered, and in append mode, from fopen() and fopen64() and on
+ * stderr.
+ *
+ * Built with -DBENCH it instead prints how fast fprintf() writes a
+ * long string with a short prefix, buffered and unbuffered.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#define NAME	"fwrite_large.tmp"
+#define BIG	(3 * BUFSIZ + 123)
+
+static char big[BIG + 1];
+
+#ifdef BENCH
+#define ROUNDS	20000
+
+static double
+mb_per_sec(int mode)
+{
+	struct timespec t0, t1;
+	FILE *fp;
+	int i;
+
+	fp = fopen(NAME, "w");
+	TEST(fp != NULL);
+	TEST(setvbuf(fp, NULL, mode, BUFSIZ) == 0);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < ROUNDS; i++)
+		TEST(fprintf(fp, "%d: %s\n", i, big) > BIG);
+	TEST(fclose(fp) == 0);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return ((double)ROUNDS * BIG / 1e6 / ((t1.tv_sec - t0.tv_sec) +
+	    (t1.tv_nsec - t0.tv_nsec) * 1e-9));
+}
+
+int
+main(void)
+{
+	memset(big, 'x', BIG);
+	printf("fprintf %d-byte %%s: buffered %8.0f MB/s, unbuffered %8.0f MB/s\n",
+	    BIG, mb_per_sec(_IOFBF), mb_per_sec(_IONBF));
+	remove(NAME);
+	return 0;
+}
+#else
+static char want[16 * BIG];
+static char got[16 * BIG];
+
+/* Write a mix of small and large pieces to FP, and the same to WANT.  */
+static size_t
+write_mix(FILE *fp)
+{
+	size_t n = 0;
+	int i;
+
+	for (i = 0; i < 6; i++) {
+		TEST(fputs("ab", fp) >= 0);
+		memcpy(want + n, "ab", 2);
+		n += 2;
+		TEST(fwrite(big, 1, BIG - i * BUFSIZ / 3, fp) ==
+		    BIG - i * BUFSIZ / 3);
+		memcpy(want + n, big, BIG - i * BUFSIZ / 3);
+		n += BIG - i * BUFSIZ / 3;
+		TEST(fprintf(fp, "<%d%s>\n", i, big + BUFSIZ * i / 2) ==
+		    BIG - BUFSIZ * i / 2 + 4);
+		n += sprintf(want + n, "<%d%s>\n", i, big + BUFSIZ * i / 2);
+	}
+	return (n);
+}
+
+/* That the file holds the first N bytes of WANT and nothing else.  */
+static void
+compare(size_t n)
+{
+	FILE *fp;
+
+	fp = fopen(NAME, "r");
+	TEST(fp != NULL);
+	TEST(fread(got, 1, sizeof got, fp) == n);
+	TEST(memcmp(got, want, n) == 0);
+	TEST(fclose(fp) == 0);
+}
+
+static void
+check(FILE *(*open_fn)(const char *, const char *), const char *mode,
+    int buffering, size_t size)
+{
+	size_t n, before = 0;
+	FILE *fp;
+
+	if (*mode == 'a') {
+		fp = open_fn(NAME, "w");
+		TEST(fp != NULL && fputs("12345", fp) >= 0 && fclose(fp) == 0);
+		before = 5;
+	}
+	fp = open_fn(NAME, mode);
+	TEST(fp != NULL);
+	TEST(setvbuf(fp, NULL, buffering, size) == 0);
+	n = before + write_mix(fp);
+	/* An append stream writes at the end whatever the position.  */
+	if (*mode == 'a')
+		TEST(fseek(fp, 0, SEEK_SET) == 0);
+	TEST(fputs("end", fp) >= 0);
+	TEST(fclose(fp) == 0);
+
+	/* The write_mix part lands after the prefix in WANT.  */
+	if (before != 0)
+		memmove(want + before, want, n - before);
+	memcpy(want, "12345", before);
+	memcpy(want + n, "end", 3);
+	n += 3;
+	compare(n);
+}
+
+#ifdef __linux__
+/* stderr, unbuffered as it starts out, with its descriptor on the file. */
+static void
+check_stderr(void)
+{
+	size_t n;
+	int fd, saved;
+
+	fd = open(NAME, O_WRONLY | O_CREAT | O_TRUNC, 0666);
+	saved = dup(2);
+	TEST(fd >= 0 && saved >= 0 && dup2(fd, 2) == 2 && close(fd) == 0);
+	n = write_mix(stderr);
+	TEST(fflush(stderr) == 0);
+	TEST(dup2(saved, 2) == 2 && close(saved) == 0);
+	compare(n);
+}
+#endif
+
+int
+main(void)
+{
+	int i;
+
+	for (i = 0; i < BIG; i++)
+		big[i] = 'a' + i % 23;
+	check(fopen, "w", _IOFBF, BUFSIZ);
+	check(fopen, "w", _IOFBF, 100);
+	check(fopen, "w", _IOFBF, 8 * BIG);
+	check(fopen, "w", _IOLBF, BUFSIZ);
+	check(fopen, "w", _IONBF, 0);
+	check(fopen, "a", _IOFBF, BUFSIZ);
+	check(fopen, "a", _IONBF, 0);
+#ifdef __LARGE64_FILES
+	check(fopen64, "w", _IOFBF, BUFSIZ);
+	check(fopen64, "w", _IONBF, 0);
+	check(fopen64, "a", _IOFBF, BUFSIZ);
+	check(fopen64, "a", _IONBF, 0);
+#endif
+#ifdef __linux__
+	check_stderr();
+#endif
+	remove(NAME);
+	return 0;
+}
+#endif
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for __getline() and __getdelim(): lines shorter and much
+ * longer than the stdio buffer, empty lines, embedded NULs, a last
+ * line without its delimiter, pushed back characters and unbuffered
+ * streams must all come back exactly as written.
+ *
+ * Built with -DBENCH it instead prints how many lines per second
+ * getline() reads, for short and for long lines, next to a loop that
+ * takes the same lines one character at a time.
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+/* stdio.h declares these only under their reserved names.  */
+#define getdelim	__getdelim
+#define getline		__getline
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+/* Line I of the test file: I characters, none of them a newline.  */
+static void
+make_line(char *s, int i)
+{
+	int j;
+
+	for (j = 0; j < i; j++)
+		s[j] = 'a' + (i + j) % 26;
+}
+
+#ifdef BENCH
+/* getline() as a getc() loop.  */
+static ssize_t
+getc_line(char **bufp, size_t *n, FILE *fp)
+{
+	size_t pos = 0;
+	int c;
+
+	while ((c = getc_unlocked(fp)) != EOF) {
+		if (pos + 2 > *n) {
+			*n = *n ? 2 * *n : 128;
+			*bufp = realloc(*bufp, *n);
+		}
+		(*bufp)[pos++] = c;
+		if (c == '\n')
+			break;
+	}
+	if (pos == 0)
+		return (-1);
+	(*bufp)[pos] = '\0';
+	return (pos);
+}
+
+static double
+lines_per_sec(FILE *fp, ssize_t (*get)(char **, size_t *, FILE *))
+{
+	struct timespec t0, t1;
+	char *buf = NULL;
+	size_t n = 0;
+	long lines = 0;
+
+	rewind(fp);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	while (get(&buf, &n, fp) > 0)
+		lines++;
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	free(buf);
+	return (lines / ((t1.tv_sec - t0.tv_sec) +
+	    (t1.tv_nsec - t0.tv_nsec) * 1e-9));
+}
+
+static void
+bench(int len, int count)
+{
+	char *line;
+	FILE *fp;
+	int i;
+
+	line = malloc(len + 1);
+	TEST(line != NULL);
+	make_line(line, len);
+	line[len] = '\n';
+	fp = tmpfile();
+	TEST(fp != NULL);
+	for (i = 0; i < count; i++)
+		TEST(fwrite(line, 1, len + 1, fp) == len + 1);
+	printf("%5d-byte lines: getline %10.0f/s, getc loop %10.0f/s\n", len,
+	    lines_per_sec(fp, getline), lines_per_sec(fp, getc_line));
+	fclose(fp);
+	free(line);
+}
+
+int
+main(void)
+{
+	bench(40, 500000);
+	bench(4000, 5000);
+	return 0;
+}
+#else
+#define LINES	3000
+
+static void
+check_file(FILE *fp)
+{
+	char *buf = NULL, *want;
+	size_t n = 0;
+	ssize_t len;
+	int i;
+
+	want = malloc(LINES + 1);
+	TEST(want != NULL);
+	rewind(fp);
+	for (i = 0; i < LINES; i++) {
+		len = getline(&buf, &n, fp);
+		TEST(len == i + 1);
+		make_line(want, i);
+		want[i] = '\n';
+		TEST(memcmp(buf, want, i + 1) == 0 && buf[i + 1] == '\0');
+		TEST(n > (size_t)len);
+	}
+
+	/* The embedded NUL, then the last line, which has no newline.  */
+	TEST(getline(&buf, &n, fp) == 4 && memcmp(buf, "a\0b\n", 5) == 0);
+	TEST(getline(&buf, &n, fp) == 4 && strcmp(buf, "last") == 0);
+	TEST(getline(&buf, &n, fp) == -1 && feof(fp));
+
+	/* Other delimiters, and characters pushed back by ungetc().  */
+	rewind(fp);
+	TEST(getdelim(&buf, &n, 'c', fp) == 4 && strcmp(buf, "\nb\nc") == 0);
+	TEST(ungetc('x', fp) == 'x');
+	TEST(getdelim(&buf, &n, 'd', fp) == 2 && strcmp(buf, "xd") == 0);
+	TEST(ungetc('y', fp) == 'y');
+	TEST(getline(&buf, &n, fp) == 2 && strcmp(buf, "y\n") == 0);
+	free(buf);
+	free(want);
+}
+
+int
+main(void)
+{
+	char *buf, *line;
+	size_t n;
+	FILE *fp;
+	int i;
+
+	line = malloc(LINES);
+	TEST(line != NULL);
+	fp = tmpfile();
+	TEST(fp != NULL);
+	for (i = 0; i < LINES; i++) {
+		make_line(line, i);
+		TEST(fwrite(line, 1, i, fp) == i && putc('\n', fp) == '\n');
+	}
+	TEST(fwrite("a\0b\nlast", 1, 8, fp) == 8);
+	TEST(fflush(fp) == 0);
+	check_file(fp);
+
+	/* The same with a buffer far smaller than the lines...  */
+	TEST(setvbuf(fp, NULL, _IOFBF, 16) == 0);
+	check_file(fp);
+	/* ...and with none at all.  */
+	TEST(setvbuf(fp, NULL, _IONBF, 0) == 0);
+	check_file(fp);
+
+	/* A buffer given by the caller is used as it is while it fits.  */
+	n = 1000;
+	buf = malloc(n);
+	TEST(buf != NULL);
+	rewind(fp);
+	TEST(getline(&buf, &n, fp) == 1 && n == 1000);
+	free(buf);
+
+	buf = NULL;
+	TEST(getline(&buf, NULL, fp) == -1 && errno == EINVAL);
+	TEST(getline(NULL, &n, fp) == -1 && errno == EINVAL);
+	fclose(fp);
+	free(line);
+	return 0;
+}
+#endif
@@ -0,0 +1,200 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for fopen() mode "rm": a file read through memory
+ * mappings must give back exactly what the same file gives through
+ * "r", whether it is taken with fread(), fgets(), getc(), __getline()
+ * or fscanf(), across fseek(), ftell(), rewind() and ungetc(), and
+ * also when it is far larger than the stdio buffer, and through
+ * fopen64() too where there is one.  Targets that do not map files
+ * treat "rm" as "r", so the test holds on all of them.
+ *
+ * Built with -DBENCH it instead prints how fast a large file is read
+ * through fread() and through getc() with either mode.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#define NAME	"mmap_read.tmp"
+
+/* Write the test file, numbered lines of varying length, and return
+   its contents.  */
+static char *
+make_file(long size)
+{
+	char *data;
+	FILE *fp;
+	long i;
+	int n;
+
+	data = malloc(size);
+	TEST(data != NULL);
+	for (i = 0, n = 0; i < size; n++) {
+		i += snprintf(data + i, size - i, "%d %.*s\n", n, n % 97,
+		    "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz"
+		    "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz");
+		if (i >= size)
+			i = size;
+	}
+	fp = fopen(NAME, "wb");
+	TEST(fp != NULL);
+	TEST(fwrite(data, 1, size, fp) == size);
+	TEST(fclose(fp) == 0);
+	return (data);
+}
+
+#ifdef BENCH
+#define SIZE	(64L * 1024 * 1024)
+
+static double
+mb_per_sec(const char *mode, int bytewise)
+{
+	static char buf[65536];
+	struct timespec t0, t1;
+	unsigned long sum = 0;
+	long total = 0;
+	size_t n;
+	FILE *fp;
+	int c;
+
+	fp = fopen(NAME, mode);
+	TEST(fp != NULL);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	if (bytewise)
+		while ((c = getc(fp)) != EOF) {
+			sum += c;
+			total++;
+		}
+	else
+		while ((n = fread(buf, 1, sizeof buf, fp)) > 0) {
+			sum += buf[n - 1];
+			total += n;
+		}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	TEST(total == SIZE && sum != 0);
+	fclose(fp);
+	return (total / 1e6 / ((t1.tv_sec - t0.tv_sec) +
+	    (t1.tv_nsec - t0.tv_nsec) * 1e-9));
+}
+
+int
+main(void)
+{
+	free(make_file(SIZE));
+	printf("fread: \"r\" %8.0f MB/s, \"rm\" %8.0f MB/s\n",
+	    mb_per_sec("r", 0), mb_per_sec("rm", 0));
+	printf("getc:  \"r\" %8.0f MB/s, \"rm\" %8.0f MB/s\n",
+	    mb_per_sec("r", 1), mb_per_sec("rm", 1));
+	remove(NAME);
+	return 0;
+}
+#else
+/* Larger than a mapping window, so reads have to move on to the next.  */
+#define SIZE	(9L * 1024 * 1024 + 12345)
+
+static void
+check_file(FILE *(*open)(const char *, const char *), const char *mode,
+    const char *data)
+{
+	static char buf[100000];
+	char *line = NULL;
+	size_t len = 0, n;
+	long pos;
+	int i, num;
+	FILE *fp;
+
+	fp = open(NAME, mode);
+	TEST(fp != NULL);
+
+	/* All of it in pieces of awkward sizes.  */
+	for (pos = 0; pos < SIZE; pos += n) {
+		n = fread(buf, 1, 1 + pos % sizeof buf, fp);
+		TEST(n > 0 && memcmp(buf, data + pos, n) == 0);
+	}
+	TEST(pos == SIZE && fread(buf, 1, 1, fp) == 0 && feof(fp));
+	TEST(ftell(fp) == SIZE);
+
+	/* Lines, numbers and characters.  */
+	rewind(fp);
+	TEST(fgets(buf, sizeof buf, fp) != NULL && strcmp(buf, "0 \n") == 0);
+	TEST(__getline(&line, &len, fp) == 4 && strcmp(line, "1 a\n") == 0);
+	TEST(fscanf(fp, "%d", &num) == 1 && num == 2);
+	TEST(getc(fp) == ' ' && ftell(fp) == 9);
+	TEST(ungetc('x', fp) == 'x' && getc(fp) == 'x');
+	TEST(getc(fp) == 'a' && getc(fp) == 'b');
+
+	/* Seeks forwards and backwards, within a window and across them.  */
+	for (i = 0; i < 200; i++) {
+		pos = (i * 7919L * 1031) % SIZE;
+		TEST(fseek(fp, pos, SEEK_SET) == 0 && ftell(fp) == pos);
+		TEST(getc(fp) == (unsigned char)data[pos]);
+		if (pos + 5000 < SIZE) {
+			TEST(fseek(fp, 4999, SEEK_CUR) == 0);
+			TEST(getc(fp) == (unsigned char)data[pos + 5000]);
+		}
+	}
+	TEST(fseek(fp, -3, SEEK_END) == 0 && ftell(fp) == SIZE - 3);
+	TEST(fread(buf, 1, 10, fp) == 3 && memcmp(buf, data + SIZE - 3, 3) == 0);
+
+	/* After the end has been reached, reading still works after a seek.  */
+	TEST(fseek(fp, 1, SEEK_SET) == 0 && getc(fp) == data[1]);
+	free(line);
+	TEST(fclose(fp) == 0);
+}
+
+int
+main(void)
+{
+	char *data;
+	long pos;
+	FILE *fp;
+	int c;
+
+	data = make_file(SIZE);
+	check_file(fopen, "r", data);
+	check_file(fopen, "rm", data);
+	check_file(fopen, "rbm", data);
+#ifdef __LARGE64_FILES
+	check_file(fopen64, "rm", data);
+#endif
+
+	/* Read by getc() alone, from start to end.  */
+	fp = fopen(NAME, "rm");
+	TEST(fp != NULL);
+	pos = 0;
+	while ((c = getc(fp)) != EOF)
+		TEST(c == (unsigned char)data[pos++]);
+	TEST(pos == SIZE);
+	fclose(fp);
+
+	/* An empty file.  */
+	fp = fopen(NAME, "wb");
+	TEST(fp != NULL && fclose(fp) == 0);
+	fp = fopen(NAME, "rm");
+	TEST(fp != NULL && getc(fp) == EOF && feof(fp));
+	fclose(fp);
+
+	remove(NAME);
+	free(data);
+	return 0;
+}
+#endif
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for %e, %f and %g of doubles: known conversions that
+ * stress rounding (exact ties, carries into a new digit, integers cut
+ * short, subnormals and the ends of the range), and random doubles
+ * whose %.17g must read back unchanged and agree with ecvt() and
+ * fcvt().
+ *
+ * Built with -DBENCH it instead prints the time of one snprintf() for
+ * a few common formats.
+ */
+
+#include <float.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* A random finite double, spread over the whole exponent range.  */
+static double
+random_double(void)
+{
+	union {
+		double d;
+		unsigned long long u;
+	} x;
+
+	do {
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		x.u = seed;
+	} while ((x.u >> 52 & 0x7ff) == 0x7ff);
+	return (x.d);
+}
+
+#ifdef BENCH
+#define ROUNDS	200000
+
+static void
+bench(const char *fmt)
+{
+	struct timespec t0, t1;
+	char buf[64];
+	double d;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < ROUNDS; i++) {
+		d = random_double();
+		snprintf(buf, sizeof buf, fmt, d);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	printf("%-6s %8.1f ns\n", fmt, ((t1.tv_sec - t0.tv_sec) * 1e9 +
+	    (t1.tv_nsec - t0.tv_nsec)) / ROUNDS);
+}
+
+int
+main(void)
+{
+	bench("%.17g");
+	bench("%g");
+	bench("%e");
+	bench("%.3f");
+	return 0;
+}
+#else
+static const struct {
+	const char *fmt;
+	double d;
+	const char *out;
+} known[] = {
+	{ "%.0f", 0.5, "0" },
+	{ "%.0f", 1.5, "2" },
+	{ "%.0f", 2.5, "2" },
+	{ "%.0f", 9.5, "10" },
+	{ "%.1f", 0.25, "0.2" },
+	{ "%.1f", 0.35, "0.3" },
+	{ "%.2f", 1.005, "1.00" },
+	{ "%.2f", 0.004, "0.00" },
+	{ "%.2f", 0.006, "0.01" },
+	{ "%.3f", 999.9996, "1000.000" },
+	{ "%f", 1e-7, "0.000000" },
+	{ "%f", 123456789.125, "123456789.125000" },
+	{ "%f", 1e15, "1000000000000000.000000" },
+	{ "%e", 0.0, "0.000000e+00" },
+	{ "%.2e", 12345.0, "1.23e+04" },
+	{ "%.2e", 12050.0, "1.20e+04" },
+	{ "%.2e", 12150.0, "1.22e+04" },
+	{ "%.3e", 729905.0, "7.299e+05" },
+	{ "%.0e", 25.0, "2e+01" },
+	{ "%.0e", 35.0, "4e+01" },
+	{ "%.16e", 1e23, "9.9999999999999992e+22" },
+	{ "%.17g", 0.1, "0.10000000000000001" },
+	{ "%.17g", 1e23, "9.9999999999999992e+22" },
+	{ "%.17g", 9007199254740993.0, "9007199254740992" },
+	{ "%.17g", DBL_MAX, "1.7976931348623157e+308" },
+	{ "%.17g", DBL_MIN, "2.2250738585072014e-308" },
+	{ "%.17g", 4.9406564584124654e-324, "4.9406564584124654e-324" },
+	{ "%g", 100.0, "100" },
+	{ "%g", 1e-5, "1e-05" },
+	{ "%g", 123456789.0, "1.23457e+08" },
+	{ "%g", 0.0001234565, "0.000123457" },
+	{ "%#g", 1.0, "1.00000" },
+	{ "%.20e", 1.0 / 3, "3.33333333333333314830e-01" },
+	{ "%.30f", 0.1, "0.100000000000000005551115123126" },
+};
+
+int
+main(void)
+{
+	char buf[400], *p;
+	double d;
+	int i, decpt, sign;
+
+	for (i = 0; i < sizeof known / sizeof known[0]; i++) {
+		snprintf(buf, sizeof buf, known[i].fmt, known[i].d);
+		if (strcmp(buf, known[i].out) != 0)
+			printf("%s of %a: \"%s\", expected \"%s\"\n",
+			    known[i].fmt, known[i].d, buf, known[i].out);
+		TEST(strcmp(buf, known[i].out) == 0);
+	}
+
+	for (i = 0; i < 100000; i++) {
+		d = random_double();
+		snprintf(buf, sizeof buf, "%.17g", d);
+		TEST(strtod(buf, NULL) == d);
+
+		/* The same digits, without the exponent.  */
+		snprintf(buf, sizeof buf, "%.16e", d < 0 ? -d : d);
+		p = ecvt(d, 17, &decpt, &sign);
+		TEST(sign == (d < 0));
+		TEST(buf[0] == p[0] && strncmp(buf + 2, p + 1, 16) == 0);
+		TEST(d == 0 || atoi(strchr(buf, 'e') + 1) == decpt - 1);
+
+		if (d > -1e9 && d < 1e9) {
+			snprintf(buf, sizeof buf, "%.6f", d < 0 ? -d : d);
+			p = fcvt(d, 6, &decpt, &sign);
+			TEST(sign == (d < 0));
+			if (decpt > 0)
+				TEST(strncmp(buf, p, decpt) == 0 &&
+				    strcmp(buf + decpt + 1, p + decpt) == 0);
+		}
+	}
+	return 0;
+}
+#endif
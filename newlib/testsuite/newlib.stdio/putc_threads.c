@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for stream locking before and after a process becomes
+ * multi-threaded.  A file is written with putc() and fputs() by the
+ * only thread, then by several threads sharing one stream: every line
+ * must come out whole, whether or not the library locked the stream
+ * while there was a single thread.
+ *
+ * Built with -DBENCH it instead prints how fast fputc() is before the
+ * first thread is started and after.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdio_ext.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef _POSIX_THREADS
+#include <pthread.h>
+#endif
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#define NTHREADS	4
+
+static FILE *fp;
+
+#ifdef _POSIX_THREADS
+static void *
+nothing(void *arg)
+{
+	return (arg);
+}
+#endif
+
+/* Start a thread and wait for it, so that the process has had two.  */
+static void
+go_threaded(void)
+{
+#ifdef _POSIX_THREADS
+	pthread_t tid;
+
+	TEST(pthread_create(&tid, NULL, nothing, NULL) == 0);
+	TEST(pthread_join(tid, NULL) == 0);
+#endif
+}
+
+#ifdef BENCH
+#define CHARS	(64 * 1024 * 1024)
+
+static double
+mchars_per_sec(void)
+{
+	struct timespec t0, t1;
+	long i;
+
+	rewind(fp);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < CHARS; i++)
+		fputc('a' + (i & 15), fp);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return (CHARS / 1e6 / ((t1.tv_sec - t0.tv_sec) +
+	    (t1.tv_nsec - t0.tv_nsec) * 1e-9));
+}
+
+int
+main(void)
+{
+	double single;
+
+	fp = tmpfile();
+	TEST(fp != NULL);
+	single = mchars_per_sec();
+	go_threaded();
+	printf("fputc: one thread %6.0f M/s, after another started %6.0f M/s\n",
+	    single, mchars_per_sec());
+	fclose(fp);
+	return 0;
+}
+#else
+#define LINES	2000
+
+/* Write LINES numbered lines for thread K, a character at a time for
+   every other one.  */
+static void *
+writer(void *arg)
+{
+	char line[64];
+	int k = (int)(long)arg;
+	int i, j;
+
+	for (i = 0; i < LINES; i++) {
+		snprintf(line, sizeof line, "thread %d line %d\n", k, i);
+		if (i & 1) {
+			TEST(fputs(line, fp) >= 0);
+			continue;
+		}
+		/* Characters from another thread may come in between.  */
+		flockfile(fp);
+		for (j = 0; line[j] != '\0'; j++)
+			TEST(putc(line[j], fp) == line[j]);
+		funlockfile(fp);
+	}
+	return (NULL);
+}
+
+/* Check that the file holds LINES lines from each of N writers.  */
+static void
+check(int n)
+{
+	char line[64];
+	int next[NTHREADS];
+	int k, i;
+
+	memset(next, 0, sizeof next);
+	rewind(fp);
+	while (fgets(line, sizeof line, fp) != NULL) {
+		TEST(sscanf(line, "thread %d line %d\n", &k, &i) == 2);
+		TEST(k >= 0 && k < n && i == next[k]);
+		next[k]++;
+	}
+	for (k = 0; k < n; k++)
+		TEST(next[k] == LINES);
+}
+
+int
+main(void)
+{
+#ifdef _POSIX_THREADS
+	pthread_t tid[NTHREADS];
+#endif
+	int k;
+
+	fp = tmpfile();
+	TEST(fp != NULL);
+	TEST(__fsetlocking(fp, FSETLOCKING_QUERY) == FSETLOCKING_INTERNAL);
+	writer((void *)0L);
+	check(1);
+
+	go_threaded();
+	TEST(__fsetlocking(fp, FSETLOCKING_QUERY) == FSETLOCKING_INTERNAL);
+	rewind(fp);
+	TEST(setvbuf(fp, NULL, _IOFBF, 100) == 0);
+#ifdef _POSIX_THREADS
+	for (k = 0; k < NTHREADS; k++)
+		TEST(pthread_create(&tid[k], NULL, writer, (void *)(long)k) == 0);
+	for (k = 0; k < NTHREADS; k++)
+		TEST(pthread_join(tid[k], NULL) == 0);
+#else
+	for (k = 0; k < NTHREADS; k++)
+		writer((void *)(long)k);
+#endif
+	TEST(fflush(fp) == 0);
+	check(NTHREADS);
+	fclose(fp);
+	return 0;
+}
+#endif
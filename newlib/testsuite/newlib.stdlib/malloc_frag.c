@@ -0,0 +1,139 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for malloc() and free() on a fragmented heap.  Every
+ * other block of a run is freed, leaving that many small holes: blocks
+ * that fit the holes must not grow the heap, and once the run is freed
+ * completely its holes must merge again into room for one big block.
+ *
+ * Built with -DBENCH it instead prints the time of a malloc/free pair
+ * against the number of holes, for a size that fits them and for one
+ * that does not.
+ */
+
+#include <malloc.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#define MAXHOLES	16384
+#define HOLE		24
+
+static char *blk[2 * MAXHOLES];
+
+/* Allocate 2 * n blocks and free every other one.  */
+static void
+fragment(int n)
+{
+	int i;
+
+	for (i = 0; i < 2 * n; i++) {
+		blk[i] = malloc(HOLE);
+		TEST(blk[i] != NULL);
+		memset(blk[i], i & 0xff, HOLE);
+	}
+	for (i = 0; i < 2 * n; i += 2) {
+		free(blk[i]);
+		blk[i] = NULL;
+	}
+}
+
+static void
+release(int n)
+{
+	int i;
+
+	for (i = 0; i < 2 * n; i++)
+		free(blk[i]);
+}
+
+#ifdef BENCH
+#define PAIRS	20000
+
+static double
+pair_ns(size_t size)
+{
+	struct timespec t0, t1;
+	void *p;
+	int i;
+
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (i = 0; i < PAIRS; i++) {
+		p = malloc(size);
+		TEST(p != NULL);
+		free(p);
+	}
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) /
+	    PAIRS;
+}
+
+int
+main(void)
+{
+	int n;
+
+	printf("%8s %14s %14s\n", "holes", "fitting (ns)", "bigger (ns)");
+	for (n = 16; n <= MAXHOLES; n *= 4) {
+		fragment(n);
+		printf("%8d %14.1f %14.1f\n", n, pair_ns(HOLE), pair_ns(4 * HOLE));
+		release(n);
+	}
+	return 0;
+}
+#else
+int
+main(void)
+{
+	size_t peak;
+	char *p;
+	int i, n = 1000;
+
+	fragment(n);
+	peak = mallinfo().arena;
+
+	/* Each of these fits a hole.  */
+	for (i = 0; i < 2 * n; i += 2) {
+		blk[i] = malloc(HOLE);
+		TEST(blk[i] != NULL);
+		memset(blk[i], i & 0xff, HOLE);
+	}
+	TEST(mallinfo().arena == peak);
+	for (i = 0; i < 2 * n; i++)
+		TEST(blk[i][0] == (char)i && blk[i][HOLE - 1] == (char)i);
+
+	/* Free again in a scattered order; the holes must merge.  */
+	for (i = 0; i < 2 * n; i += 2) {
+		free(blk[i]);
+		blk[i] = NULL;
+	}
+	for (i = 2 * n - 1; i > 0; i -= 4) {
+		free(blk[i]);
+		blk[i] = NULL;
+	}
+	release(n);
+	p = malloc(n * HOLE);
+	TEST(p != NULL);
+	memset(p, 0, n * HOLE);
+	TEST(mallinfo().arena <= peak);
+	free(p);
+	return 0;
+}
+#endif
@@ -0,0 +1,221 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for malloc() and free() under threads.  Each pattern
+ * checks that blocks keep their contents until freed:
+ *
+ *   same-thread:        every thread allocates and frees its own small
+ *                       blocks in a random order;
+ *   producer/consumer:  one thread allocates, another frees, so blocks
+ *                       end up in a thread cache other than their
+ *                       allocator's.
+ *
+ * Both run once with the default arena setup and once more after
+ * mallopt(M_ARENA_MAX) has asked for several arenas.
+ *
+ * Built with -DBENCH it runs many more iterations and prints the time
+ * each pattern takes.  On targets without POSIX threads the patterns
+ * run one after the other on the main thread.
+ */
+
+#include <malloc.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef _POSIX_THREADS
+#include <pthread.h>
+#endif
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+#ifdef BENCH
+#define ITERS	4000000
+#else
+#define ITERS	100000
+#endif
+#define NTHREADS	4
+#define NSLOTS	256
+#define QLEN	256
+
+static void *
+same_thread(void *arg)
+{
+	unsigned char *slot[NSLOTS];
+	size_t len[NSLOTS];
+	unsigned long s = (unsigned long)arg;
+	int i, k;
+
+	memset(slot, 0, sizeof slot);
+	for (i = 0; i < ITERS; i++) {
+		s = s * 1103515245 + 12345;
+		k = (s >> 8) % NSLOTS;
+		if (slot[k] != NULL) {
+			TEST(slot[k][0] == k && slot[k][len[k] - 1] == k);
+			free(slot[k]);
+			slot[k] = NULL;
+		} else {
+			/* Mostly small blocks, with the odd larger one.  */
+			len[k] = (s >> 16) % 16 ? 1 + (s >> 20) % 400 :
+			    1 + (s >> 20) % 8000;
+			slot[k] = malloc(len[k]);
+			TEST(slot[k] != NULL);
+			memset(slot[k], k, len[k]);
+		}
+	}
+	for (k = 0; k < NSLOTS; k++)
+		free(slot[k]);
+	return (NULL);
+}
+
+/* Single-producer, single-consumer ring of blocks.  */
+static int *queue[QLEN];
+static volatile unsigned int qhead, qtail;
+#ifdef _POSIX_THREADS
+static pthread_mutex_t qlock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t qcond = PTHREAD_COND_INITIALIZER;
+#endif
+
+static void *
+producer(void *arg)
+{
+	int i, *p;
+
+	for (i = 0; i < ITERS; i++) {
+		p = malloc(sizeof (int) + i % 300);
+		TEST(p != NULL);
+		*p = i;
+#ifdef _POSIX_THREADS
+		pthread_mutex_lock(&qlock);
+		while (qhead - qtail == QLEN)
+			pthread_cond_wait(&qcond, &qlock);
+		queue[qhead++ % QLEN] = p;
+		pthread_cond_broadcast(&qcond);
+		pthread_mutex_unlock(&qlock);
+#else
+		if (qhead - qtail == QLEN)
+			free(queue[qtail++ % QLEN]);
+		queue[qhead++ % QLEN] = p;
+#endif
+	}
+	return (NULL);
+}
+
+static void *
+consumer(void *arg)
+{
+	unsigned int n;
+	int i, *p;
+
+	for (i = 0; i < ITERS; i++) {
+#ifdef _POSIX_THREADS
+		pthread_mutex_lock(&qlock);
+		while (qhead == qtail)
+			pthread_cond_wait(&qcond, &qlock);
+		n = qtail;
+		p = queue[qtail++ % QLEN];
+		pthread_cond_broadcast(&qcond);
+		pthread_mutex_unlock(&qlock);
+#else
+		if (qhead == qtail)
+			break;
+		n = qtail;
+		p = queue[qtail++ % QLEN];
+#endif
+		/* Block n was filled in with n by the producer.  */
+		TEST(*p == (int)n);
+		free(p);
+	}
+	return (NULL);
+}
+
+#ifdef BENCH
+static double
+seconds(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec * 1e-9);
+}
+#endif
+
+static void
+run(const char *name)
+{
+#ifdef _POSIX_THREADS
+	pthread_t tid[NTHREADS];
+#endif
+	void *p;
+	int i;
+#ifdef BENCH
+	double t;
+
+	t = seconds();
+#endif
+
+#ifdef _POSIX_THREADS
+	for (i = 0; i < NTHREADS; i++)
+		TEST(pthread_create(&tid[i], NULL, same_thread,
+		    (void *)(long)(i + 1)) == 0);
+	for (i = 0; i < NTHREADS; i++)
+		TEST(pthread_join(tid[i], NULL) == 0);
+#else
+	for (i = 0; i < NTHREADS; i++)
+		same_thread((void *)(long)(i + 1));
+#endif
+#ifdef BENCH
+	printf("%s: same-thread, %d threads x %d: %.3fs\n", name, NTHREADS,
+	    ITERS, seconds() - t);
+	t = seconds();
+#endif
+
+	qhead = qtail = 0;
+#ifdef _POSIX_THREADS
+	TEST(pthread_create(&tid[0], NULL, producer, NULL) == 0);
+	TEST(pthread_create(&tid[1], NULL, consumer, NULL) == 0);
+	TEST(pthread_join(tid[0], NULL) == 0);
+	TEST(pthread_join(tid[1], NULL) == 0);
+#else
+	producer(NULL);
+	consumer(NULL);
+#endif
+#ifdef BENCH
+	printf("%s: producer/consumer x %d: %.3fs\n", name, ITERS,
+	    seconds() - t);
+#endif
+
+	/* The arena must still hand out large blocks afterwards.  */
+	p = malloc(1 << 20);
+	TEST(p != NULL);
+	memset(p, 0, 1 << 20);
+	free(p);
+}
+
+int
+main(void)
+{
+	run("one arena");
+
+	/* Only some targets have arenas; the others must refuse.  */
+	if (mallopt(M_ARENA_MAX, NTHREADS))
+		run("several arenas");
+	else
+		TEST(mallopt(M_ARENA_MAX, 1));
+	return 0;
+}
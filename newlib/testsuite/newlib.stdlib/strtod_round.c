@@ -0,0 +1,189 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/*
+ * Test program for strtod() and its relatives: known decimals that
+ * stress rounding (ties, the neighbours of ties, digits past the 19th,
+ * subnormals and the ends of the range), random doubles whose %.17g
+ * must read back unchanged through strtod(), wcstod() and sscanf(),
+ * and floats whose %.9g must read back unchanged through strtof().
+ * The floats are taken with a stride; built with -DEXHAUSTIVE every
+ * finite float is tried.
+ *
+ * Built with -DBENCH it instead prints the time strtod() takes for a
+ * few kinds of input.
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <math.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+#ifdef BENCH
+#include <time.h>
+#endif
+
+#define	TEST(e)	((e) ? (void)0 : testfail(__FILE__, __LINE__, #e))
+
+static void
+testfail(const char *file, unsigned long line, const char *expression)
+{
+	printf("%s:%lu: failed assertion `%s'\n", file, line, expression);
+	exit(1);
+}
+
+static unsigned long long seed = 88172645463325252ULL;
+
+/* A random finite double, spread over the whole exponent range.  */
+static double
+random_double(void)
+{
+	union {
+		double d;
+		unsigned long long u;
+	} x;
+
+	do {
+		seed ^= seed << 13;
+		seed ^= seed >> 7;
+		seed ^= seed << 17;
+		x.u = seed;
+	} while ((x.u >> 52 & 0x7ff) == 0x7ff);
+	return (x.d);
+}
+
+#ifdef BENCH
+#define NUMBERS	4096
+#define ROUNDS	100
+
+static char text[NUMBERS][32];
+
+static void
+bench(const char *name)
+{
+	struct timespec t0, t1;
+	size_t bytes = 0;
+	double ns;
+	int i, j;
+
+	for (i = 0; i < NUMBERS; i++)
+		bytes += strlen(text[i]);
+	clock_gettime(CLOCK_MONOTONIC, &t0);
+	for (j = 0; j < ROUNDS; j++)
+		for (i = 0; i < NUMBERS; i++)
+			strtod(text[i], NULL);
+	clock_gettime(CLOCK_MONOTONIC, &t1);
+	ns = (t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec);
+	printf("%-10s %8.1f ns %8.1f MB/s\n", name, ns / (NUMBERS * ROUNDS),
+	    bytes * ROUNDS * 1e3 / ns);
+}
+
+int
+main(void)
+{
+	int i;
+
+	for (i = 0; i < NUMBERS; i++)
+		snprintf(text[i], sizeof text[i], "%.17g", random_double());
+	bench("%.17g");
+	for (i = 0; i < NUMBERS; i++)
+		snprintf(text[i], sizeof text[i], "%g", random_double());
+	bench("%g");
+	/* Prices, as in a CSV file.  */
+	for (i = 0; i < NUMBERS; i++)
+		snprintf(text[i], sizeof text[i], "%d.%02d", i * 7919 % 10000,
+		    i % 100);
+	bench("prices");
+	return 0;
+}
+#else
+static const struct {
+	const char *in;
+	double d;
+} known[] = {
+	{ "0.1", 0.1 },
+	{ "3.14159", 3.14159 },
+	{ "000012.3400e1", 123.4 },
+	{ "9007199254740993", 9007199254740992.0 },
+	{ "9007199254740995", 9007199254740996.0 },
+	{ "9007199254740993.0000000000001", 9007199254740994.0 },
+	{ "4503599627370496.5", 4503599627370496.0 },
+	{ "4503599627370497.5", 4503599627370498.0 },
+	{ "1.00000000000000011102230246251565404236316680908203125", 1.0 },
+	{ "1.00000000000000011102230246251565404236316680908203126",
+	    1.0000000000000002 },
+	{ "1e23", 1e23 },
+	{ "8.98846567431158e307", 8.98846567431158e307 },
+	{ "1.7976931348623157e308", DBL_MAX },
+	{ "1.7976931348623158e308", DBL_MAX },
+	{ "2.2250738585072014e-308", DBL_MIN },
+	{ "2.2250738585072011e-308", 2.2250738585072009e-308 },
+	{ "4.9406564584124654e-324", 4.9406564584124654e-324 },
+	{ "123456789012345678901234567890", 1.2345678901234568e29 },
+	{ "0.000000000000000000000000000123", 1.23e-28 },
+	{ "7.2057594037927933e16", 72057594037927936.0 },
+	{ "1e-300", 1e-300 },
+	{ "5e-324", 4.9406564584124654e-324 },
+};
+
+int
+main(void)
+{
+	union {
+		float f;
+		unsigned int u;
+	} x;
+	unsigned int step;
+	wchar_t wbuf[40];
+	char buf[40], *end;
+	double d, r;
+	float f;
+	int i;
+
+	for (i = 0; i < sizeof known / sizeof known[0]; i++) {
+		d = strtod(known[i].in, NULL);
+		if (d != known[i].d)
+			printf("strtod(\"%s\") is %a, expected %a\n",
+			    known[i].in, d, known[i].d);
+		TEST(d == known[i].d);
+	}
+
+	errno = 0;
+	TEST(strtod("1e309", NULL) == HUGE_VAL && errno == ERANGE);
+	errno = 0;
+	TEST(strtod("1e-400", NULL) == 0 && errno == ERANGE);
+	TEST(strtod("-2.5e-3x", &end) == -0.0025 && *end == 'x');
+
+	for (i = 0; i < 100000; i++) {
+		d = random_double();
+		snprintf(buf, sizeof buf, "%.17g", d);
+		TEST(strtod(buf, NULL) == d);
+		TEST(sscanf(buf, "%lf", &r) == 1 && r == d);
+		mbstowcs(wbuf, buf, sizeof wbuf / sizeof wbuf[0]);
+		TEST(wcstod(wbuf, NULL) == d);
+	}
+
+#ifdef EXHAUSTIVE
+	step = 1;
+#else
+	step = 4099;
+#endif
+	for (x.u = 0; x.u < 0x7f800000; x.u += step) {
+		snprintf(buf, sizeof buf, "%.9g", x.f);
+		f = strtof(buf, NULL);
+		if (f != x.f)
+			printf("strtof(\"%s\") is %a, expected %a\n", buf, f,
+			    x.f);
+		TEST(f == x.f);
+		if (step > 1)
+			TEST(sscanf(buf, "%f", &f) == 1 && f == x.f);
+	}
+	return 0;
+}
+#endif
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2026 by the newlib contributors. All rights reserved.
+ *
+ * Permission to use, copy, modify, and distribute this software
+ * is freely granted, provided that this notice is preserved.
+ */
+
+/* Check strlen, strchr and memchr against simple byte loops for every
+   length up to MAX_LEN at every alignment up to MAX_ALIGN.  The sizes are
+   chosen to cover the head, the unrolled loop and the tail of vectorized
+   implementations.  */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MAX_LEN 300
+#define MAX_ALIGN 64
+
+#define TOO_MANY_ERRORS 11
+static int errors = 0;
+
+#define ERROR(...)				\
+  do						\
+    {						\
+      if (++errors < TOO_MANY_ERRORS)		\
+	printf (__VA_ARGS__);			\
+    }						\
+  while (0)
+
+static char buf[MAX_ALIGN + MAX_LEN + 64];
+
+static size_t
+ref_strlen (const char *s)
+{
+  const char *p = s;
+
+  while (*p)
+    p++;
+  return p - s;
+}
+
+static const void *
+ref_memchr (const void *s, int c, size_t n)
+{
+  const unsigned char *p = s;
+
+  for (; n > 0; n--, p++)
+    if (*p == (unsigned char) c)
+      return p;
+  return NULL;
+}
+
+static const char *
+ref_strchr (const char *s, int c)
+{
+  for (;; s++)
+    {
+      if (*s == (char) c)
+	return s;
+      if (*s == '\0')
+	return NULL;
+    }
+}
+
+int
+main (void)
+{
+  size_t align, len, pos;
+  char *s;
+
+  for (align = 0; align < MAX_ALIGN; align++)
+    for (len = 0; len < MAX_LEN; len++)
+      {
+	memset (buf, 'x', sizeof buf);
+	s = buf + align;
+	s[len] = '\0';
+
+	if (strlen (s) != ref_strlen (s))
+	  ERROR ("strlen: align %d len %d\n", (int) align, (int) len);
+	if (memchr (s, 'y', len) != NULL)
+	  ERROR ("memchr: align %d len %d found a missing byte\n",
+		 (int) align, (int) len);
+	if (memchr (s, '\0', len + 1) != s + len)
+	  ERROR ("memchr: align %d len %d missed the NUL\n",
+		 (int) align, (int) len);
+	if (strchr (s, '\0') != s + len)
+	  ERROR ("strchr: align %d len %d missed the NUL\n",
+		 (int) align, (int) len);
+
+	for (pos = 0; pos < len; pos += 1 + pos / 8)
+	  {
+	    s[pos] = 'y' | 0x80;
+	    if (memchr (s, 'y' | 0x80, len) != ref_memchr (s, 'y' | 0x80, len))
+	      ERROR ("memchr: align %d len %d pos %d\n",
+		     (int) align, (int) len, (int) pos);
+	    if (memchr (s, 'y' | 0x80, pos) != NULL)
+	      ERROR ("memchr: align %d len %d pos %d read past n\n",
+		     (int) align, (int) len, (int) pos);
+	    if (strchr (s, 'y' | 0x80) != ref_strchr (s, 'y' | 0x80))
+	      ERROR ("strchr: align %d len %d pos %d\n",
+		     (int) align, (int) len, (int) pos);
+	    s[pos] = 'x';
+	  }
+      }
+
+  if (errors != 0)
+    abort ();
+  exit (0);
+}